@@ -34,6 +34,14 @@ install(
     DESTINATION "${CMAKE_INSTALL_INCLUDEDIR}"
 )
 
+if(edgerunner_ENABLE_DAEMON)
+    install(
+        TARGETS edgerunner_daemon
+        RUNTIME #
+        COMPONENT edgerunner_Runtime
+    )
+endif()
+
 write_basic_package_version_file(
     "${package}ConfigVersion.cmake"
     COMPATIBILITY SameMajorVersion
@@ -44,3 +44,9 @@ endif()
 option(edgerunner_ENABLE_GPU "Enable GPU support" OFF)
 option(edgerunner_ENABLE_NPU "Enable NPU support" OFF)
 option(edgerunner_ENABLE_TFLITE "Enable TFLite support" OFF)
+option(edgerunner_ENABLE_DAEMON
+       "Enable the model daemon and remote models (Linux only)" OFF
+)
+option(edgerunner_ENABLE_COMPRESSION
+       "Enable loading zstd and lz4 compressed models" OFF
+)
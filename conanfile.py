@@ -22,7 +22,10 @@ class EdgerunnerRecipe(ConanFile):
         "with_gpu": [True, False],
         "with_npu": [True, False],
         "with_tflite": [True, False],
+        "with_daemon": [True, False],
+        "with_compression": [True, False],
         "examples": [True, False],
+        "python": [True, False],
     }
 
     default_options = {
@@ -31,7 +34,10 @@ class EdgerunnerRecipe(ConanFile):
         "with_gpu": False,
         "with_npu": False,
         "with_tflite": True,
+        "with_daemon": False,
+        "with_compression": False,
         "examples": False,
+        "python": False,
     }
 
     exports_sources = (
@@ -46,6 +52,9 @@ class EdgerunnerRecipe(ConanFile):
         if self.settings.os == "Windows":
             del self.options.fPIC
 
+        if self.settings.os not in ["Linux", "Android"]:
+            del self.options.with_daemon
+
     def set_version(self):
         self.version = load(self, "version.txt")[:-1]
 
@@ -59,9 +68,16 @@ class EdgerunnerRecipe(ConanFile):
         if self.options.with_tflite:
             self.requires("tensorflow-lite/2.12.0")
 
+        if self.options.with_compression:
+            self.requires("zstd/1.5.5")
+            self.requires("lz4/1.9.4")
+
         if self.options.examples:
             self.requires("opencv/4.9.0")
 
+        if self.options.python:
+            self.requires("pybind11/2.12.0")
+
         if self.options.with_npu:
             self.requires("qnn/2.23.0.24.06.24")
 
@@ -94,9 +110,14 @@ class EdgerunnerRecipe(ConanFile):
         toolchain = CMakeToolchain(self)
 
         toolchain.variables["BUILD_EXAMPLES"] = self.options.examples
+        toolchain.variables["BUILD_PYTHON"] = self.options.python
         toolchain.variables["edgerunner_ENABLE_GPU"] = self.options.with_gpu
         toolchain.variables["edgerunner_ENABLE_NPU"] = self.options.with_npu
         toolchain.variables["edgerunner_ENABLE_TFLITE"] = self.options.with_tflite
+        toolchain.variables["edgerunner_ENABLE_DAEMON"] = self.options.get_safe(
+            "with_daemon", False)
+        toolchain.variables["edgerunner_ENABLE_COMPRESSION"] = (
+            self.options.with_compression)
 
         toolchain.generate()
 
@@ -128,5 +149,11 @@ class EdgerunnerRecipe(ConanFile):
         if self.options.with_tflite:
             defines.append("EDGERUNNER_TFLITE")
 
+        if self.options.get_safe("with_daemon"):
+            defines.append("EDGERUNNER_REMOTE")
+
+        if self.options.with_compression:
+            defines.append("EDGERUNNER_COMPRESSION")
+
         self.cpp_info.defines = defines
         self.cpp_info.libs = ["edgerunner"]
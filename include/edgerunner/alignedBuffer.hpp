@@ -0,0 +1,107 @@
+/**
+ * @file alignedBuffer.hpp
+ * @brief Definition of the AlignedBuffer class, an owning buffer of bytes
+ * with a guaranteed alignment
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace edge {
+
+/**
+ * @brief An owning, move-only buffer of bytes with a guaranteed alignment
+ *
+ * Allocation failures do not throw, instead data() returns nullptr.
+ */
+class AlignedBuffer {
+  public:
+    /* cache line size, also the tensor alignment expected by TFLite */
+    static constexpr size_t DefaultAlignment = 64;
+
+    AlignedBuffer() = default;
+
+    /**
+     * @brief Allocate a zero-initialized buffer
+     *
+     * @param size The size of the buffer in bytes
+     * @param alignment The alignment of the buffer, must be a power of two
+     */
+    explicit AlignedBuffer(const size_t size,
+                           const size_t alignment = DefaultAlignment)
+        : m_alignment(alignment) {
+        if (size == 0) {
+            return;
+        }
+
+        m_data = static_cast<uint8_t*>(::operator new(
+            alignUp(size, alignment), std::align_val_t {alignment}, std::nothrow));
+
+        if (m_data != nullptr) {
+            m_size = size;
+            std::fill_n(m_data, alignUp(size, alignment), uint8_t {0});
+        }
+    }
+
+    AlignedBuffer(const AlignedBuffer&) = delete;
+    auto operator=(const AlignedBuffer&) -> AlignedBuffer& = delete;
+
+    AlignedBuffer(AlignedBuffer&& other) noexcept
+        : m_data(std::exchange(other.m_data, nullptr))
+        , m_size(std::exchange(other.m_size, 0))
+        , m_alignment(other.m_alignment) {}
+
+    auto operator=(AlignedBuffer&& other) noexcept -> AlignedBuffer& {
+        if (this != &other) {
+            release();
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+            m_alignment = other.m_alignment;
+        }
+        return *this;
+    }
+
+    ~AlignedBuffer() { release(); }
+
+    /**
+     * @brief Get a pointer to the start of the buffer
+     * @return Pointer to the buffer, nullptr if empty or allocation failed
+     */
+    auto data() const -> uint8_t* { return m_data; }
+
+    /**
+     * @brief Get the size of the buffer
+     * @return The size of the buffer in bytes
+     */
+    auto size() const -> size_t { return m_size; }
+
+    /**
+     * @brief Round a value up to a multiple of an alignment
+     *
+     * @param value The value to round up
+     * @param alignment The alignment, must be a power of two
+     * @return The smallest multiple of alignment not less than value
+     */
+    static constexpr auto alignUp(const size_t value, const size_t alignment)
+        -> size_t {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+  private:
+    void release() {
+        if (m_data != nullptr) {
+            ::operator delete(m_data, std::align_val_t {m_alignment});
+        }
+    }
+
+    uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+    size_t m_alignment = DefaultAlignment;
+};
+
+}  // namespace edge
@@ -0,0 +1,116 @@
+/**
+ * @file arenaGroup.hpp
+ * @brief Definition of the ArenaGroup class, used to share activation memory
+ * between models executed sequentially
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+
+#include "edgerunner/edgerunner_export.hpp"
+
+namespace edge {
+
+enum class STATUS : uint8_t;
+
+/**
+ * @brief Time-multiplexes the scratch memory of a group of models
+ *
+ * Intermediate (non-persistent) tensors of a model are only needed while it
+ * executes. Models created with the same ArenaGroup in their ModelOptions
+ * hold scratch memory only while active: executing a member first releases
+ * the scratch memory of the previously active member, such that the peak
+ * scratch footprint of the group is that of its largest member rather than
+ * the sum of all members.
+ *
+ * Inputs and outputs of members are kept outside of the scratch memory and
+ * preserved across switches. Execution of members is serialized by the group,
+ * members of a group never execute concurrently.
+ *
+ * The group trades switching time for memory: TFLite 2.12 plans and owns the
+ * arena of each interpreter and offers no way to place it in shared memory,
+ * so members do not share one buffer. Switching the active member releases
+ * the scratch memory of the previous member and allocates, and plans, the
+ * scratch memory of the next one. Executing the active member again costs
+ * no allocation, but a pipeline alternating between members allocates on
+ * every execution. Group models whose peak memory matters more than the
+ * latency of switching between them.
+ */
+class EDGERUNNER_EXPORT ArenaGroup {
+  public:
+    /**
+     * @brief Interface implemented by models that can join a group
+     */
+    class Member {
+      public:
+        Member() = default;
+        Member(const Member&) = default;
+        Member(Member&&) = default;
+        auto operator=(const Member&) -> Member& = default;
+        auto operator=(Member&&) -> Member& = default;
+
+        virtual ~Member() = default;
+
+        /**
+         * @brief Allocate the scratch memory of the member
+         * @return The status of the operation
+         */
+        virtual auto acquireScratch() -> STATUS = 0;
+
+        /**
+         * @brief Release the scratch memory of the member
+         * @return The status of the operation
+         */
+        virtual auto releaseScratch() -> STATUS = 0;
+    };
+
+    ArenaGroup() = default;
+
+    ArenaGroup(const ArenaGroup&) = delete;
+    ArenaGroup(ArenaGroup&&) = delete;
+    auto operator=(const ArenaGroup&) -> ArenaGroup& = delete;
+    auto operator=(ArenaGroup&&) -> ArenaGroup& = delete;
+
+    ~ArenaGroup() = default;
+
+    /**
+     * @brief Lock the group and make a member active
+     *
+     * Releases the scratch memory of the previously active member, if any,
+     * and acquires the scratch memory of the given member. The group remains
+     * locked, and the member active, for as long as the lock is held.
+     *
+     * @param member The member to activate
+     * @param lock Set to a lock of the group on return
+     * @return The status of the operation
+     */
+    auto acquire(Member& member, std::unique_lock<std::mutex>& lock)
+        -> STATUS;
+
+    /**
+     * @brief Deactivate a member without acquiring its scratch memory
+     *
+     * Used by members before reallocating or destroying their scratch memory.
+     *
+     * @param member The member to deactivate
+     */
+    void deactivate(const Member& member);
+
+    /**
+     * @brief Check whether a member is active
+     *
+     * @param member The member to check
+     * @return true if the member currently holds the scratch memory
+     */
+    auto isActive(const Member& member) -> bool;
+
+  private:
+    EDGERUNNER_SUPPRESS_C4251
+    std::mutex m_mutex;
+
+    Member* m_active = nullptr;
+};
+
+}  // namespace edge
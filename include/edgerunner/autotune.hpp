@@ -0,0 +1,119 @@
+/**
+ * @file autotune.hpp
+ * @brief Definition of the autotuning options and of the AutotuneCache
+ * class, which persists autotuning decisions on disk
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+#include "edgerunner/edgerunner_export.hpp"
+
+namespace edge {
+
+enum class STATUS : uint8_t;
+enum class DELEGATE : uint8_t;
+
+/**
+ * @brief Options used by Model::autotune()
+ */
+struct AutotuneOptions {
+    /** Cache file of decisions, AutotuneCache::getDefaultPath() if empty */
+    std::filesystem::path cachePath;
+
+    /**
+     * CPU thread counts to benchmark. Empty benchmarks 1, 2, 4 and the
+     * number of hardware threads
+     */
+    std::vector<size_t> threadCounts;
+
+    size_t warmupRuns = 2; /**< Untimed executions per configuration */
+    size_t numRuns = 10; /**< Timed executions per configuration */
+
+    /**
+     * Maximum error of a configuration against the reference outputs, as the
+     * root mean square difference relative to the root mean square of the
+     * reference
+     */
+    double tolerance = 0.05;
+
+    bool force = false; /**< Benchmark even if a decision is cached */
+};
+
+/**
+ * @brief A persisted autotuning decision
+ */
+struct AutotuneDecision {
+    DELEGATE delegate {}; /**< Fastest delegate */
+    size_t numThreads {}; /**< Fastest thread count, 0 for backend default */
+    double latencyMs {}; /**< Median latency of the decision */
+};
+
+/**
+ * @brief Get a fingerprint of the machine and library build
+ *
+ * Combines the operating system, CPU model, number of hardware threads and
+ * the backends enabled at build time, such that decisions are not shared
+ * between machines or builds where they may not hold.
+ *
+ * @return The fingerprint of the machine
+ */
+auto EDGERUNNER_EXPORT getMachineFingerprint() -> uint64_t;
+
+/**
+ * @brief An on-disk cache of autotuning decisions
+ *
+ * Decisions are keyed by model hash and machine fingerprint and stored as
+ * one line of text per decision. Updates rewrite the file atomically, and are
+ * serialized between threads of a process.
+ */
+class EDGERUNNER_EXPORT AutotuneCache {
+  public:
+    /**
+     * @brief Create a cache backed by a file
+     * @param path The path to the cache file, created on first store
+     */
+    explicit AutotuneCache(std::filesystem::path path);
+
+    /**
+     * @brief Get the default cache file path
+     *
+     * Uses $EDGERUNNER_CACHE_DIR if set, otherwise the temporary directory.
+     *
+     * @return The default cache file path
+     */
+    static auto getDefaultPath() -> std::filesystem::path;
+
+    /**
+     * @brief Find a cached decision
+     *
+     * @param modelHash The hash of the model
+     * @param fingerprint The fingerprint of the machine
+     * @return The cached decision, if any
+     */
+    auto find(uint64_t modelHash, uint64_t fingerprint) const
+        -> std::optional<AutotuneDecision>;
+
+    /**
+     * @brief Store a decision, replacing any previous decision for the key
+     *
+     * @param modelHash The hash of the model
+     * @param fingerprint The fingerprint of the machine
+     * @param decision The decision to store
+     * @return The status of the operation
+     */
+    auto store(uint64_t modelHash,
+               uint64_t fingerprint,
+               const AutotuneDecision& decision) -> STATUS;
+
+  private:
+    EDGERUNNER_SUPPRESS_C4251
+    std::filesystem::path m_path;
+};
+
+}  // namespace edge
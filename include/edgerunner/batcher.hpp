@@ -0,0 +1,176 @@
+/**
+ * @file batcher.hpp
+ * @brief Definition of the Batcher class, which combines concurrent single
+ * sample requests into batched executions of a model
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "edgerunner/edgerunner_export.hpp"
+#include "metrics.hpp"
+
+namespace edge {
+
+enum class STATUS : uint8_t;
+class Model;
+
+/**
+ * @brief Options used to configure a Batcher
+ *
+ * Larger batches and longer waits increase throughput at the cost of tail
+ * latency, see Batcher::getStats().
+ */
+struct BatcherOptions {
+    size_t maxBatchSize = 8; /**< Maximum number of samples per execution */
+
+    /**
+     * Maximum time the oldest queued request waits for further requests
+     * before a partial batch is executed
+     */
+    std::chrono::microseconds maxWait {2000};
+};
+
+/**
+ * @brief Result of a batched request
+ */
+struct BatchResult {
+    STATUS status; /**< Status of the execution */
+
+    /**
+     * The bytes of the sample of the request in each output tensor, in the
+     * order of the model outputs
+     */
+    std::vector<std::vector<uint8_t>> outputs;
+};
+
+/**
+ * @brief A point in time snapshot of the statistics of a Batcher
+ */
+struct EDGERUNNER_EXPORT BatcherStats {
+    HistogramSnapshot latency; /**< Time from submission to completion */
+    uint64_t requests {}; /**< Number of completed requests */
+    uint64_t batches {}; /**< Number of model executions */
+};
+
+/**
+ * @brief Combines concurrent single sample requests into batched executions
+ *
+ * Requests are queued until maxBatchSize requests are pending or the oldest
+ * request has waited for maxWait. The queued samples are then packed along
+ * the leading (batch) dimension of the model inputs, the model is executed
+ * once, and each request receives its slice of the outputs.
+ *
+ * The batch dimension of the model is resized to maxBatchSize once a batch
+ * exceeds it, when the model supports it, see Model::resizeInput(). The model
+ * is never shrunk: batches are split into executions of the batch size of the
+ * model, with unused samples zero-filled.
+ *
+ * The batcher takes over execution of the model: the model must not be
+ * executed, resized or destroyed while the batcher is alive.
+ */
+class EDGERUNNER_EXPORT Batcher {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Start batching requests for a model
+     *
+     * @param model The model to execute, with a leading batch dimension in all
+     * inputs and outputs
+     * @param options Options used to configure the batcher
+     */
+    explicit Batcher(Model& model, const BatcherOptions& options = {});
+
+    Batcher(const Batcher&) = delete;
+    Batcher(Batcher&&) = delete;
+    auto operator=(const Batcher&) -> Batcher& = delete;
+    auto operator=(Batcher&&) -> Batcher& = delete;
+
+    /**
+     * @brief Execute all queued requests and stop batching
+     */
+    ~Batcher();
+
+    /**
+     * @brief Submit a single sample request
+     *
+     * @param inputs The bytes of the sample for each input tensor, in the
+     * order of the model inputs. Each must hold exactly getInputSampleSize()
+     * bytes
+     * @return A future holding the status and outputs of the request, FAIL if
+     * the inputs do not match the model
+     */
+    auto submit(std::vector<std::vector<uint8_t>> inputs)
+        -> std::future<BatchResult>;
+
+    /**
+     * @brief Get the number of bytes of a single sample of an input
+     *
+     * @param index The index of the input tensor
+     * @return The number of bytes of one sample, 0 if index is out of bounds
+     */
+    auto getInputSampleSize(size_t index) const -> size_t;
+
+    /**
+     * @brief Take a snapshot of the statistics of the batcher
+     * @return A snapshot of the statistics
+     */
+    auto getStats() const -> BatcherStats;
+
+  private:
+    struct Pending {
+        std::vector<std::vector<uint8_t>> inputs;
+        Clock::time_point submitted;
+        std::promise<BatchResult> promise;
+    };
+
+    void run();
+
+    void executeBatch(std::vector<Pending>& batch);
+
+    auto resizeBatch(size_t batchSize) -> STATUS;
+
+    Model& m_model;
+    BatcherOptions m_options;
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::vector<size_t> m_inputSampleSizes;
+
+    size_t m_batchSize = 1; /**< Current batch dimension of the model */
+    bool m_resizable = true;
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::mutex m_mutex;
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::condition_variable m_condition;
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::deque<Pending> m_queue;
+
+    bool m_stopping = false;
+
+    LatencyHistogram m_latency;
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::atomic<uint64_t> m_requests {};
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::atomic<uint64_t> m_batches {};
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::thread m_worker;
+};
+
+}  // namespace edge
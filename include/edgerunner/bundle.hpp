@@ -0,0 +1,207 @@
+/**
+ * @file bundle.hpp
+ * @brief Definition of the Bundle and BundleWriter classes, a single file
+ * holding a model with its delegate caches, labels and metadata
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nonstd/span.hpp>
+
+#include "alignedBuffer.hpp"
+#include "edgerunner/edgerunner_export.hpp"
+
+namespace edge {
+
+enum class DELEGATE : uint8_t;
+enum class STATUS : uint8_t;
+
+/**
+ * @enum SECTION
+ * @brief Type of the contents of a bundle section
+ */
+enum class SECTION : uint32_t {
+    TFLITE = 1, /**< TensorFlow Lite flatbuffer */
+    QNN_CONTEXT = 2, /**< QNN context binary compiled for a delegate */
+    LABELS = 3, /**< Newline separated labels of the model outputs */
+    METADATA = 4 /**< Named metadata value */
+};
+
+/**
+ * @brief A section of a bundle, a view into the mapped bundle
+ */
+struct BundleSection {
+    SECTION type; /**< Type of the contents */
+    DELEGATE delegate; /**< Delegate a compiled cache is compiled for */
+    std::string name; /**< Name of the section, e.g. a metadata key */
+    nonstd::span<uint8_t> data; /**< Contents, valid while the bundle is */
+};
+
+/**
+ * @brief A read-only bundle, mapped once for the lifetime of its models
+ *
+ * A bundle file (.edgerunner) starts with a 16 byte header: the magic
+ * "EDGEBNDL", the format version and the number of sections, followed by an
+ * index of 64 byte entries: type, delegate, offset and size of a section and
+ * a name of up to 39 characters. All integers are little-endian, bundles are
+ * only supported on little-endian hosts. Sections start at multiples of
+ * SectionAlignment, such that their contents are page aligned in memory and
+ * handed to backends without copies.
+ *
+ * The file is mapped copy-on-write, writes to sections are not persisted.
+ * Deploying a new bundle with BundleWriter::write() replaces the file
+ * atomically, models keep the mapping of the file they were created from.
+ */
+class EDGERUNNER_EXPORT Bundle {
+  public:
+    /** Alignment of sections in the file, the largest common page size */
+    static constexpr size_t SectionAlignment = 16384;
+
+    /**
+     * @brief Map a bundle file
+     *
+     * @param bundlePath The path to the bundle file
+     * @return The bundle, nullptr if the file cannot be mapped or is malformed
+     */
+    static auto open(const std::filesystem::path& bundlePath)
+        -> std::shared_ptr<Bundle>;
+
+    Bundle(const Bundle&) = delete;
+    Bundle(Bundle&&) = delete;
+    auto operator=(const Bundle&) -> Bundle& = delete;
+    auto operator=(Bundle&&) -> Bundle& = delete;
+
+    /**
+     * @brief Unmap the bundle, invalidating all sections
+     */
+    ~Bundle();
+
+    /**
+     * @brief Get the name of the bundle, the stem of its file name
+     * @return The name of the bundle
+     */
+    auto name() const -> const std::string& { return m_name; }
+
+    /**
+     * @brief Get all sections, in the order of the index
+     * @return The sections of the bundle
+     */
+    auto getSections() const -> const std::vector<BundleSection>& {
+        return m_sections;
+    }
+
+    /**
+     * @brief Get the contents of a section
+     *
+     * @param type The type of the section
+     * @param name The name of the section, empty for the first section of
+     * the type
+     * @return The contents of the section, empty if not found
+     */
+    auto getSection(SECTION type, const std::string& name = {}) const
+        -> nonstd::span<uint8_t>;
+
+    /**
+     * @brief Get the QNN context binary compiled for a delegate
+     *
+     * @param delegate The delegate the context is compiled for
+     * @return The context binary, empty if not found
+     */
+    auto getDelegateCache(DELEGATE delegate) const -> nonstd::span<uint8_t>;
+
+    /**
+     * @brief Get the labels of the model outputs
+     * @return Views of the labels in the mapping, empty without LABELS section
+     */
+    auto getLabels() const -> std::vector<std::string_view>;
+
+    /**
+     * @brief Get a metadata value
+     *
+     * @param name The key of the metadata value
+     * @return A view of the value in the mapping, empty if not found
+     */
+    auto getMetadata(const std::string& name) const -> std::string_view;
+
+  private:
+    Bundle() = default;
+
+    auto parse() -> STATUS;
+
+    std::string m_name;
+
+    uint8_t* m_data = nullptr; /**< Mapped file */
+    size_t m_size = 0; /**< Size of the mapped file */
+
+    /** Contents of the file, only used where files cannot be mapped */
+    AlignedBuffer m_buffer;
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::vector<BundleSection> m_sections;
+};
+
+/**
+ * @brief Writes bundle files, see Bundle for the format
+ */
+class EDGERUNNER_EXPORT BundleWriter {
+  public:
+    /**
+     * @brief Add a section
+     *
+     * @param type The type of the section
+     * @param data The contents of the section
+     * @param name The name of the section, at most 39 characters
+     * @param delegate The delegate a compiled cache is compiled for
+     * @return The status of the operation, FAIL if the name is too long
+     */
+    auto addSection(SECTION type,
+                    std::vector<uint8_t> data,
+                    const std::string& name = {},
+                    DELEGATE delegate = {}) -> STATUS;
+
+    /**
+     * @brief Add a section with the contents of a file
+     *
+     * @param type The type of the section
+     * @param path The path to the file
+     * @param name The name of the section, at most 39 characters
+     * @param delegate The delegate a compiled cache is compiled for
+     * @return The status of the operation, FAIL if the file cannot be read
+     */
+    auto addFile(SECTION type,
+                 const std::filesystem::path& path,
+                 const std::string& name = {},
+                 DELEGATE delegate = {}) -> STATUS;
+
+    /**
+     * @brief Write the bundle
+     *
+     * The bundle is written to a temporary file next to bundlePath, unique
+     * to the write, which is stored and renamed to bundlePath once complete.
+     *
+     * @param bundlePath The path to the bundle file, usually .edgerunner
+     * @return The status of the operation
+     */
+    auto write(const std::filesystem::path& bundlePath) const -> STATUS;
+
+  private:
+    struct Section {
+        SECTION type;
+        DELEGATE delegate;
+        std::string name;
+        std::vector<uint8_t> data;
+    };
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::vector<Section> m_sections;
+};
+
+}  // namespace edge
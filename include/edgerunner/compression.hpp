@@ -0,0 +1,80 @@
+/**
+ * @file compression.hpp
+ * @brief Detection and streaming decompression of compressed model files
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+
+#include <nonstd/span.hpp>
+
+#include "alignedBuffer.hpp"
+#include "edgerunner/edgerunner_export.hpp"
+
+namespace edge {
+
+/**
+ * @enum COMPRESSION
+ * @brief Compression format of a model file, detected from its extension
+ */
+enum class COMPRESSION : uint8_t {
+    NONE, /**< Uncompressed */
+    ZSTD, /**< Zstandard frames, .zst */
+    LZ4 /**< LZ4 frames, .lz4 */
+};
+
+/**
+ * @brief Detect the compression format of a model file
+ *
+ * @param modelPath The path to the model file, e.g. model.tflite.zst
+ * @return The compression format, NONE for other extensions
+ */
+inline auto getCompression(const std::filesystem::path& modelPath)
+    -> COMPRESSION {
+    const auto extension = modelPath.extension();
+
+    if (extension == ".zst") {
+        return COMPRESSION::ZSTD;
+    }
+
+    if (extension == ".lz4") {
+        return COMPRESSION::LZ4;
+    }
+
+    return COMPRESSION::NONE;
+}
+
+/**
+ * @brief Get the path of a model file without its compression extension
+ *
+ * @param modelPath The path to the model file, e.g. model.tflite.zst
+ * @return The path without compression extension, e.g. model.tflite
+ */
+inline auto getUncompressedPath(const std::filesystem::path& modelPath)
+    -> std::filesystem::path {
+    if (getCompression(modelPath) == COMPRESSION::NONE) {
+        return modelPath;
+    }
+
+    return std::filesystem::path {modelPath}.replace_extension();
+}
+
+/**
+ * @brief Decompress a model file into a single aligned buffer
+ *
+ * The file is read in chunks which are decompressed directly into the
+ * buffer. The buffer is sized from the content size recorded in the frame
+ * header, and only grown when the header does not record it.
+ *
+ * @param modelPath The path to the compressed model file
+ * @param buffer The buffer receiving the model, must outlive the model
+ * @return The decompressed model in the buffer, empty on failure or when
+ * built without compression support
+ */
+auto EDGERUNNER_EXPORT decompressModel(const std::filesystem::path& modelPath,
+                                       AlignedBuffer& buffer)
+    -> nonstd::span<uint8_t>;
+
+}  // namespace edge
@@ -5,11 +5,16 @@
 
 #pragma once
 
+#include <cstddef>
 #include <filesystem>
+#include <future>
 #include <memory>
+#include <vector>
 
+#include "bundle.hpp"
 #include "edgerunner/edgerunner_export.hpp"
 #include "model.hpp"
+#include "options.hpp"
 
 namespace edge {
 
@@ -22,10 +27,14 @@ namespace edge {
  * createModel() is the intended way to instantiate a Model using the edgerunner
  * library
  *
+ * Bundles (.edgerunner) are mapped once, see Bundle.
+ *
  * @param modelPath The file path to the model file
+ * @param options Options used to configure the created model
  * @return A unique pointer to the created Model object
  */
-auto EDGERUNNER_EXPORT createModel(const std::filesystem::path& modelPath)
+auto EDGERUNNER_EXPORT createModel(const std::filesystem::path& modelPath,
+                                   const ModelOptions& options = {})
     -> std::unique_ptr<Model>;
 
 /**
@@ -38,10 +47,62 @@ auto EDGERUNNER_EXPORT createModel(const std::filesystem::path& modelPath)
  * library
  *
  * @param modelBuffer The buffer of the model file
+ * @param modelExtension The file extension corresponding to the model format
+ * @param options Options used to configure the created model
  * @return A unique pointer to the created Model object
  */
 auto EDGERUNNER_EXPORT createModel(const nonstd::span<uint8_t>& modelBuffer,
-                                   const std::string& modelExtension = "tflite")
+                                   const std::string& modelExtension = "tflite",
+                                   const ModelOptions& options = {})
     -> std::unique_ptr<Model>;
 
+/**
+ * @brief Function to create a model from a bundle
+ *
+ * The model is created from the QNN context binary compiled for the NPU when
+ * available and supported, otherwise from the TFLite flatbuffer. Sections are
+ * used in place, the model keeps the bundle mapped, see Model::getBundle().
+ *
+ * @param bundle The bundle holding the model, see Bundle::open()
+ * @param options Options used to configure the created model
+ * @return A unique pointer to the created Model object, nullptr if bundle is
+ * nullptr or holds no supported model
+ */
+auto EDGERUNNER_EXPORT createModel(const std::shared_ptr<Bundle>& bundle,
+                                   const ModelOptions& options = {})
+    -> std::unique_ptr<Model>;
+
+/**
+ * @brief Function to create a model from a given file path asynchronously
+ *
+ * The model is created by createModel() on a dedicated thread, such that the
+ * caller can overlap model loading with other work.
+ *
+ * @param modelPath The file path to the model file
+ * @param options Options used to configure the created model
+ * @return A future holding the created Model object, nullptr on failure
+ */
+auto EDGERUNNER_EXPORT createModelAsync(const std::filesystem::path& modelPath,
+                                        const ModelOptions& options = {})
+    -> std::future<std::unique_ptr<Model>>;
+
+/**
+ * @brief Function to create several models in parallel
+ *
+ * Models are created by createModel() on a pool of at most maxThreads worker
+ * threads, such that the total loading time approaches that of the slowest
+ * model rather than the sum of all models.
+ *
+ * @param modelPaths The file paths to the model files
+ * @param options Options used to configure all created models
+ * @param maxThreads The maximum number of worker threads, 0 uses the number
+ * of hardware threads
+ * @return The created Model objects, in the order of modelPaths. Models that
+ * failed to load are nullptr
+ */
+auto EDGERUNNER_EXPORT
+createModels(const std::vector<std::filesystem::path>& modelPaths,
+             const ModelOptions& options = {},
+             size_t maxThreads = 0) -> std::vector<std::unique_ptr<Model>>;
+
 }  // namespace edge
@@ -0,0 +1,66 @@
+/**
+ * @file hash.hpp
+ * @brief Non-cryptographic hashing of model files and buffers
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+
+#include <nonstd/span.hpp>
+
+namespace edge {
+
+/* 64-bit FNV-1a parameters */
+static constexpr uint64_t HashOffsetBasis = 0xcbf29ce484222325ULL;
+static constexpr uint64_t HashPrime = 0x100000001b3ULL;
+
+/**
+ * @brief Hash a buffer with 64-bit FNV-1a
+ *
+ * @param bytes The buffer to hash
+ * @param seed The hash of preceding bytes, to hash data in several parts
+ * @return The hash of the buffer
+ */
+inline auto hashBytes(const nonstd::span<const uint8_t> bytes,
+                      uint64_t seed = HashOffsetBasis) -> uint64_t {
+    for (const auto byte : bytes) {
+        seed ^= byte;
+        seed *= HashPrime;
+    }
+
+    return seed;
+}
+
+/**
+ * @brief Hash the contents of a file with 64-bit FNV-1a
+ *
+ * @param path The path to the file
+ * @return The hash of the file, 0 if the file cannot be read
+ */
+inline auto hashFile(const std::filesystem::path& path) -> uint64_t {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return 0;
+    }
+
+    static constexpr size_t ChunkSize = 64 * 1024;
+    std::array<char, ChunkSize> chunk {};
+
+    uint64_t hash = HashOffsetBasis;
+    while (file.read(chunk.data(), chunk.size()) || file.gcount() > 0) {
+        hash = hashBytes(
+            {reinterpret_cast<const uint8_t*> /* NOLINT */ (chunk.data()),
+             static_cast<size_t>(file.gcount())},
+            hash);
+    }
+
+    return hash;
+}
+
+}  // namespace edge
@@ -0,0 +1,267 @@
+/**
+ * @file kvCache.hpp
+ * @brief Definition of the KVCache class, a paged key/value cache for
+ * autoregressive decoding
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include <nonstd/span.hpp>
+
+#include "edgerunner/edgerunner_export.hpp"
+
+namespace edge {
+
+enum class STATUS : uint8_t;
+class Model;
+
+/**
+ * @brief Options used to configure a KVCache
+ */
+struct KVCacheOptions {
+    /**
+     * Number of cache tensors of a sequence, e.g. twice the number of layers
+     * for separate keys and values
+     */
+    size_t numCaches = 2;
+
+    /**
+     * Size of one token in one cache tensor. Must be a multiple of
+     * AlignedBuffer::DefaultAlignment, such that the slots bound as model
+     * outputs are aligned, creation fails otherwise.
+     */
+    size_t bytesPerToken {};
+
+    size_t maxTokens {}; /**< Number of tokens of the cache inputs of the model */
+
+    /**
+     * Number of tokens per block, rounded up such that blocks are whole
+     * memory pages, see KVCache::getBlockTokens(). Blocks hold a multiple of
+     * pageSize / gcd(bytesPerToken, pageSize) tokens, at most
+     * pageSize / AlignedBuffer::DefaultAlignment.
+     */
+    size_t blockTokens = 16;
+
+    size_t numBlocks {}; /**< Number of blocks, shared by all sequences */
+
+    /**
+     * Evict the oldest block of a sequence that outgrows maxTokens instead of
+     * failing, such that the sequence keeps a sliding window of tokens
+     */
+    bool slidingWindow = false;
+};
+
+/**
+ * @brief Binding of a cache tensor to the inputs and outputs of a model
+ */
+struct KVCacheBinding {
+    size_t cache {}; /**< The index of the cache tensor */
+    size_t inputIndex {}; /**< The model input reading the cached tokens */
+
+    /** The model output producing the tokens appended to the cache */
+    size_t outputIndex {};
+};
+
+/**
+ * @brief A paged key/value cache for autoregressive decoding
+ *
+ * All memory is preallocated as a pool of fixed size blocks. Each sequence
+ * owns a block table, and each of its cache tensors is a contiguous virtual
+ * window of maxTokens tokens into which the blocks of the table are mapped.
+ * Positions without a block read as zeros.
+ *
+ * Windows are bound directly as model inputs, and the slots of the next
+ * tokens as model outputs (see bind()), such that the model appends tokens
+ * in place. Appending tokens, allocating blocks, evicting the oldest blocks
+ * and switching sequences only update pointers and page mappings, and never
+ * copy cached tokens.
+ *
+ * Requires Linux or Android; elsewhere creation fails. Not thread-safe.
+ */
+class EDGERUNNER_EXPORT KVCache {
+  public:
+    /**
+     * @brief Constructor for the KVCache class
+     *
+     * Check getCreationStatus() before use.
+     *
+     * @param options Options used to configure the cache
+     */
+    explicit KVCache(const KVCacheOptions& options);
+
+    KVCache(const KVCache&) = delete;
+    KVCache(KVCache&&) = delete;
+    auto operator=(const KVCache&) -> KVCache& = delete;
+    auto operator=(KVCache&&) -> KVCache& = delete;
+
+    /**
+     * @brief Release all memory, models bound to the cache must be rebound
+     */
+    ~KVCache();
+
+    /**
+     * @brief Get the status of the creation of the cache
+     * @return The status of the creation
+     */
+    auto getCreationStatus() const -> STATUS;
+
+    /**
+     * @brief Create an empty sequence
+     *
+     * @param sequence Set to the identifier of the created sequence
+     * @return The status of the operation
+     */
+    auto createSequence(size_t& sequence) -> STATUS;
+
+    /**
+     * @brief Remove a sequence and free its blocks
+     *
+     * @param sequence The sequence to remove
+     * @return The status of the operation, FAIL if there is no such sequence
+     */
+    auto removeSequence(size_t sequence) -> STATUS;
+
+    /**
+     * @brief Allocate the blocks holding the next tokens of a sequence
+     *
+     * A sequence that would outgrow maxTokens evicts its oldest blocks when
+     * slidingWindow is set, and fails otherwise.
+     *
+     * @param sequence The sequence to extend
+     * @param numTokens The number of tokens to make room for
+     * @return The status of the operation, FAIL if no block is free
+     */
+    auto reserve(size_t sequence, size_t numTokens = 1) -> STATUS;
+
+    /**
+     * @brief Commit the next tokens of a sequence, written by the model or
+     * through getCache()
+     *
+     * @param sequence The sequence to extend
+     * @param numTokens The number of tokens to commit, reserved beforehand
+     * @return The status of the operation
+     */
+    auto append(size_t sequence, size_t numTokens = 1) -> STATUS;
+
+    /**
+     * @brief Drop the newest tokens of a sequence, e.g. rejected speculative
+     * tokens, freeing blocks no longer used
+     *
+     * @param sequence The sequence to shorten
+     * @param length The new number of tokens of the sequence
+     * @return The status of the operation
+     */
+    auto truncate(size_t sequence, size_t length) -> STATUS;
+
+    /**
+     * @brief Drop the oldest blocks of a sequence
+     *
+     * Remaining tokens move to the start of the windows without a copy, and
+     * the sequence shortens by the evicted tokens.
+     *
+     * @param sequence The sequence to shorten
+     * @param numBlocks The number of blocks to evict
+     * @return The status of the operation
+     */
+    auto evict(size_t sequence, size_t numBlocks = 1) -> STATUS;
+
+    /**
+     * @brief Bind the cache of a sequence to a model
+     *
+     * Reserves numTokens tokens, then binds the window of each cache tensor
+     * as the model input, and the slots of the reserved tokens as the model
+     * output. Call append() after a successful execution. Rebinding after
+     * each token only updates the data pointers of the model tensors on
+     * backends that support it, see Model::bindInput().
+     *
+     * @param model The model to bind
+     * @param sequence The sequence to bind
+     * @param bindings The cache tensors and the model tensors to bind them to
+     * @param numTokens The number of tokens produced by the next execution
+     * @return The status of the operation
+     */
+    auto bind(Model& model,
+              size_t sequence,
+              const std::vector<KVCacheBinding>& bindings,
+              size_t numTokens = 1) -> STATUS;
+
+    /**
+     * @brief Get the window of a cache tensor of a sequence
+     *
+     * Only positions of reserved or committed tokens may be written.
+     *
+     * @param sequence The sequence
+     * @param cache The index of the cache tensor
+     * @return The window of maxTokens tokens, empty if there is no such cache
+     */
+    auto getCache(size_t sequence, size_t cache) -> nonstd::span<uint8_t>;
+
+    /**
+     * @brief Get the number of committed tokens of a sequence, also the
+     * position of its next token
+     *
+     * @param sequence The sequence
+     * @return The number of tokens, 0 if there is no such sequence
+     */
+    auto getLength(size_t sequence) const -> size_t;
+
+    /**
+     * @brief Get the number of tokens evicted from a sequence
+     *
+     * @param sequence The sequence
+     * @return The number of evicted tokens, 0 if there is no such sequence
+     */
+    auto getNumEvicted(size_t sequence) const -> size_t;
+
+    /**
+     * @brief Get the number of free blocks
+     * @return The number of free blocks
+     */
+    auto getNumFreeBlocks() const -> size_t { return m_freeBlocks.size(); }
+
+    /**
+     * @brief Get the number of tokens per block, after rounding to pages
+     * @return The number of tokens per block
+     */
+    auto getBlockTokens() const -> size_t { return m_blockTokens; }
+
+  private:
+    struct Sequence {
+        std::vector<uint8_t*> windows; /**< Window of each cache tensor */
+        std::vector<size_t> blockTable; /**< Block of each window slot */
+        size_t length {};
+        size_t numEvicted {};
+    };
+
+    /* maps the block of a window slot, or the zero block past the table */
+    auto mapSlot(const Sequence& sequence, size_t slot) -> STATUS;
+
+    void freeBlocks(Sequence& sequence, size_t numBlocks);
+
+    auto findSequence(size_t sequence) -> Sequence*;
+
+    auto findSequence(size_t sequence) const -> const Sequence*;
+
+    KVCacheOptions m_options;
+
+    size_t m_blockTokens {};
+    size_t m_blockBytes {};
+    size_t m_windowSlots {};
+
+    int m_fileDescriptor = -1;
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::vector<size_t> m_freeBlocks;
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::map<size_t, Sequence> m_sequences;
+
+    size_t m_nextSequence {};
+};
+
+}  // namespace edge
@@ -0,0 +1,37 @@
+/**
+ * @file memoryStats.hpp
+ * @brief Definition of the MemoryStats struct, the memory footprint of a model
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace edge {
+
+/**
+ * @brief Memory footprint of a model, in bytes
+ *
+ * Each field counts memory owned by a distinct allocation, such that the sum
+ * of all fields is the footprint of the model. Backends report 0 for memory
+ * they do not own or cannot query.
+ */
+struct MemoryStats {
+    size_t modelBytes {}; /**< Mapped or loaded model file */
+    size_t persistentArenaBytes {}; /**< Arena kept across executions */
+    size_t nonPersistentArenaBytes {}; /**< Arena reused between nodes */
+    size_t dynamicBytes {}; /**< Tensors allocated outside of arenas */
+    size_t delegateBytes {}; /**< Buffers owned by a delegate */
+    size_t ioBytes {}; /**< Client input and output buffers */
+
+    /**
+     * @brief Get the total memory footprint of the model
+     * @return The sum of all reported bytes
+     */
+    auto getTotalBytes() const -> size_t {
+        return modelBytes + persistentArenaBytes + nonPersistentArenaBytes
+            + dynamicBytes + delegateBytes + ioBytes;
+    }
+};
+
+}  // namespace edge
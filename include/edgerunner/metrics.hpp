@@ -0,0 +1,280 @@
+/**
+ * @file metrics.hpp
+ * @brief Definition of lock-free latency histograms and counters used to
+ * instrument models
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "edgerunner/edgerunner_export.hpp"
+
+namespace edge {
+
+enum class STATUS : uint8_t;
+
+/**
+ * @brief A point in time snapshot of a LatencyHistogram
+ *
+ * All values are in microseconds.
+ */
+struct EDGERUNNER_EXPORT HistogramSnapshot {
+    uint64_t count {}; /**< Number of recorded values */
+    uint64_t sum {}; /**< Sum of recorded values */
+    uint64_t min {}; /**< Smallest recorded value */
+    uint64_t max {}; /**< Largest recorded value */
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::vector<uint64_t> buckets; /**< Per-bucket value counts */
+
+    /**
+     * @brief Get the value at the given percentile
+     *
+     * The returned value is the highest value equivalent to the bucket
+     * containing the percentile, bounded by the largest recorded value.
+     *
+     * @param percentile The percentile in the range [0, 100]
+     * @return The value at the given percentile, 0 if no values are recorded
+     */
+    auto getPercentile(double percentile) const -> uint64_t;
+
+    /**
+     * @brief Get the mean of the recorded values
+     *
+     * @return The mean of the recorded values, 0 if no values are recorded
+     */
+    auto getMean() const -> double;
+};
+
+/**
+ * @brief A lock-free, HDR style latency histogram
+ *
+ * Values are bucketed log-linearly: each power of two range is split into
+ * SubBucketCount linear buckets, bounding the relative error of reported
+ * percentiles to 1/SubBucketCount. Recording only performs relaxed atomic
+ * operations and may be used concurrently from any number of threads.
+ */
+class EDGERUNNER_EXPORT LatencyHistogram {
+  public:
+    static constexpr size_t SubBucketBits = 5;
+    static constexpr size_t SubBucketCount = size_t {1} << SubBucketBits;
+
+    /* values are clamped to 2^36us (~19 hours) */
+    static constexpr size_t MaxExponent = 36;
+    static constexpr uint64_t MaxValue = (uint64_t {1} << MaxExponent) - 1;
+    static constexpr size_t NumBuckets =
+        (MaxExponent - SubBucketBits + 1) * SubBucketCount;
+
+    LatencyHistogram() { reset(); }
+
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram(LatencyHistogram&&) = delete;
+    auto operator=(const LatencyHistogram&) -> LatencyHistogram& = delete;
+    auto operator=(LatencyHistogram&&) -> LatencyHistogram& = delete;
+
+    ~LatencyHistogram() = default;
+
+    /**
+     * @brief Record a value
+     *
+     * @param value The value to record in microseconds
+     */
+    void record(uint64_t value) noexcept;
+
+    /**
+     * @brief Take a snapshot of the recorded values
+     *
+     * Values recorded concurrently with the snapshot may or may not be
+     * included.
+     *
+     * @return A snapshot of the histogram
+     */
+    auto snapshot() const -> HistogramSnapshot;
+
+    /**
+     * @brief Clear all recorded values
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Get the bucket index that a value is recorded in
+     *
+     * @param value The value in microseconds
+     * @return The index of the corresponding bucket
+     */
+    static auto getBucketIndex(uint64_t value) noexcept -> size_t;
+
+    /**
+     * @brief Get the highest value recorded in a given bucket
+     *
+     * @param index The index of the bucket
+     * @return The highest value equivalent to the bucket
+     */
+    static auto getBucketUpperBound(size_t index) noexcept -> uint64_t;
+
+  private:
+    EDGERUNNER_SUPPRESS_C4251
+    std::array<std::atomic<uint64_t>, NumBuckets> m_buckets;
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::atomic<uint64_t> m_sum {};
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::atomic<uint64_t> m_min {std::numeric_limits<uint64_t>::max()};
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::atomic<uint64_t> m_max {};
+};
+
+/**
+ * @brief Records the time elapsed during its lifetime into a histogram
+ */
+class ScopedLatency {
+  public:
+    /**
+     * @brief Start timing
+     *
+     * @param histogram The histogram to record the elapsed time into
+     */
+    explicit ScopedLatency(LatencyHistogram& histogram)
+        : m_histogram(histogram)
+        , m_start(std::chrono::steady_clock::now()) {}
+
+    ScopedLatency(const ScopedLatency&) = delete;
+    ScopedLatency(ScopedLatency&&) = delete;
+    auto operator=(const ScopedLatency&) -> ScopedLatency& = delete;
+    auto operator=(ScopedLatency&&) -> ScopedLatency& = delete;
+
+    /**
+     * @brief Stop timing and record the elapsed time
+     */
+    ~ScopedLatency() {
+        const auto elapsed =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - m_start);
+        m_histogram.record(static_cast<uint64_t>(elapsed.count()));
+    }
+
+  private:
+    LatencyHistogram& m_histogram;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+/**
+ * @brief A point in time snapshot of ModelMetrics
+ */
+struct EDGERUNNER_EXPORT MetricsSnapshot {
+    HistogramSnapshot load; /**< Model load latency */
+    HistogramSnapshot allocate; /**< Tensor allocation latency */
+    HistogramSnapshot execute; /**< Model execution latency */
+    uint64_t executions {}; /**< Number of executions */
+    uint64_t failures {}; /**< Number of failed executions */
+};
+
+/**
+ * @brief Per-model latency histograms and execution counters
+ *
+ * Metrics are always collected. Recording is lock-free and cheap enough to
+ * be left enabled in production.
+ */
+class EDGERUNNER_EXPORT ModelMetrics {
+  public:
+    using TimePoint = std::chrono::steady_clock::time_point;
+
+    ModelMetrics() = default;
+
+    ModelMetrics(const ModelMetrics&) = delete;
+    ModelMetrics(ModelMetrics&&) = delete;
+    auto operator=(const ModelMetrics&) -> ModelMetrics& = delete;
+    auto operator=(ModelMetrics&&) -> ModelMetrics& = delete;
+
+    ~ModelMetrics() = default;
+
+    /**
+     * @brief Get the model load latency histogram
+     * @return Reference to the load latency histogram
+     */
+    auto getLoadLatency() -> LatencyHistogram& { return m_load; }
+
+    /**
+     * @brief Get the tensor allocation latency histogram
+     * @return Reference to the allocation latency histogram
+     */
+    auto getAllocateLatency() -> LatencyHistogram& { return m_allocate; }
+
+    /**
+     * @brief Get the execution latency histogram
+     * @return Reference to the execution latency histogram
+     */
+    auto getExecuteLatency() -> LatencyHistogram& { return m_execute; }
+
+    /**
+     * @brief Get the current time, used as the start of an execution
+     * @return The current time
+     */
+    static auto now() -> TimePoint { return std::chrono::steady_clock::now(); }
+
+    /**
+     * @brief Record a completed execution
+     *
+     * @param start The time at which the execution started
+     * @param status The status of the execution
+     */
+    void recordExecution(TimePoint start, STATUS status) noexcept;
+
+    /**
+     * @brief Take a snapshot of all metrics
+     * @return A snapshot of all metrics
+     */
+    auto snapshot() const -> MetricsSnapshot;
+
+    /**
+     * @brief Clear all metrics
+     */
+    void reset() noexcept;
+
+  private:
+    LatencyHistogram m_load;
+    LatencyHistogram m_allocate;
+    LatencyHistogram m_execute;
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::atomic<uint64_t> m_executions {};
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::atomic<uint64_t> m_failures {};
+};
+
+/**
+ * @brief Export a metrics snapshot as a JSON object
+ *
+ * @param snapshot The snapshot to export
+ * @param modelName The name of the model the snapshot was taken from
+ * @return The JSON representation of the snapshot
+ */
+auto EDGERUNNER_EXPORT toJson(const MetricsSnapshot& snapshot,
+                              const std::string& modelName) -> std::string;
+
+/**
+ * @brief Export a metrics snapshot in the Prometheus text exposition format
+ *
+ * Latencies are exported as summaries with p50, p90, p99 and p999 quantiles,
+ * labelled by model name.
+ *
+ * @param snapshot The snapshot to export
+ * @param modelName The name of the model the snapshot was taken from
+ * @return The Prometheus text representation of the snapshot
+ */
+auto EDGERUNNER_EXPORT toPrometheus(const MetricsSnapshot& snapshot,
+                                    const std::string& modelName)
+    -> std::string;
+
+}  // namespace edge
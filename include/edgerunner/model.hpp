@@ -6,12 +6,25 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <filesystem>
+#include <future>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <nonstd/span.hpp>
 
+#include "autotune.hpp"
+#include "bundle.hpp"
+#include "compression.hpp"
 #include "edgerunner/edgerunner_export.hpp"
+#include "memoryStats.hpp"
+#include "metrics.hpp"
+#include "profiling.hpp"
 #include "tensor.hpp"
 
 namespace edge {
@@ -36,6 +49,19 @@ enum class STATUS : uint8_t {
     FAIL /**< Operation failed */
 };
 
+/**
+ * @brief Result of an asynchronous execution
+ */
+struct AsyncResult {
+    STATUS status; /**< Status of the execution */
+
+    /**
+     * Copies of the output tensors of the execution, owned by the caller and
+     * not overwritten by further executions.
+     */
+    std::vector<std::shared_ptr<Tensor>> outputs;
+};
+
 /**
  * @class Model
  * @brief A base class for machine learning models.
@@ -50,16 +76,28 @@ class EDGERUNNER_EXPORT Model {
      * @brief Constructor for the Model class.
      *
      * This constructor initializes a Model object with the given model path.
+     * The name excludes the compression extension of compressed models.
      *
      * @param modelPath The path to the model file.
      */
     explicit Model(const std::filesystem::path& modelPath)
-        : m_name(modelPath.stem().string()) {}
+        : m_name(getUncompressedPath(modelPath).stem().string()) {}
+
+    /**
+     * @brief Constructor for models created from a bundle.
+     *
+     * The model is named after the bundle and keeps it mapped.
+     *
+     * @param bundle The bundle holding the model.
+     */
+    explicit Model(std::shared_ptr<Bundle> bundle)
+        : m_name(bundle->name())
+        , m_bundle(std::move(bundle)) {}
 
     Model() = default;
-    Model(const Model&) = default;
+    Model(const Model&) = delete;
     Model(Model&&) = delete;
-    auto operator=(const Model&) -> Model& = default;
+    auto operator=(const Model&) -> Model& = delete;
     auto operator=(Model&&) -> Model& = delete;
 
     /**
@@ -123,6 +161,24 @@ class EDGERUNNER_EXPORT Model {
      */
     auto getOutput(size_t index) const -> std::shared_ptr<Tensor>;
 
+    /**
+     * @brief Get the input tensor with the specified name.
+     *
+     * @param name The name of the input tensor
+     * @return The input tensor with the specified name, or nullptr if there is
+     * none
+     */
+    auto getInput(const std::string& name) const -> std::shared_ptr<Tensor>;
+
+    /**
+     * @brief Get the output tensor with the specified name.
+     *
+     * @param name The name of the output tensor
+     * @return The output tensor with the specified name, or nullptr if there
+     * is none
+     */
+    auto getOutput(const std::string& name) const -> std::shared_ptr<Tensor>;
+
     /**
      * @brief Get the inputs of the model.
      *
@@ -164,6 +220,172 @@ class EDGERUNNER_EXPORT Model {
      */
     virtual auto applyDelegate(const DELEGATE& delegate) -> STATUS = 0;
 
+    /**
+     * @brief Keep the model prepared for several delegates.
+     *
+     * Afterwards, applyDelegate() switches to a prepared delegate without
+     * rebuilding the model, and tensors obtained before the switch remain
+     * valid and share their memory with the tensors of the new delegate.
+     * Each prepared delegate holds its own scratch memory.
+     *
+     * @param delegates The delegates to prepare besides the current delegate
+     * @return The status of the operation, FAIL if the backend does not
+     * support prepared delegates
+     */
+    virtual auto prepareDelegates(const std::vector<DELEGATE>& delegates)
+        -> STATUS {
+        static_cast<void>(delegates);
+        return STATUS::FAIL;
+    }
+
+    /**
+     * @brief Select the precision of model execution, overriding the
+     * precision detected from the model inputs.
+     *
+     * FLOAT32 executes float operations in full precision, FLOAT16 relaxes
+     * them to fp16 where the delegate supports it, and INT8 or UINT8 select
+     * quantized kernels, which require a quantized model. The delegate is
+     * applied again, reallocating the input and output tensors.
+     *
+     * @param precision The precision, FLOAT32, FLOAT16, INT8 or UINT8
+     * @return The status of the operation, FAIL if the backend or the current
+     * delegate does not support the precision
+     */
+    virtual auto applyPrecision(const TensorType& precision) -> STATUS {
+        static_cast<void>(precision);
+        return STATUS::FAIL;
+    }
+
+    /**
+     * @brief Set the number of CPU threads used for model execution.
+     *
+     * @param numThreads The number of threads, 0 for the backend default
+     * @return The status of the operation, FAIL if the backend does not
+     * support setting a thread count
+     */
+    virtual auto setNumThreads(size_t numThreads) -> STATUS {
+        static_cast<void>(numThreads);
+        return STATUS::FAIL;
+    }
+
+    /**
+     * @brief Get the number of CPU threads used for model execution.
+     *
+     * @return The number of threads, 0 for the backend default
+     */
+    virtual auto getNumThreads() const -> size_t { return 0; }
+
+    /**
+     * @brief Change the dimensions of an input tensor.
+     *
+     * Typically used to change the batch dimension of models with a dynamic
+     * batch size. Input and output tensors are reallocated, such that
+     * previously obtained tensors and their contents are invalidated.
+     *
+     * @param index The index of the input tensor
+     * @param dimensions The new dimensions of the input tensor
+     * @return The status of the operation, FAIL if the backend or model does
+     * not support resizing the input
+     */
+    virtual auto resizeInput(size_t index,
+                             const std::vector<size_t>& dimensions) -> STATUS {
+        static_cast<void>(index);
+        static_cast<void>(dimensions);
+        return STATUS::FAIL;
+    }
+
+    /**
+     * @brief Use caller-owned memory as the data of an input tensor.
+     *
+     * Avoids copying inputs that are produced in memory the model cannot
+     * allocate itself, such as shared memory. The memory must stay valid
+     * while the model is alive or until the input is bound again. Input and
+     * output tensors are reallocated, except when rebinding a bound tensor on
+     * backends that only update its data pointer.
+     *
+     * @param index The index of the input tensor
+     * @param data The memory to bind, aligned to AlignedBuffer::DefaultAlignment
+     * @param numBytes The size of the memory, at least the size of the tensor
+     * @return The status of the operation, FAIL if the backend does not
+     * support binding memory
+     */
+    virtual auto bindInput(size_t index, void* data, size_t numBytes)
+        -> STATUS {
+        static_cast<void>(index);
+        static_cast<void>(data);
+        static_cast<void>(numBytes);
+        return STATUS::FAIL;
+    }
+
+    /**
+     * @brief Use caller-owned memory as the data of an output tensor.
+     *
+     * See bindInput().
+     *
+     * @param index The index of the output tensor
+     * @param data The memory to bind, aligned to AlignedBuffer::DefaultAlignment
+     * @param numBytes The size of the memory, at least the size of the tensor
+     * @return The status of the operation, FAIL if the backend does not
+     * support binding memory
+     */
+    virtual auto bindOutput(size_t index, void* data, size_t numBytes)
+        -> STATUS {
+        static_cast<void>(index);
+        static_cast<void>(data);
+        static_cast<void>(numBytes);
+        return STATUS::FAIL;
+    }
+
+    /**
+     * @brief Declare an input and output pair carrying the state of a
+     * stateful model, such as a streaming RNN.
+     *
+     * After each successful execute(), the state output becomes the state
+     * input of the next execution without a copy: the two tensors swap their
+     * memory. Tensors obtained before remain valid, but their data moves
+     * between the two buffers, so access the data again after each
+     * execution. State starts zeroed, see resetState(). Asynchronous
+     * executions do not carry state.
+     *
+     * @param inputIndex The index of the state input tensor
+     * @param outputIndex The index of the state output tensor, of the same
+     * type and size as the input
+     * @return The status of the operation, FAIL if the backend does not
+     * support state or the tensors do not match
+     */
+    virtual auto addState(size_t inputIndex, size_t outputIndex) -> STATUS {
+        static_cast<void>(inputIndex);
+        static_cast<void>(outputIndex);
+        return STATUS::FAIL;
+    }
+
+    /**
+     * @brief Zero the state of the model, to start a new stream.
+     *
+     * Resets the tensors declared with addState(), and state the backend
+     * keeps internally, such as TFLite variable tensors.
+     *
+     * @return The status of the operation, FAIL if the backend does not
+     * support state
+     */
+    virtual auto resetState() -> STATUS { return STATUS::FAIL; }
+
+    /**
+     * @brief Select the fastest delegate and thread count for this machine.
+     *
+     * Benchmarks every available delegate, and on CPU a few thread counts,
+     * using the current contents of the inputs as representative input. The
+     * fastest configuration whose outputs are within tolerance of the CPU
+     * outputs is applied and persisted, keyed by model hash and machine
+     * fingerprint. Later calls apply a cached decision without benchmarking.
+     *
+     * Input and output tensors are reallocated; input contents are kept.
+     *
+     * @param options Options used to configure autotuning
+     * @return The status of the operation
+     */
+    auto autotune(const AutotuneOptions& options = {}) -> STATUS;
+
     /**
      * @brief Execute the model.
      *
@@ -171,6 +393,94 @@ class EDGERUNNER_EXPORT Model {
      */
     virtual auto execute() -> STATUS = 0;
 
+    /**
+     * @brief Execute the model asynchronously.
+     *
+     * The current inputs are captured at submission, such that inputs may be
+     * refilled for the next execution as soon as this returns. Submission
+     * blocks while asyncQueueDepth executions are in flight. Backends without
+     * asynchronous execution execute synchronously and return a ready future.
+     *
+     * @return A future holding the status and outputs of the execution
+     */
+    virtual auto executeAsync() -> std::future<AsyncResult> {
+        std::promise<AsyncResult> promise;
+        const auto status = execute();
+        promise.set_value({status, copyTensors(getOutputs())});
+        return promise.get_future();
+    }
+
+    /**
+     * @brief Execute the model, cancelling the execution once the timeout
+     * elapses.
+     *
+     * A cancelled execution returns FAIL and leaves the outputs undefined. The
+     * model remains usable, and state tensors are not advanced. Backends
+     * without cancellation return FAIL without executing.
+     *
+     * @param timeout The maximum duration of the execution
+     * @return The status of the operation
+     */
+    virtual auto execute(std::chrono::microseconds timeout) -> STATUS {
+        static_cast<void>(timeout);
+        return STATUS::FAIL;
+    }
+
+    /**
+     * @brief Cancel the execution in progress.
+     *
+     * May be called from any thread, e.g. once the client of a request has
+     * gone. The execution returns FAIL at its next cancellation point, as for
+     * execute(std::chrono::microseconds). Executions started after this
+     * returns are not affected.
+     *
+     * @return The status of the operation, FAIL if the backend does not
+     * support cancellation
+     */
+    virtual auto cancel() -> STATUS { return STATUS::FAIL; }
+
+    /**
+     * @brief Select a graph and execute it.
+     *
+     * Equivalent to selectGraph() followed by execute(). The graph remains
+     * selected afterwards.
+     *
+     * @param graphName The name of the graph to execute
+     * @return The status of the operation
+     */
+    auto execute(const std::string& graphName) -> STATUS {
+        if (selectGraph(graphName) != STATUS::SUCCESS) {
+            return STATUS::FAIL;
+        }
+
+        return execute();
+    }
+
+    /**
+     * @brief Get the names of the graphs contained in the model.
+     *
+     * Backends without named graphs return an empty list.
+     *
+     * @return The names of the graphs
+     */
+    virtual auto getGraphNames() const -> std::vector<std::string> {
+        return {};
+    }
+
+    /**
+     * @brief Select the graph used by execute(), getInputs() and getOutputs().
+     *
+     * Each graph has its own input and output tensors, which are preserved
+     * when switching between graphs.
+     *
+     * @param graphName The name of the graph to select
+     * @return The status of the operation, FAIL if no graph has that name
+     */
+    virtual auto selectGraph(const std::string& graphName) -> STATUS {
+        static_cast<void>(graphName);
+        return STATUS::FAIL;
+    }
+
     /**
      * @brief Get the name of the model.
      *
@@ -178,6 +488,35 @@ class EDGERUNNER_EXPORT Model {
      */
     auto name() const -> const std::string& { return m_name; }
 
+    /**
+     * @brief Get the hash of the model contents.
+     *
+     * The hash is computed on first use, such that models which never use it
+     * do not read the whole model at load, see hashModel().
+     *
+     * @return The hash of the model, 0 if unknown
+     */
+    auto getModelHash() const -> uint64_t {
+        std::call_once(m_modelHashOnce, [this]() {
+            if (m_modelHash == 0) {
+                m_modelHash = hashModel();
+            }
+        });
+
+        return m_modelHash;
+    }
+
+    /**
+     * @brief Get the bundle the model was created from.
+     *
+     * Gives access to the labels and metadata deployed with the model.
+     *
+     * @return The bundle, nullptr if not created from a bundle
+     */
+    auto getBundle() const -> const std::shared_ptr<Bundle>& {
+        return m_bundle;
+    }
+
     /**
      * @brief Get the status of model creation.
      *
@@ -190,10 +529,68 @@ class EDGERUNNER_EXPORT Model {
     /**
      * @brief Get the precision used for model execution.
      *
+     * Detected from the model inputs unless selected through
+     * ModelOptions::precision or applyPrecision().
+     *
      * @return The pricsion used model execution
      */
     auto getPrecision() const -> TensorType { return m_precision; }
 
+    /**
+     * @brief Enable profiling of model execution.
+     *
+     * Profiling initialization, finalization and deserialization requires the
+     * profiling level to be set at creation time through ModelOptions.
+     * Enabling profiling after creation captures subsequent executions only.
+     *
+     * @param level The profiling level to enable, OFF disables profiling
+     * @return The status of the operation
+     */
+    virtual auto enableProfiling(const PROFILING_LEVEL& level) -> STATUS {
+        return level == PROFILING_LEVEL::OFF ? STATUS::SUCCESS : STATUS::FAIL;
+    }
+
+    /**
+     * @brief Get the profiling events collected since the last call.
+     *
+     * Collected events are cleared from the model once returned.
+     *
+     * @return The collected profiling events
+     */
+    virtual auto getProfilingEvents() -> std::vector<ProfilingEvent> {
+        return {};
+    }
+
+    /**
+     * @brief Get the profiling level currently enabled.
+     *
+     * @return The profiling level used for model execution
+     */
+    auto getProfilingLevel() const -> PROFILING_LEVEL {
+        return m_profilingLevel;
+    }
+
+    /**
+     * @brief Get the latency histograms and counters of the model.
+     *
+     * Metrics are always collected and may be read concurrently with model
+     * execution. Use ModelMetrics::snapshot() to read and
+     * ModelMetrics::reset() to clear them.
+     *
+     * @return Reference to the model metrics
+     */
+    auto getMetrics() -> ModelMetrics& { return m_metrics; }
+
+    /**
+     * @brief Get the memory footprint of the model.
+     *
+     * Reported sizes reflect the current state of the model, and change when
+     * delegates are applied or tensors are reallocated.
+     *
+     * @return The memory footprint of the model
+     */
+    virtual auto getMemoryStats() -> MemoryStats { return {}; }
+
   protected:
     /**
      * @brief Set the delegate for model execution.
@@ -215,6 +612,38 @@ class EDGERUNNER_EXPORT Model {
      */
     void setPrecision(const TensorType& precision) { m_precision = precision; }
 
+    /**
+     * @brief Set the profiling level for model execution.
+     *
+     * This method is used by derivatives to allow users to query the enabled
+     * profiling level
+     *
+     * @param level The profiling level to set
+     */
+    void setProfilingLevel(const PROFILING_LEVEL& level) {
+        m_profilingLevel = level;
+    }
+
+    /**
+     * @brief Hash the model contents, called once by getModelHash().
+     *
+     * Derivatives implement this with hashBytes() or hashFile() over model
+     * contents which remain accessible after loading.
+     *
+     * @return The hash of the model, 0 if unknown
+     */
+    virtual auto hashModel() const -> uint64_t { return 0; }
+
+    /**
+     * @brief Set the hash of the model contents.
+     *
+     * This method is used by derivatives when loading a model from contents
+     * which are not accessible afterwards, see hashBytes()
+     *
+     * @param modelHash The hash to set
+     */
+    void setModelHash(const uint64_t modelHash) { m_modelHash = modelHash; }
+
     /**
      * @brief Set the status of model creation.
      *
@@ -233,6 +662,9 @@ class EDGERUNNER_EXPORT Model {
     EDGERUNNER_SUPPRESS_C4251
     std::string m_name; /**< Name of the model */
 
+    EDGERUNNER_SUPPRESS_C4251
+    std::shared_ptr<Bundle> m_bundle; /**< Bundle backing the model, if any */
+
     EDGERUNNER_SUPPRESS_C4251
     std::vector<std::shared_ptr<Tensor>>
         m_inputs; /**< Input tensors of the model */
@@ -249,8 +681,20 @@ class EDGERUNNER_EXPORT Model {
     TensorType m_precision =
         TensorType::FLOAT16; /**< Precision used for model execution */
 
+    EDGERUNNER_SUPPRESS_C4251
+    PROFILING_LEVEL m_profilingLevel =
+        PROFILING_LEVEL::OFF; /**< Profiling level used for model execution */
+
     EDGERUNNER_SUPPRESS_C4251
     STATUS m_creationStatus = STATUS::SUCCESS; /**< Status of model creation */
+
+    mutable uint64_t m_modelHash {}; /**< Hash of the model contents */
+
+    EDGERUNNER_SUPPRESS_C4251
+    mutable std::once_flag m_modelHashOnce; /**< Computes m_modelHash once */
+
+    EDGERUNNER_SUPPRESS_C4251
+    ModelMetrics m_metrics; /**< Latency histograms and counters */
 };
 
 inline auto Model::getInput(size_t index) const -> std::shared_ptr<Tensor> {
@@ -269,4 +713,26 @@ inline auto Model::getOutput(size_t index) const -> std::shared_ptr<Tensor> {
     return nullptr;
 }
 
+inline auto Model::getInput(const std::string& name) const
+    -> std::shared_ptr<Tensor> {
+    for (const auto& input : m_inputs) {
+        if (input->getName() == name) {
+            return input;
+        }
+    }
+
+    return nullptr;
+}
+
+inline auto Model::getOutput(const std::string& name) const
+    -> std::shared_ptr<Tensor> {
+    for (const auto& output : m_outputs) {
+        if (output->getName() == name) {
+            return output;
+        }
+    }
+
+    return nullptr;
+}
+
 }  // namespace edge
@@ -0,0 +1,97 @@
+/**
+ * @file options.hpp
+ * @brief Definition of the ModelOptions struct, used to configure model
+ * creation
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+
+#include "arenaGroup.hpp"
+#include "profiling.hpp"
+#include "tensor.hpp"
+
+namespace edge {
+
+/**
+ * @brief Tuning options of the QNN HTP backend
+ *
+ * Unset options keep the backend defaults. Graph options apply to models
+ * composed from a shared library, context binaries keep the options they
+ * were prepared with.
+ */
+struct HtpOptions {
+    /** Graph optimization level, 3 if unset */
+    std::optional<float> optimizationLevel;
+
+    /**
+     * Graph precision, FLOAT16 enables fp16 execution of float graphs. Detected
+     * from the graph inputs if unset, ModelOptions::precision takes precedence
+     */
+    std::optional<TensorType> precision;
+
+    /** Size of the VTCM reserved for the graph, in MB */
+    std::optional<uint32_t> vtcmSizeMb;
+
+    /** Number of HVX threads used by the graph */
+    std::optional<uint32_t> hvxThreads;
+
+    /** Share weights between graphs of the same context */
+    bool weightSharing = false;
+
+    /**
+     * Size of the spill-fill buffer shared between contexts, in bytes.
+     * Registers the context in a multi-context group when set
+     */
+    std::optional<uint64_t> spillFillBufferSize;
+};
+
+/**
+ * @brief Options used to configure a Model at creation time
+ *
+ * All options have sane defaults, such that a default constructed ModelOptions
+ * behaves identically to creating a model without options.
+ */
+struct ModelOptions {
+    /**
+     * Profiling level to enable before the model is loaded. Required to
+     * capture initialization, finalization and deserialization events.
+     */
+    PROFILING_LEVEL profilingLevel = PROFILING_LEVEL::OFF;
+
+    /**
+     * Group sharing scratch memory with other models executed sequentially.
+     * Only used by the TFLite backend, ignored by other backends.
+     */
+    std::shared_ptr<ArenaGroup> arenaGroup;
+
+    /**
+     * Maximum number of asynchronous executions in flight. Each in-flight
+     * execution uses its own set of input and output tensors.
+     */
+    size_t asyncQueueDepth = 2;
+
+    /**
+     * Execution precision, see Model::applyPrecision(). Detected from the
+     * model inputs if unset, which only affects NPU delegates.
+     */
+    std::optional<TensorType> precision;
+
+    /** Tuning options of the QNN HTP backend, ignored by other backends */
+    HtpOptions htp;
+
+    /**
+     * Socket of an edgerunner daemon, see remote::Server. When set, the model
+     * is loaded and executed by the daemon, and its tensors are shared with
+     * the daemon through shared memory. Model paths are resolved by the
+     * daemon. Requires building with the daemon enabled.
+     */
+    std::filesystem::path remoteSocketPath;
+};
+
+}  // namespace edge
@@ -0,0 +1,58 @@
+/**
+ * @file profiling.hpp
+ * @brief Definition of the profiling types shared by all model
+ * implementations
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace edge {
+
+/**
+ * @enum PROFILING_LEVEL
+ * @brief Enum class representing the amount of profiling data to collect.
+ */
+enum class PROFILING_LEVEL : uint8_t {
+    OFF, /**< No profiling data is collected */
+    BASIC, /**< Per-phase timings (init, finalize, execute) */
+    DETAILED /**< Per-phase timings and per-node execution events */
+};
+
+/**
+ * @enum PROFILING_EVENT
+ * @brief Enum class representing the phase a profiling event belongs to.
+ */
+enum class PROFILING_EVENT : uint8_t {
+    INIT, /**< Model or graph initialization */
+    FINALIZE, /**< Graph finalization (compilation) */
+    DESERIALIZE, /**< Deserialization of a cached context binary */
+    EXECUTE, /**< Graph execution */
+    NODE, /**< Execution of a single node of the graph */
+    OTHER /**< Any other backend specific event */
+};
+
+/**
+ * @enum PROFILING_UNIT
+ * @brief Enum class representing the unit of a profiling event value.
+ */
+enum class PROFILING_UNIT : uint8_t {
+    MICROSECONDS, /**< Elapsed time in microseconds */
+    CYCLES, /**< Elapsed processor cycles */
+    BYTES, /**< Memory usage in bytes */
+    COUNT /**< Generic counter */
+};
+
+/**
+ * @brief A single profiling event reported by a model
+ */
+struct ProfilingEvent {
+    std::string name; /**< Backend provided name of the event */
+    PROFILING_EVENT type; /**< Phase the event belongs to */
+    uint64_t value; /**< Measured value of the event */
+    PROFILING_UNIT unit; /**< Unit of the measured value */
+};
+
+}  // namespace edge
@@ -4,8 +4,8 @@
  *
  * This class represents a backend for handling interfacing with QNN backend
  * libraries. It provides functionality for loading the backend, creating a
- * device, and initializing the backend
- * The Backend class is currently restricted to NPU inference support.
+ * device, and initializing the backend. Backends are shared between models
+ * through the BackendRegistry.
  */
 
 #pragma once
@@ -117,7 +117,6 @@ class Backend {
     auto validateBackendId(uint32_t backendId) const -> STATUS;
 
     void* m_backendLibHandle {};
-    void* m_systemLibHandle {};
 
     Qnn_BackendHandle_t m_backendHandle {};
     QnnBackend_Config_t** m_backendConfig {};
@@ -145,4 +144,53 @@ class Backend {
     STATUS m_creationStatus = STATUS::SUCCESS;
 };
 
+/**
+ * @class SystemLibrary
+ * @brief Class for handling the QNN system library.
+ *
+ * The system library is used to query the graphs of context binaries. It is
+ * shared between graphs through the BackendRegistry.
+ */
+class SystemLibrary {
+  public:
+    /**
+     * @brief Constructor for the SystemLibrary class, loads libQnnSystem.so.
+     */
+    SystemLibrary();
+
+    SystemLibrary(const SystemLibrary&) = delete;
+    SystemLibrary(SystemLibrary&&) = delete;
+    auto operator=(const SystemLibrary&) -> SystemLibrary& = delete;
+    auto operator=(SystemLibrary&&) -> SystemLibrary& = delete;
+
+    /**
+     * @brief Destructor for the SystemLibrary class, unloads the library.
+     */
+    ~SystemLibrary();
+
+    /**
+     * @brief Get the status of system library loading
+     * @return The status of system library loading
+     */
+    auto getCreationStatus() const -> STATUS { return m_creationStatus; }
+
+    /**
+     * @brief Get the QNN system interface.
+     * @return Reference to the QNN system interface.
+     */
+    auto getInterface() const -> const QNN_SYSTEM_INTERFACE_VER_TYPE& {
+        return m_qnnSystemInterface;
+    }
+
+  private:
+    auto loadSystemLibrary() -> STATUS;
+
+    void* m_systemLibHandle {};
+
+    QNN_SYSTEM_INTERFACE_VER_TYPE m_qnnSystemInterface =
+        QNN_SYSTEM_INTERFACE_VER_TYPE_INIT;
+
+    STATUS m_creationStatus = STATUS::SUCCESS;
+};
+
 }  // namespace edge::qnn
@@ -0,0 +1,69 @@
+/**
+ * @file backendRegistry.hpp
+ * @brief Definition of the BackendRegistry class, which shares QNN backends
+ * and the QNN system library between models.
+ */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "backend.hpp"
+#include "edgerunner/model.hpp"
+
+namespace edge::qnn {
+
+/**
+ * @class BackendRegistry
+ * @brief Process wide registry of loaded QNN backends.
+ *
+ * Each backend library is loaded on first use and shared by all models using
+ * the same delegate. Backends are reference counted: a backend is unloaded
+ * once the last model using it is destroyed, and loaded again on next use.
+ * The QNN system library is shared in the same way. Acquiring backends is
+ * safe from any number of threads, concurrent requests for a backend that is
+ * not yet loaded wait for a single load.
+ */
+class BackendRegistry {
+  public:
+    BackendRegistry(const BackendRegistry&) = delete;
+    BackendRegistry(BackendRegistry&&) = delete;
+    auto operator=(const BackendRegistry&) -> BackendRegistry& = delete;
+    auto operator=(BackendRegistry&&) -> BackendRegistry& = delete;
+
+    ~BackendRegistry() = default;
+
+    /**
+     * @brief Get the process wide registry
+     * @return Reference to the registry
+     */
+    static auto get() -> BackendRegistry&;
+
+    /**
+     * @brief Get the backend of a delegate, loading it if needed
+     *
+     * @param delegate The delegate of the backend (CPU, GPU, NPU)
+     * @return The shared backend, nullptr if the backend failed to load
+     */
+    auto acquire(DELEGATE delegate) -> std::shared_ptr<Backend>;
+
+    /**
+     * @brief Get the QNN system library, loading it if needed
+     *
+     * @return The shared system library, nullptr if it failed to load
+     */
+    auto acquireSystemLibrary() -> std::shared_ptr<SystemLibrary>;
+
+  private:
+    BackendRegistry() = default;
+
+    std::mutex m_mutex;
+
+    std::unordered_map<DELEGATE, std::weak_ptr<Backend>> m_backends;
+
+    std::weak_ptr<SystemLibrary> m_systemLibrary;
+};
+
+}  // namespace edge::qnn
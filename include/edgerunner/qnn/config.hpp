@@ -1,5 +1,6 @@
 #pragma once
 
+#include <deque>
 #include <vector>
 
 namespace edge::qnn {
@@ -48,7 +49,8 @@ class Config {
      *
      * Creates a new custom configuration using the default custom configuration
      * and adds it to the list of custom configurations. The returned custom
-     * configuration needs to be assigned to a corresponding configuration.
+     * configuration needs to be assigned to a corresponding configuration, and
+     * remains valid when further custom configurations are created.
      *
      * @return A reference to the newly created custom configuration
      */
@@ -79,7 +81,7 @@ class Config {
     CustomConfigType
         m_defaultCustomConfig; /**< The default custom configuration */
     std::vector<ConfigType> m_configs; /**< List of configurations */
-    std::vector<CustomConfigType>
+    std::deque<CustomConfigType>
         m_customConfigs; /**< List of custom configurations */
     std::vector<const ConfigType*>
         m_configPtrs; /**< List of pointers to configurations */
@@ -5,11 +5,18 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include <QnnCommon.h>
 #include <QnnGraph.h>
 #include <QnnInterface.h>
+#include <QnnProfile.h>
 #include <QnnTypes.h>
 #include <System/QnnSystemContext.h>
 #include <System/QnnSystemInterface.h>
@@ -17,6 +24,9 @@
 #include <nonstd/span.hpp>
 
 #include "edgerunner/model.hpp"
+#include "edgerunner/options.hpp"
+#include "edgerunner/profiling.hpp"
+#include "edgerunner/qnn/backend.hpp"
 
 namespace edge::qnn {
 
@@ -109,6 +119,49 @@ class Graph {
         return {m_graphInfo->outputTensors, m_graphInfo->numOutputTensors};
     }
 
+    /**
+     * @brief Get the input tensors of a graph.
+     * @param graphIndex The index of the graph.
+     * @return A span of input tensors, empty if the index is out of range.
+     */
+    auto getInputs(size_t graphIndex) -> nonstd::span<Qnn_Tensor_t>;
+
+    /**
+     * @brief Get the output tensors of a graph.
+     * @param graphIndex The index of the graph.
+     * @return A span of output tensors, empty if the index is out of range.
+     */
+    auto getOutputs(size_t graphIndex) -> nonstd::span<Qnn_Tensor_t>;
+
+    /**
+     * @brief Get the number of graphs in the context.
+     * @return The number of graphs.
+     */
+    auto getGraphCount() const -> size_t { return m_graphsCount; }
+
+    /**
+     * @brief Get the names of the graphs in the context.
+     * @return The graph names, ordered by graph index.
+     */
+    auto getGraphNames() const -> std::vector<std::string>;
+
+    /**
+     * @brief Get the index of the current graph.
+     * @return The index of the current graph.
+     */
+    auto getGraphIndex() const -> size_t { return m_graphIndex; }
+
+    /**
+     * @brief Select the graph used by subsequent calls.
+     *
+     * All graphs of the context are retrieved at load time, switching between
+     * them does not reload the context.
+     *
+     * @param graphName The name of the graph to select.
+     * @return The status of the operation, FAIL if no graph has that name.
+     */
+    auto setGraph(const std::string& graphName) -> STATUS;
+
     /**
      * Loads a model from a shared library located at the specified path.
      *
@@ -127,11 +180,13 @@ class Graph {
      * @param qnnInterface The handle of the QNN interface.
      * @param backendHandle The handle to the QNN backend.
      * @param deviceHandle The handle to the QNN device.
+     * @param htpOptions The HTP context options.
      * @return STATUS The status of the operation (SUCCESS or ERROR).
      */
     auto createContext(QNN_INTERFACE_VER_TYPE& qnnInterface,
                        Qnn_BackendHandle_t& backendHandle,
-                       Qnn_DeviceHandle_t& deviceHandle) -> STATUS;
+                       Qnn_DeviceHandle_t& deviceHandle,
+                       const HtpOptions& htpOptions = {}) -> STATUS;
 
     /**
      * Composes graphs using the specified QNN backend handle.
@@ -142,22 +197,26 @@ class Graph {
     auto composeGraphs(Qnn_BackendHandle_t& qnnBackendHandle) -> STATUS;
 
     /**
-     * @brief Sets the configuration for the composed graphs.
+     * @brief Sets the configuration for all composed graphs.
      * @param delegate The delegate for the operation.
      * @param precision The precision of the operation.
+     * @param htpOptions The HTP graph options, used with the NPU delegate.
      * @return The status of the operation.
      */
-    auto setGraphConfig(DELEGATE delegate, TensorType precision) -> STATUS;
+    auto setGraphConfig(DELEGATE delegate,
+                        TensorType precision,
+                        const HtpOptions& htpOptions = {}) -> STATUS;
 
     /**
-     * @brief Finalizes the composed graphs.
+     * @brief Finalizes all composed graphs.
      * @return The status of the operation.
      */
     auto finalizeGraphs() -> STATUS;
 
     /**
      * Loads the system library required for loading a cached context from a
-     * binary buffer
+     * binary buffer. The library is shared between graphs through the
+     * BackendRegistry.
      *
      * @return STATUS indicating the success or failure of loading the system
      * library.
@@ -173,14 +232,15 @@ class Graph {
      * @param backendHandle The handle to the QNN backend.
      * @param deviceHandle The handle to the QNN device.
      * @param modelBuffer The binary model buffer containing the model data.
+     * @param htpOptions The HTP context options.
      * @return STATUS indicating the success or failure of loading the context
      * from the binary model buffer.
      */
     auto loadContextFromBinary(QNN_INTERFACE_VER_TYPE& qnnInterface,
                                Qnn_BackendHandle_t& backendHandle,
                                Qnn_DeviceHandle_t& deviceHandle,
-                               const nonstd::span<uint8_t>& modelBuffer)
-        -> STATUS;
+                               const nonstd::span<uint8_t>& modelBuffer,
+                               const HtpOptions& htpOptions = {}) -> STATUS;
 
     /**
      * @brief Saves the current context to a binary file.
@@ -206,13 +266,85 @@ class Graph {
      * This function executes the graph and returns a status code indicating the
      * success or failure of the operation.
      *
+     * @param signal Signal aborting the execution when triggered or timed out,
+     * if any.
      * @return STATUS - A status code indicating the success or failure of the
      * operation.
      */
-    auto execute() -> STATUS;
+    auto execute(Qnn_SignalHandle_t signal = nullptr) -> STATUS;
+
+    /**
+     * @brief Executes a graph asynchronously on the given tensors.
+     *
+     * Falls back to synchronous execution when the backend does not provide
+     * graphExecuteAsync. Asynchronous executions are not profiled.
+     *
+     * @param graphIndex The index of the graph to execute.
+     * @param inputs The input tensors, must remain valid until completion.
+     * @param outputs The output tensors, must remain valid until completion.
+     * @param onComplete Called with the execution status on completion, from
+     * a backend thread. Not called if submission fails.
+     * @return The status of the submission.
+     */
+    auto executeAsync(size_t graphIndex,
+                      nonstd::span<Qnn_Tensor_t> inputs,
+                      nonstd::span<Qnn_Tensor_t> outputs,
+                      std::function<void(STATUS)> onComplete) -> STATUS;
+
+    /**
+     * @brief Sets the maximum number of asynchronous executions queued by
+     * the backend for all graphs.
+     *
+     * @param queueDepth The maximum number of queued executions.
+     * @return The status of the operation.
+     */
+    auto setAsyncQueueDepth(uint32_t queueDepth) -> STATUS;
+
+    /**
+     * @brief Blocks until all asynchronous executions have completed.
+     */
+    void waitForAsync();
+
+    /**
+     * @brief Creates a profile handle used by subsequent QNN API calls.
+     *
+     * Any existing profile handle is freed. Profiling initialization and
+     * deserialization requires the profile handle to be created before the
+     * context is created.
+     *
+     * Graph keeps a reference to the qnnInterface
+     *
+     * @param qnnInterface The handle of the QNN interface.
+     * @param backendHandle The handle to the QNN backend.
+     * @param level The profiling level, OFF frees the profile handle.
+     * @return The status of the operation.
+     */
+    auto createProfile(QNN_INTERFACE_VER_TYPE& qnnInterface,
+                       Qnn_BackendHandle_t& backendHandle,
+                       PROFILING_LEVEL level) -> STATUS;
+
+    /**
+     * @brief Get the profiling events collected since the last call.
+     *
+     * Collected events are cleared once returned.
+     *
+     * @return The collected profiling events.
+     */
+    auto getProfilingEvents() -> std::vector<ProfilingEvent>;
 
   private:
-    auto setGraph() { m_graphInfo = m_graphsInfo[0] /* NOLINT */; }
+    void setGraph(size_t graphIndex = 0) {
+        m_graphIndex = graphIndex;
+        m_graphInfo = m_graphsInfo[graphIndex] /* NOLINT */;
+    }
+
+    /**
+     * @brief Get the graphs of the context.
+     * @return A span of pointers to the graph infos.
+     */
+    auto getGraphsInfo() const -> nonstd::span<GraphInfoT*> {
+        return {m_graphsInfo, m_graphsCount};
+    }
 
     auto setComposeGraphsFnHandle(
         ComposeGraphsFnHandleTypeT composeGraphsFnHandle) -> STATUS;
@@ -229,10 +361,21 @@ class Graph {
     auto copyMetadataToGraphsInfo(
         const QnnSystemContext_BinaryInfo_t* binaryInfo) -> bool;
 
+    void freeProfile();
+
+    void collectProfilingEvents(PROFILING_EVENT phase);
+
+    void appendProfilingEvent(QnnProfile_EventId_t eventId,
+                              PROFILING_EVENT phase);
+
+    static void notifyAsync(void* notifyParam,
+                            Qnn_NotifyStatus_t notifyStatus);
+
     std::vector<GraphInfoT> m_graphs;
     std::vector<GraphInfoT*> m_graphPtrs;
 
     GraphInfoT* m_graphInfo {};
+    size_t m_graphIndex {};
 
     GraphInfoT** m_graphsInfo {};
     uint32_t m_graphsCount {};
@@ -242,13 +385,23 @@ class Graph {
 
     void* m_libModelHandle {};
 
-    std::vector<Qnn_Tensor_t> m_inputTensors;
-    std::vector<Qnn_Tensor_t> m_outputTensors;
+    /* per-graph tensors copied from the context binary info */
+    std::vector<std::vector<Qnn_Tensor_t>> m_inputTensors;
+    std::vector<std::vector<Qnn_Tensor_t>> m_outputTensors;
 
     Qnn_ContextHandle_t m_context {};
 
+    Qnn_ProfileHandle_t m_profile {};
+    std::vector<ProfilingEvent> m_profilingEvents;
+
+    std::mutex m_asyncMutex;
+    std::condition_variable m_asyncCondition;
+    size_t m_asyncInFlight {};
+
     QNN_INTERFACE_VER_TYPE m_qnnInterface {};
 
+    std::shared_ptr<SystemLibrary> m_systemLibrary;
+
     QNN_SYSTEM_INTERFACE_VER_TYPE m_qnnSystemInterface =
         QNN_SYSTEM_INTERFACE_VER_TYPE_INIT;
 };
@@ -6,12 +6,26 @@
 
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
 #include <QnnInterface.h>
 #include <System/QnnSystemInterface.h>
 #include <dlfcn.h>
 
 #include "backend.hpp"
+#include "backendRegistry.hpp"
+#include "edgerunner/alignedBuffer.hpp"
 #include "edgerunner/model.hpp"
+#include "edgerunner/options.hpp"
 #include "graph.hpp"
 
 namespace edge::qnn {
@@ -25,21 +39,39 @@ class ModelImpl final : public Model {
     /**
      * @brief Constructor for ModelImpl.
      * @param modelPath The path to the QNN model file.
+     * @param options Options used to configure the model.
      */
-    explicit ModelImpl(const std::filesystem::path& modelPath);
+    explicit ModelImpl(const std::filesystem::path& modelPath,
+                       const ModelOptions& options = {});
 
     /**
      * @brief Constructor for ModelImpl.
-     * @param modelPath The path to the QNN model file.
+     * @param modelBuffer The buffer containing the QNN model.
+     * @param options Options used to configure the model.
+     */
+    explicit ModelImpl(const nonstd::span<uint8_t>& modelBuffer,
+                       const ModelOptions& options = {});
+
+    /**
+     * @brief Constructor for ModelImpl.
+     *
+     * The context is created from the QNN context binary compiled for the NPU.
+     *
+     * @param bundle The bundle holding the model.
+     * @param options Options used to configure the model.
      */
-    explicit ModelImpl(const nonstd::span<uint8_t>& modelBuffer);
+    explicit ModelImpl(const std::shared_ptr<Bundle>& bundle,
+                       const ModelOptions& options = {});
 
     ModelImpl(const ModelImpl&) = delete;
     ModelImpl(ModelImpl&&) = delete;
     auto operator=(const ModelImpl&) -> ModelImpl& = delete;
     auto operator=(ModelImpl&&) -> ModelImpl& = delete;
 
-    ~ModelImpl() final = default;
+    /**
+     * @brief Destructor for ModelImpl, waits for asynchronous executions.
+     */
+    ~ModelImpl() final;
 
     /**
      * @brief Loads the QNN model from the specified path.
@@ -67,18 +99,249 @@ class ModelImpl final : public Model {
 
     /**
      * @brief Applies a delegate to the QNN backend.
+     *
+     * Models loaded from a shared library are composed again on the backend
+     * of the delegate, and their input and output tensors are reallocated.
+     * Context binaries are bound to the backend they were prepared for and
+     * only accept the NPU delegate.
+     *
      * @param delegate The delegate to apply.
      * @return The status of the operation.
      */
     auto applyDelegate(const DELEGATE& delegate) -> STATUS final;
 
+    /**
+     * @brief Selects the HTP graph precision.
+     *
+     * Models loaded from a shared library are composed again with the
+     * precision config of the graph, and their input and output tensors are
+     * reallocated. FLOAT16 executes float graphs in fp16, INT8 or UINT8 keep
+     * the quantized default. The NPU does not support FLOAT32. Context
+     * binaries keep the precision they were prepared with.
+     *
+     * @param precision The precision, FLOAT32, FLOAT16, INT8 or UINT8.
+     * @return The status of the operation.
+     */
+    auto applyPrecision(const TensorType& precision) -> STATUS final;
+
+    /**
+     * @brief Declares an input and output pair of the current graph carrying
+     * model state.
+     *
+     * The client buffers of the two tensors are swapped after each execution
+     * of the graph, such that state stays in place in the I/O arena.
+     *
+     * @param inputIndex The index of the state input tensor.
+     * @param outputIndex The index of the state output tensor.
+     * @return The status of the operation.
+     */
+    auto addState(size_t inputIndex, size_t outputIndex) -> STATUS final;
+
+    /**
+     * @brief Zeroes the declared state of all graphs.
+     * @return The status of the operation.
+     */
+    auto resetState() -> STATUS final;
+
+    using Model::execute;
+
     /**
      * @brief Executes the QNN model.
      * @return The status of the operation.
      */
     auto execute() -> STATUS final;
 
+    /**
+     * @brief Executes the QNN model, aborting the execution once the timeout
+     * elapses.
+     *
+     * Uses a QnnSignal configured with the timeout, created for each call.
+     * Fails if the backend does not support signals.
+     *
+     * @param timeout The maximum duration of the execution.
+     * @return The status of the operation.
+     */
+    auto execute(std::chrono::microseconds timeout) -> STATUS final;
+
+    /**
+     * @brief Aborts the execution in progress by triggering its QnnSignal.
+     *
+     * Asynchronous executions are not cancelled.
+     *
+     * @return The status of the operation, FAIL if the backend does not
+     * support signals.
+     */
+    auto cancel() -> STATUS final;
+
+    /**
+     * @brief Executes the current graph asynchronously.
+     *
+     * Uses graphExecuteAsync with a ring of asyncQueueDepth tensor sets. The
+     * current inputs are copied into the next free set, blocking while all
+     * sets are in flight.
+     *
+     * @return A future holding the status and outputs of the execution.
+     */
+    auto executeAsync() -> std::future<AsyncResult> final;
+
+    /**
+     * @brief Enables profiling using a QNN profile handle.
+     *
+     * BASIC collects init, finalize, deserialize and execute timings.
+     * DETAILED additionally collects per-node execution events.
+     *
+     * @param level The profiling level to enable.
+     * @return The status of the operation.
+     */
+    auto enableProfiling(const PROFILING_LEVEL& level) -> STATUS final;
+
+    /**
+     * @brief Get the profiling events collected since the last call.
+     * @return The collected profiling events.
+     */
+    auto getProfilingEvents() -> std::vector<ProfilingEvent> final;
+
+    /**
+     * @brief Get the memory footprint of the model.
+     *
+     * Reports the size of the loaded model file and the arena backing the
+     * input and output tensors. Memory held by the QNN backend is not
+     * queryable and is not reported.
+     *
+     * @return The memory footprint of the model.
+     */
+    auto getMemoryStats() -> MemoryStats final;
+
+    /**
+     * @brief Get the names of the graphs contained in the QNN context.
+     * @return The graph names, ordered as in the context.
+     */
+    auto getGraphNames() const -> std::vector<std::string> final;
+
+    /**
+     * @brief Select the graph to execute.
+     *
+     * All graphs are retrieved when the context is loaded, switching graphs
+     * does not reload the context or reallocate tensors.
+     *
+     * @param graphName The name of the graph to select.
+     * @return The status of the operation.
+     */
+    auto selectGraph(const std::string& graphName) -> STATUS final;
+
   private:
+    /**
+     * @brief Initializes the backend, then loads the model and allocates its
+     * tensors.
+     *
+     * Shared by all constructors, which only differ in how the model is
+     * loaded. The bundle or model path must be set before.
+     *
+     * @param options Options used to configure the model.
+     * @param load Loads the model once the backend is initialized.
+     */
+    void initialize(const ModelOptions& options,
+                    const std::function<STATUS()>& load);
+
+    /**
+     * @brief Loads a model shared library and composes and finalizes its
+     * graphs in the selected precision.
+     *
+     * @param modelPath The path to the model shared library.
+     * @return STATUS The status of the operation (SUCCESS or FAIL).
+     */
+    auto loadSharedLibrary(const std::filesystem::path& modelPath) -> STATUS;
+
+    /**
+     * @brief Loads a context binary file, which may be compressed.
+     *
+     * @param modelPath The path to the context binary.
+     * @return STATUS The status of the operation (SUCCESS or FAIL).
+     */
+    auto loadContextBinary(const std::filesystem::path& modelPath) -> STATUS;
+
+    /**
+     * @brief Loads a context binary from a buffer.
+     *
+     * @param modelBuffer The context binary, an empty buffer fails.
+     * @return STATUS The status of the operation (SUCCESS or FAIL).
+     */
+    auto loadContextBinary(const nonstd::span<uint8_t>& modelBuffer) -> STATUS;
+
+    /**
+     * @brief Input and output tensors of a graph
+     */
+    struct GraphTensors {
+        std::vector<std::shared_ptr<Tensor>> inputs;
+        std::vector<std::shared_ptr<Tensor>> outputs;
+    };
+
+    /**
+     * @brief Expose the tensors of the current graph as model I/O
+     */
+    void setGraphTensors();
+
+    /**
+     * @brief Input and output pair of a graph carrying model state
+     */
+    struct StateTensors {
+        size_t graphIndex {};
+        size_t inputIndex {};
+        size_t outputIndex {};
+        bool swapped {};  ///< Whether the client buffers are swapped
+    };
+
+    /**
+     * @brief Swaps the client buffers of a state input and output
+     * @param state The state tensors to swap
+     */
+    void swapState(StateTensors& state);
+
+    /**
+     * @brief Executes the current graph with a signal allowing cancel()
+     * @param timeoutUs Timeout of the signal, 0 for none.
+     * @return The status of the operation.
+     */
+    auto executeSignaled(uint64_t timeoutUs) -> STATUS;
+
+    /**
+     * @brief Creates a signal on the current backend
+     * @param timeoutUs Timeout of the signal, 0 for none.
+     * @return The signal, nullptr if the backend does not support signals.
+     */
+    auto createSignal(uint64_t timeoutUs) -> Qnn_SignalHandle_t;
+
+    /**
+     * @brief Frees a signal of the current backend
+     * @param signal The signal, reset to nullptr.
+     */
+    void freeSignal(Qnn_SignalHandle_t& signal);
+
+    /**
+     * @brief Tensors and completion state of one asynchronous execution
+     */
+    struct AsyncSlot {
+        size_t graphIndex {};
+        std::vector<Qnn_Tensor_t> inputSpecs;
+        std::vector<Qnn_Tensor_t> outputSpecs;
+        AlignedBuffer buffer;
+        std::vector<std::shared_ptr<Tensor>> inputs;
+        std::vector<std::shared_ptr<Tensor>> outputs;
+        std::promise<AsyncResult> promise;
+        bool inFlight {};
+    };
+
+    /**
+     * @brief Creates the asynchronous tensor sets for the current graph
+     *
+     * Existing sets are reused if they belong to the current graph, otherwise
+     * they are recreated once idle.
+     *
+     * @param lock Lock of m_asyncMutex, held by the caller.
+     * @return STATUS The status of the operation (SUCCESS or FAIL).
+     */
+    auto createAsyncSlots(std::unique_lock<std::mutex>& lock) -> STATUS;
+
     /**
      * Loads a QNN model from a serialized binary buffer.
      *
@@ -93,15 +356,28 @@ class ModelImpl final : public Model {
     auto loadFromContextBinary(const nonstd::span<uint8_t>& modelBuffer)
         -> STATUS;
 
+    /**
+     * @brief Composes the graphs of the model file again on the backend of a
+     * delegate, replacing the current graphs only on success.
+     *
+     * @param delegate The delegate of the backend.
+     * @param precision The graph precision.
+     * @return STATUS The status of the operation (SUCCESS or FAIL).
+     */
+    auto recomposeGraphs(const DELEGATE& delegate, const TensorType& precision)
+        -> STATUS;
+
     /**
      * @brief Composes the graphs for the loaded QNN model.
      *
-     * This function composes the graphs for the loaded QNN model based on the
-     * model configuration.
+     * This function creates a context on the given backend and composes the
+     * graphs of the loaded QNN model into it.
      *
+     * @param graph The graph loaded from the model shared library.
+     * @param backend The backend to compose the graphs on.
      * @return STATUS The status of the operation (SUCCESS or FAIL).
      */
-    auto composeGraphs() -> STATUS;
+    auto composeGraphs(Graph& graph, Backend& backend) -> STATUS;
 
     /**
      * Detects graph operation precision
@@ -114,28 +390,62 @@ class ModelImpl final : public Model {
     /**
      * @brief Allocates input and output tensors
      *
-     * This function allocates input and output tensors. Should be used before
-     * executing.
+     * This function allocates input and output tensors of all graphs. Should
+     * be used before executing. All tensors are carved out of a single arena,
+     * each aligned to a cache line, graph by graph with inputs first then
+     * outputs. The arena is only reallocated if the total I/O size changes,
+     * such that tensor addresses are stable for the lifetime of the model.
      *
      * @return STATUS The status of the operation (SUCCESS or FAIL).
      */
     auto allocate() -> STATUS;
 
-    static auto initializeBackend() -> STATUS {
-        if (m_backend == nullptr) {
-            m_backend = std::make_unique<Backend>(DELEGATE::NPU);
-        }
+    /**
+     * @brief Hashes the model file, or the context binary of a bundle.
+     * @return The hash of the model, 0 if neither is accessible.
+     */
+    auto hashModel() const -> uint64_t final;
+
+    auto initializeBackend() -> STATUS {
+        m_backend = BackendRegistry::get().acquire(DELEGATE::NPU);
 
-        return m_backend->getCreationStatus();
+        return m_backend != nullptr ? STATUS::SUCCESS : STATUS::FAIL;
     }
 
     std::filesystem::path m_modelPath;  ///< The path to the QNN model file
 
-    static std::unique_ptr<Backend> m_backend;
+    /* declared before the graph, which must be released first */
+    std::shared_ptr<Backend> m_backend;
 
-    Graph m_graph;
+    std::unique_ptr<Graph> m_graph = std::make_unique<Graph>();
 
     bool m_loadCachedBinary {};
+
+    size_t m_modelBytes {};  ///< Size of the loaded model file
+
+    AlignedBuffer m_ioArena;  ///< Memory backing input and output tensors
+
+    std::vector<GraphTensors> m_graphTensors;  ///< I/O tensors of each graph
+
+    std::vector<StateTensors> m_states;  ///< State tensors of all graphs
+
+    size_t m_asyncQueueDepth {};  ///< Number of asynchronous tensor sets
+
+    HtpOptions m_htpOptions;  ///< HTP graph and context tuning options
+
+    std::vector<std::unique_ptr<AsyncSlot>> m_asyncSlots;
+    size_t m_nextAsyncSlot {};
+
+    std::mutex m_asyncMutex;
+    std::condition_variable m_asyncCondition;
+
+    /* reused by execute() until triggered, signals are single use once
+     * triggered */
+    Qnn_SignalHandle_t m_signal {};
+
+    std::mutex m_signalMutex;  ///< Guards the signal of the execution
+    Qnn_SignalHandle_t m_activeSignal {};  ///< Signal of the execution, if any
+    bool m_signalTriggered {};  ///< Whether cancel() triggered m_activeSignal
 };
 
 }  // namespace edge::qnn
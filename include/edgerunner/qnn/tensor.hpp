@@ -6,10 +6,12 @@
 
 #pragma once
 
+#include <cstdint>
 #include <vector>
 
 #include <QnnTypes.h>
 #include <edgerunner/edgerunner_export.hpp>
+#include <nonstd/span.hpp>
 
 #include "edgerunner/tensor.hpp"
 
@@ -29,6 +31,14 @@ class EDGERUNNER_EXPORT TensorImpl final : public Tensor {
     explicit TensorImpl(Qnn_Tensor_t* qnnTensor = nullptr,
                         bool allocate = true);
 
+    /**
+     * @brief Constructor for TensorImpl backed by external memory.
+     * @param qnnTensor Pointer to the QnnTensor object.
+     * @param buffer Memory backing the Tensor, must hold getNumBytes() bytes
+     * and outlive the Tensor.
+     */
+    TensorImpl(Qnn_Tensor_t* qnnTensor, nonstd::span<uint8_t> buffer);
+
     TensorImpl(const TensorImpl& other) = default;
     TensorImpl(TensorImpl&&) = default;
     auto operator=(const TensorImpl&) -> TensorImpl& = default;
@@ -60,6 +70,12 @@ class EDGERUNNER_EXPORT TensorImpl final : public Tensor {
      */
     auto getSize() const -> size_t final;
 
+    /**
+     * @brief Get the number of bytes occupied by the tensor data.
+     * @return The number of bytes occupied by the tensor data.
+     */
+    auto getNumBytes() -> size_t final;
+
   protected:
     /**
      * @brief Get a pointer to the data of the tensor.
@@ -67,17 +83,12 @@ class EDGERUNNER_EXPORT TensorImpl final : public Tensor {
      */
     auto getDataPtr() -> void* final;
 
-    /**
-     * @brief Get the number of bytes occupied by the tensor data.
-     * @return The number of bytes occupied by the tensor data.
-     */
-    auto getNumBytes() -> size_t final;
-
   private:
     /**
-     * @brief Allocate underlying memory for the Tensor
+     * @brief Point the QNN tensor at a client buffer
+     * @param buffer The memory backing the tensor
      */
-    void allocate();
+    void setClientBuffer(nonstd::span<uint8_t> buffer);
 
     EDGERUNNER_SUPPRESS_C4251
     Qnn_Tensor_t* m_tensor;  ///< The underlying QNN tensor
@@ -0,0 +1,159 @@
+/**
+ * @file reloadableModel.hpp
+ * @brief Definition of the ReloadableModel class, which replaces the version
+ * of a model under live traffic
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "edgerunner/edgerunner_export.hpp"
+#include "options.hpp"
+
+namespace edge {
+
+enum class STATUS : uint8_t;
+class Model;
+
+/**
+ * @brief A handle to the current version of a model, replaced without
+ * draining traffic
+ *
+ * New versions are loaded and warmed up by a background worker, then swapped
+ * in atomically. Callers acquire the current version for each request:
+ * requests in flight on the previous version complete normally, later
+ * requests use the new version. A replaced version is destroyed by the
+ * worker once no caller holds it anymore, such that neither loading nor
+ * destruction happen on the request path.
+ *
+ * A new version must have the same input and output tensors as the current
+ * version, otherwise the reload fails and the current version is kept.
+ * Versions are not synchronized: a version acquired by several threads must
+ * be executed by one thread at a time, as any Model.
+ */
+class EDGERUNNER_EXPORT ReloadableModel {
+  public:
+    /** Creates a new version of the model, nullptr on failure */
+    using Loader = std::function<std::unique_ptr<Model>()>;
+
+    /**
+     * @brief Serve a model as the first version
+     *
+     * Check getCreationStatus() before use, creation fails for a nullptr
+     * model.
+     *
+     * @param model The first version
+     */
+    explicit ReloadableModel(std::unique_ptr<Model> model);
+
+    ReloadableModel(const ReloadableModel&) = delete;
+    ReloadableModel(ReloadableModel&&) = delete;
+    auto operator=(const ReloadableModel&) -> ReloadableModel& = delete;
+    auto operator=(ReloadableModel&&) -> ReloadableModel& = delete;
+
+    /**
+     * @brief Complete queued reloads and stop the worker
+     *
+     * Replaced versions still acquired by callers are destroyed by the last
+     * holder.
+     */
+    ~ReloadableModel();
+
+    /**
+     * @brief Get the status of the creation of the handle
+     * @return The status of the creation
+     */
+    auto getCreationStatus() const -> STATUS;
+
+    /**
+     * @brief Acquire the current version of the model
+     *
+     * The version remains valid while the returned pointer is held, also
+     * after it is replaced.
+     *
+     * @return The current version
+     */
+    auto acquire() const -> std::shared_ptr<Model>;
+
+    /**
+     * @brief Get the number of the current version, starting at 1
+     * @return The number of the current version
+     */
+    auto getVersion() const -> uint64_t;
+
+    /**
+     * @brief Load a new version from a file in the background
+     *
+     * The delegate of the current version is applied to the new version
+     * before it is warmed up.
+     *
+     * @param modelPath The path to the model file
+     * @param options Options used to configure the new version
+     * @return A future holding the status of the reload, SUCCESS once the new
+     * version is swapped in
+     */
+    auto reload(const std::filesystem::path& modelPath,
+                const ModelOptions& options = {}) -> std::future<STATUS>;
+
+    /**
+     * @brief Create a new version in the background
+     *
+     * The new version is executed once to warm it up before it is swapped in.
+     * Reloads are processed in submission order.
+     *
+     * @param loader Creates the new version on the worker
+     * @return A future holding the status of the reload, SUCCESS once the new
+     * version is swapped in
+     */
+    auto reload(Loader loader) -> std::future<STATUS>;
+
+  private:
+    struct Pending {
+        Loader loader;
+        std::promise<STATUS> promise;
+    };
+
+    void run();
+
+    auto swapIn(const Loader& loader) -> STATUS;
+
+    /* destroys replaced versions no caller holds anymore */
+    void reclaim();
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::shared_ptr<Model> m_model; /**< Only accessed atomically */
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::atomic<uint64_t> m_version {1};
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::mutex m_mutex;
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::condition_variable m_condition;
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::deque<Pending> m_queue;
+
+    /** Replaced versions, only accessed by the worker */
+    EDGERUNNER_SUPPRESS_C4251
+    std::vector<std::shared_ptr<Model>> m_retired;
+
+    bool m_stopping = false;
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::thread m_worker;
+};
+
+}  // namespace edge
@@ -0,0 +1,110 @@
+/**
+ * @file model.hpp
+ * @brief Definition of the ModelImpl class, which implements the Model
+ * interface for models served by the edgerunner daemon.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+
+#include <nonstd/span.hpp>
+
+#include "edgerunner/model.hpp"
+#include "edgerunner/options.hpp"
+#include "edgerunner/remote/protocol.hpp"
+
+namespace edge::remote {
+
+/**
+ * @class ModelImpl
+ * @brief Implementation of the Model interface for models served by the
+ * edgerunner daemon.
+ *
+ * The model is loaded and executed by the daemon listening on
+ * ModelOptions::remoteSocketPath. Input and output tensors are shared memory
+ * mapped by both processes, such that tensors are not copied between them.
+ */
+class EDGERUNNER_EXPORT ModelImpl final : public Model {
+  public:
+    /**
+     * @brief Constructor for the ModelImpl class.
+     *
+     * Connects to the daemon and requests the model.
+     *
+     * @param modelPath The path to the model file, resolved by the daemon.
+     * @param options Options used to configure the model.
+     */
+    ModelImpl(const std::filesystem::path& modelPath,
+              const ModelOptions& options);
+
+    ModelImpl(const ModelImpl&) = delete;
+    ModelImpl(ModelImpl&&) = delete;
+    auto operator=(const ModelImpl&) -> ModelImpl& = delete;
+    auto operator=(ModelImpl&&) -> ModelImpl& = delete;
+
+    /**
+     * @brief Destructor for the ModelImpl class, disconnects from the daemon.
+     */
+    ~ModelImpl() final;
+
+    /**
+     * @brief Requests a model from the daemon.
+     * @param modelPath The path to the model file, resolved by the daemon.
+     * @return The status of the operation.
+     */
+    auto loadModel(const std::filesystem::path& modelPath) -> STATUS final;
+
+    /**
+     * @brief Not supported, the daemon loads models from files only.
+     * @param modelBuffer The buffer containing the model.
+     * @return STATUS::FAIL
+     */
+    auto loadModel(const nonstd::span<uint8_t>& modelBuffer) -> STATUS final;
+
+    /**
+     * @brief Checks the delegate of the model served by the daemon.
+     *
+     * The served model is shared by all clients, its delegate is chosen by
+     * the daemon. The delegate in use is queried, see getDelegate().
+     *
+     * @param delegate The delegate to apply.
+     * @return SUCCESS if the served model uses the delegate, FAIL otherwise.
+     */
+    auto applyDelegate(const DELEGATE& delegate) -> STATUS final;
+
+    using Model::execute;
+
+    /**
+     * @brief Executes the model in the daemon.
+     * @return The status of the operation.
+     */
+    auto execute() -> STATUS final;
+
+  private:
+    /**
+     * @brief Connects to the daemon socket.
+     * @return The status of the operation.
+     */
+    auto connect() -> STATUS;
+
+    /**
+     * @brief Sends a request and waits for its reply.
+     * @param message The request to send.
+     * @param reply Set to the reply of the daemon.
+     * @return The status of the operation, FAIL if the daemon could not be
+     * reached or the request failed.
+     */
+    auto request(const Message& message, Message& reply) -> STATUS;
+
+    std::filesystem::path m_socketPath;  ///< The path of the daemon socket
+
+    int m_socket = -1;  ///< The connection to the daemon
+
+    std::mutex m_mutex;  ///< Serializes requests on the connection
+};
+
+}  // namespace edge::remote
@@ -0,0 +1,154 @@
+/**
+ * @file protocol.hpp
+ * @brief Definition of the messages exchanged between the edgerunner daemon
+ * and its clients
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "edgerunner/edgerunner_export.hpp"
+#include "edgerunner/tensor.hpp"
+
+namespace edge {
+
+enum class STATUS : uint8_t;
+enum class DELEGATE : uint8_t;
+
+namespace remote {
+
+/**
+ * @enum MESSAGE
+ * @brief Type of a message, replies use the type of their request
+ */
+enum class MESSAGE : uint32_t {
+    LOAD, /**< Load a model, the payload holds its path */
+    EXECUTE, /**< Execute the model with the inputs in shared memory */
+    APPLY_DELEGATE /**< Check the delegate held in the argument is in use */
+};
+
+/**
+ * @brief Fixed size header of every message
+ */
+struct MessageHeader {
+    static constexpr uint32_t Magic = 0x45524E52; /* "ERNR" */
+
+    uint32_t magic = Magic; /**< Identifies edgerunner messages */
+    MESSAGE type = MESSAGE::LOAD; /**< Type of the message */
+    uint32_t status {}; /**< Status of a reply */
+    uint32_t argument {}; /**< Type specific argument */
+    uint32_t payloadSize {}; /**< Number of payload bytes after the header */
+};
+
+/**
+ * @brief A message with its payload and attached file descriptors
+ */
+struct Message {
+    /* messages fit a single datagram of the socket */
+    static constexpr size_t MaxSize = 64 * 1024;
+
+    /* limited by SCM_MAX_FD */
+    static constexpr size_t MaxFileDescriptors = 253;
+
+    MessageHeader header;
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::vector<uint8_t> payload;
+
+    /**
+     * File descriptors passed along the message. Received file descriptors
+     * are owned by the receiver
+     */
+    EDGERUNNER_SUPPRESS_C4251
+    std::vector<int> fileDescriptors;
+};
+
+/**
+ * @brief Description of a tensor shared between the daemon and a client
+ */
+struct TensorDescription {
+    EDGERUNNER_SUPPRESS_C4251
+    std::string name; /**< Name of the tensor */
+
+    TensorType type = TensorType::NOTYPE; /**< Type of the tensor */
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::vector<size_t> dimensions; /**< Dimensions of the tensor */
+};
+
+/**
+ * @brief Description of a model loaded by the daemon, the payload of a LOAD
+ * reply
+ *
+ * The reply carries one shared memory file descriptor per input, then per
+ * output.
+ */
+struct ModelDescription {
+    DELEGATE delegate {}; /**< Delegate used by the model */
+    TensorType precision = TensorType::NOTYPE; /**< Precision of the model */
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::vector<TensorDescription> inputs; /**< Input tensors */
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::vector<TensorDescription> outputs; /**< Output tensors */
+};
+
+/**
+ * @brief Get the default path of the daemon socket
+ *
+ * @return $XDG_RUNTIME_DIR/edgerunner.sock if set, otherwise a path in the
+ * temporary directory
+ */
+auto EDGERUNNER_EXPORT getDefaultSocketPath() -> std::filesystem::path;
+
+/**
+ * @brief Send a message over a connected socket
+ *
+ * @param socket The socket to send the message on
+ * @param message The message to send
+ * @return The status of the operation
+ */
+auto EDGERUNNER_EXPORT sendMessage(int socket, const Message& message)
+    -> STATUS;
+
+/**
+ * @brief Receive a message from a connected socket
+ *
+ * Blocks until a message is received or the connection is closed.
+ *
+ * @param socket The socket to receive the message from
+ * @param message Set to the received message
+ * @return The status of the operation, FAIL if the connection was closed or
+ * the message is malformed
+ */
+auto EDGERUNNER_EXPORT receiveMessage(int socket, Message& message) -> STATUS;
+
+/**
+ * @brief Serialize a model description
+ *
+ * @param description The description to serialize
+ * @return The serialized description
+ */
+auto EDGERUNNER_EXPORT encodeModelDescription(
+    const ModelDescription& description) -> std::vector<uint8_t>;
+
+/**
+ * @brief Deserialize a model description
+ *
+ * @param payload The serialized description
+ * @param description Set to the deserialized description
+ * @return The status of the operation, FAIL if the payload is malformed
+ */
+auto EDGERUNNER_EXPORT decodeModelDescription(
+    const std::vector<uint8_t>& payload, ModelDescription& description)
+    -> STATUS;
+
+}  // namespace remote
+
+}  // namespace edge
@@ -0,0 +1,170 @@
+/**
+ * @file server.hpp
+ * @brief Definition of the Server class, which serves models to client
+ * processes over a Unix domain socket
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "edgerunner/edgerunner_export.hpp"
+#include "edgerunner/options.hpp"
+#include "sharedBuffer.hpp"
+
+namespace edge {
+
+enum class STATUS : uint8_t;
+class Model;
+
+namespace remote {
+
+/**
+ * @brief Serves models to client processes over a Unix domain socket
+ *
+ * Models are loaded once and shared by all clients requesting the same path.
+ * Clients are served models registered with addModel(), and models within the
+ * model directory, if given. Only processes of the same user are served: the
+ * socket is only accessible by its owner and the credentials of connecting
+ * processes are checked.
+ *
+ * Each client connection holds its own input and output tensors in memfd
+ * shared memory, mapped by both processes. Where the backend supports it, the
+ * shared memory of the executing client is bound as the model inputs and
+ * outputs (see Model::bindInput()), such that tensors are never copied;
+ * otherwise they are copied in and out of the model tensors.
+ *
+ * Executions of a shared model are serialized, executions of different
+ * models run concurrently. The delegate of a served model is chosen by the
+ * server, clients cannot change it. Connect to the server by creating a model
+ * with ModelOptions::remoteSocketPath set.
+ */
+class EDGERUNNER_EXPORT Server {
+  public:
+    /**
+     * @brief Constructor for the Server class
+     *
+     * @param socketPath The path of the socket to listen on
+     * @param options Options used to create models requested by clients
+     * @param modelDirectory Directory of the models clients may load, relative
+     * paths are resolved against it. Empty to only serve models registered
+     * with addModel().
+     */
+    explicit Server(std::filesystem::path socketPath,
+                    ModelOptions options = {},
+                    std::filesystem::path modelDirectory = {});
+
+    Server(const Server&) = delete;
+    Server(Server&&) = delete;
+    auto operator=(const Server&) -> Server& = delete;
+    auto operator=(Server&&) -> Server& = delete;
+
+    /**
+     * @brief Stop serving and release all models
+     */
+    ~Server();
+
+    /**
+     * @brief Serve an already created model
+     *
+     * Clients requesting the given path are served this model instead of
+     * loading it.
+     *
+     * @param modelPath The path requested by clients
+     * @param model The model to serve
+     * @return The status of the operation, FAIL if the path is already served
+     */
+    auto addModel(const std::string& modelPath, std::shared_ptr<Model> model)
+        -> STATUS;
+
+    /**
+     * @brief Start listening and serving clients on a background thread
+     *
+     * An existing socket file at the socket path is replaced.
+     *
+     * @return The status of the operation
+     */
+    auto start() -> STATUS;
+
+    /**
+     * @brief Stop listening and disconnect all clients
+     */
+    void stop();
+
+    /**
+     * @brief Get the path of the socket
+     * @return The path of the socket
+     */
+    auto getSocketPath() const -> const std::filesystem::path& {
+        return m_socketPath;
+    }
+
+  private:
+    struct SessionBuffers {
+        std::vector<SharedBuffer> inputs;
+        std::vector<SharedBuffer> outputs;
+    };
+
+    struct SharedModel {
+        std::shared_ptr<Model> model;
+        std::mutex mutex;
+
+        /* buffers bound to the model, kept alive while bound */
+        std::shared_ptr<SessionBuffers> boundBuffers;
+    };
+
+    struct Connection {
+        int socket = -1;
+        std::thread thread;
+        std::atomic<bool> finished {false};
+    };
+
+    void acceptClients();
+
+    auto resolveModelPath(const std::string& modelPath) const
+        -> std::filesystem::path;
+
+    void serveClient(Connection& connection);
+
+    auto getModel(const std::string& modelPath) -> std::shared_ptr<SharedModel>;
+
+    static auto execute(SharedModel& sharedModel,
+                        const std::shared_ptr<SessionBuffers>& buffers)
+        -> STATUS;
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::filesystem::path m_socketPath;
+
+    EDGERUNNER_SUPPRESS_C4251
+    ModelOptions m_options;
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::filesystem::path m_modelDirectory;
+
+    int m_socket = -1;
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::mutex m_mutex;
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::map<std::string, std::shared_ptr<SharedModel>> m_models;
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::list<Connection> m_connections;
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::thread m_acceptThread;
+};
+
+}  // namespace remote
+
+}  // namespace edge
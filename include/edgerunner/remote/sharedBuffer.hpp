@@ -0,0 +1,97 @@
+/**
+ * @file sharedBuffer.hpp
+ * @brief Definition of the SharedBuffer class, a memfd-backed memory mapping
+ * shared between processes
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "edgerunner/edgerunner_export.hpp"
+
+namespace edge::remote {
+
+/**
+ * @brief An owning, move-only mapping of an anonymous shared memory file
+ *
+ * The file descriptor can be passed to another process, which maps the same
+ * memory with fromFileDescriptor(). The file is sealed against resizing, such
+ * that neither process can make accesses of the other fault. Mappings are
+ * page aligned. Failures do not
+ * throw, instead data() returns nullptr.
+ */
+class EDGERUNNER_EXPORT SharedBuffer {
+  public:
+    SharedBuffer() = default;
+
+    SharedBuffer(const SharedBuffer&) = delete;
+    auto operator=(const SharedBuffer&) -> SharedBuffer& = delete;
+
+    SharedBuffer(SharedBuffer&& other) noexcept
+        : m_fileDescriptor(std::exchange(other.m_fileDescriptor, -1))
+        , m_data(std::exchange(other.m_data, nullptr))
+        , m_size(std::exchange(other.m_size, 0)) {}
+
+    auto operator=(SharedBuffer&& other) noexcept -> SharedBuffer& {
+        if (this != &other) {
+            release();
+            m_fileDescriptor = std::exchange(other.m_fileDescriptor, -1);
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+        }
+        return *this;
+    }
+
+    ~SharedBuffer() { release(); }
+
+    /**
+     * @brief Create and map a zero-initialized shared memory file
+     *
+     * @param name The name of the file, for debugging purposes only
+     * @param size The size of the buffer in bytes
+     * @return The created buffer, check data() for failure
+     */
+    static auto create(const std::string& name, size_t size) -> SharedBuffer;
+
+    /**
+     * @brief Map a shared memory file received from another process
+     *
+     * Takes ownership of the file descriptor, also on failure. Files which are
+     * not sealed against resizing are rejected.
+     *
+     * @param fileDescriptor The file descriptor of the shared memory file
+     * @return The mapped buffer, check data() for failure
+     */
+    static auto fromFileDescriptor(int fileDescriptor) -> SharedBuffer;
+
+    /**
+     * @brief Get the mapped memory
+     * @return Pointer to the mapped memory, nullptr if not mapped
+     */
+    auto data() const -> uint8_t* { return m_data; }
+
+    /**
+     * @brief Get the size of the mapped memory
+     * @return The size of the mapped memory in bytes
+     */
+    auto size() const -> size_t { return m_size; }
+
+    /**
+     * @brief Get the file descriptor of the shared memory file
+     * @return The file descriptor, -1 if none
+     */
+    auto getFileDescriptor() const -> int { return m_fileDescriptor; }
+
+  private:
+    void release();
+
+    int m_fileDescriptor = -1;
+    uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+};
+
+}  // namespace edge::remote
@@ -0,0 +1,93 @@
+/**
+ * @file tensor.hpp
+ * @brief Definition of the TensorImpl class, a tensor held in memory shared
+ * with the edgerunner daemon
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <edgerunner/edgerunner_export.hpp>
+
+#include "edgerunner/remote/protocol.hpp"
+#include "edgerunner/remote/sharedBuffer.hpp"
+#include "edgerunner/tensor.hpp"
+
+namespace edge::remote {
+
+/**
+ * @class TensorImpl
+ * @brief Concrete implementation of the Tensor interface for remote models.
+ *
+ * The data of the tensor is a shared memory mapping, which the daemon uses as
+ * the data of the corresponding tensor of the served model.
+ */
+class EDGERUNNER_EXPORT TensorImpl final : public Tensor {
+  public:
+    /**
+     * @brief Constructor for TensorImpl.
+     * @param description The description of the tensor.
+     * @param buffer The shared memory holding the tensor data.
+     */
+    TensorImpl(TensorDescription description, SharedBuffer buffer)
+        : m_description(std::move(description))
+        , m_buffer(std::move(buffer)) {}
+
+    TensorImpl(const TensorImpl&) = delete;
+    TensorImpl(TensorImpl&&) = default;
+    auto operator=(const TensorImpl&) -> TensorImpl& = delete;
+    auto operator=(TensorImpl&&) -> TensorImpl& = default;
+
+    ~TensorImpl() final = default;
+
+    /**
+     * @brief Get the name of the tensor.
+     * @return The name of the tensor as a string.
+     */
+    auto getName() const -> std::string final { return m_description.name; }
+
+    /**
+     * @brief Get the type of the tensor.
+     * @return The type of the tensor as a TensorType enum.
+     */
+    auto getType() const -> TensorType final { return m_description.type; }
+
+    /**
+     * @brief Get the dimensions of the tensor.
+     * @return A vector of size_t representing the dimensions of the tensor.
+     */
+    auto getDimensions() const -> std::vector<size_t> final {
+        return m_description.dimensions;
+    }
+
+    /**
+     * @brief Get the total size of the tensor.
+     * @return The total size of the tensor in number of elements.
+     */
+    auto getSize() const -> size_t final;
+
+  protected:
+    /**
+     * @brief Get a pointer to the data of the tensor.
+     * @return A void pointer to the data of the tensor.
+     */
+    auto getDataPtr() -> void* final { return m_buffer.data(); }
+
+    /**
+     * @brief Get the number of bytes occupied by the tensor data.
+     * @return The number of bytes occupied by the tensor data.
+     */
+    auto getNumBytes() -> size_t final { return m_buffer.size(); }
+
+  private:
+    EDGERUNNER_SUPPRESS_C4251
+    TensorDescription m_description;  ///< Name, type and dimensions
+
+    SharedBuffer m_buffer;  ///< The shared tensor data
+};
+
+}  // namespace edge::remote
@@ -0,0 +1,224 @@
+/**
+ * @file scheduler.hpp
+ * @brief Definition of the Scheduler class, which dispatches execute requests
+ * of several models earliest-deadline-first
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <unordered_set>
+#include <vector>
+
+#include "edgerunner/edgerunner_export.hpp"
+#include "metrics.hpp"
+
+namespace edge {
+
+enum class STATUS : uint8_t;
+class Model;
+
+/**
+ * @enum PRIORITY
+ * @brief Priority class of a scheduled request
+ */
+enum class PRIORITY : uint8_t {
+    HIGH, /**< Latency critical requests */
+    NORMAL, /**< Default requests */
+    LOW /**< Bulk requests */
+};
+
+/**
+ * @brief Options used to configure a Scheduler
+ *
+ * Each delegate has its own pool of workers, such that requests of models on
+ * different devices do not wait for each other. A delegate without workers
+ * rejects requests.
+ */
+struct SchedulerOptions {
+    size_t cpuWorkers = 1; /**< Number of workers executing CPU models */
+    size_t gpuWorkers = 1; /**< Number of workers executing GPU models */
+    size_t npuWorkers = 1; /**< Number of workers executing NPU models */
+};
+
+/**
+ * @brief An execute request submitted to a Scheduler
+ */
+struct SchedulerRequest {
+    using Clock = std::chrono::steady_clock;
+
+    Model* model = nullptr; /**< The model to execute */
+    PRIORITY priority = PRIORITY::NORMAL; /**< Priority class of the request */
+
+    /**
+     * Requests that are not dispatched by their deadline are dropped. Without
+     * a deadline, requests are ordered by priority after all requests with a
+     * deadline.
+     */
+    Clock::time_point deadline = Clock::time_point::max();
+
+    /**
+     * Invoked right before execution, while the request has exclusive access
+     * to the model, e.g. to write inputs. Optional.
+     */
+    std::function<void(Model&)> prepare;
+
+    /**
+     * Invoked right after execution, while the request still has exclusive
+     * access to the model, e.g. to read outputs. Not invoked for dropped
+     * requests. Optional.
+     */
+    std::function<void(Model&, STATUS)> complete;
+};
+
+/**
+ * @brief A point in time snapshot of the statistics of a priority class
+ */
+struct EDGERUNNER_EXPORT SchedulerStats {
+    HistogramSnapshot queueDelay; /**< Time from submission to dispatch */
+    uint64_t executed {}; /**< Number of dispatched requests */
+    uint64_t dropped {}; /**< Number of requests that missed their deadline */
+};
+
+/**
+ * @brief Dispatches execute requests of several models earliest-deadline-first
+ *
+ * Requests are queued per delegate of their model at submission, and each
+ * idle worker of that delegate dispatches the queued request with the earliest
+ * deadline, breaking ties by priority and then by submission order. Requests
+ * of a model never execute concurrently: a request whose model is executing is
+ * skipped until the model is free. Requests whose deadline has passed by the
+ * time they would be dispatched are dropped and fail.
+ *
+ * Queueing delay and drops are recorded per priority class.
+ */
+class EDGERUNNER_EXPORT Scheduler {
+  public:
+    using Clock = SchedulerRequest::Clock;
+
+    static constexpr size_t NumPriorities = 3;
+    static constexpr size_t NumDelegates = 3;
+
+    /**
+     * @brief Start the workers of the scheduler
+     *
+     * @param options Options used to configure the scheduler
+     */
+    explicit Scheduler(const SchedulerOptions& options = {});
+
+    Scheduler(const Scheduler&) = delete;
+    Scheduler(Scheduler&&) = delete;
+    auto operator=(const Scheduler&) -> Scheduler& = delete;
+    auto operator=(Scheduler&&) -> Scheduler& = delete;
+
+    /**
+     * @brief Dispatch all queued requests and stop the workers
+     */
+    ~Scheduler();
+
+    /**
+     * @brief Submit an execute request
+     *
+     * The model must outlive the request.
+     *
+     * @param request The request to submit
+     * @return A future holding the status of the execution, FAIL if the
+     * request was dropped or rejected
+     */
+    auto submit(SchedulerRequest request) -> std::future<STATUS>;
+
+    /**
+     * @brief Submit an execute request without callbacks
+     *
+     * @param model The model to execute
+     * @param priority Priority class of the request
+     * @param deadline Time by which the request must be dispatched
+     * @return A future holding the status of the execution, FAIL if the
+     * request was dropped or rejected
+     */
+    auto submit(Model& model,
+                PRIORITY priority,
+                Clock::time_point deadline = Clock::time_point::max())
+        -> std::future<STATUS>;
+
+    /**
+     * @brief Get the number of queued requests
+     * @return The number of requests not yet dispatched
+     */
+    auto getNumQueued() -> size_t;
+
+    /**
+     * @brief Take a snapshot of the statistics of a priority class
+     *
+     * @param priority The priority class
+     * @return A snapshot of the statistics of the priority class
+     */
+    auto getStats(PRIORITY priority) const -> SchedulerStats;
+
+    /**
+     * @brief Clear the statistics of all priority classes
+     */
+    void resetStats() noexcept;
+
+  private:
+    /* deadline, priority and submission order */
+    using Key = std::tuple<Clock::time_point, PRIORITY, uint64_t>;
+
+    struct Pending {
+        SchedulerRequest request;
+        Clock::time_point submitted;
+        std::promise<STATUS> promise;
+    };
+
+    struct Stats {
+        LatencyHistogram queueDelay;
+
+        EDGERUNNER_SUPPRESS_C4251
+        std::atomic<uint64_t> executed {};
+
+        EDGERUNNER_SUPPRESS_C4251
+        std::atomic<uint64_t> dropped {};
+    };
+
+    void runWorker(size_t queueIndex);
+
+    void dropExpired(std::multimap<Key, Pending>& queue);
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::mutex m_mutex;
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::condition_variable m_condition;
+
+    /* one queue per delegate */
+    EDGERUNNER_SUPPRESS_C4251
+    std::array<std::multimap<Key, Pending>, NumDelegates> m_queues;
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::array<size_t, NumDelegates> m_numWorkers {};
+
+    /* models with a request being executed */
+    EDGERUNNER_SUPPRESS_C4251
+    std::unordered_set<const Model*> m_busyModels;
+
+    uint64_t m_nextSequence {};
+    bool m_stopping = false;
+
+    std::array<Stats, NumPriorities> m_stats;
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::vector<std::thread> m_workers;
+};
+
+}  // namespace edge
@@ -6,7 +6,9 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -158,4 +160,67 @@ auto Tensor::getTensorAs() -> nonstd::span<T> {
     return {static_cast<T*>(dataPtr), numElements};
 }
 
+/**
+ * @brief A tensor owning a copy of the data of another tensor
+ *
+ * Used to hand out results which are not overwritten by further executions.
+ */
+class TensorCopy final : public Tensor {
+  public:
+    /**
+     * @brief Copy the name, type, dimensions and data of a tensor
+     *
+     * @param tensor The tensor to copy
+     */
+    explicit TensorCopy(Tensor& tensor)
+        : m_name(tensor.getName())
+        , m_type(tensor.getType())
+        , m_dimensions(tensor.getDimensions())
+        , m_size(tensor.getSize()) {
+        const auto data = tensor.getTensorAs<uint8_t>();
+        m_data.assign(data.cbegin(), data.cend());
+    }
+
+    auto getName() const -> std::string final { return m_name; }
+
+    auto getType() const -> TensorType final { return m_type; }
+
+    auto getDimensions() const -> std::vector<size_t> final {
+        return m_dimensions;
+    }
+
+    auto getSize() const -> size_t final { return m_size; }
+
+  protected:
+    auto getDataPtr() -> void* final {
+        return m_data.empty() ? nullptr : m_data.data();
+    }
+
+    auto getNumBytes() -> size_t final { return m_data.size(); }
+
+  private:
+    std::string m_name;
+    TensorType m_type;
+    std::vector<size_t> m_dimensions;
+    size_t m_size;
+    std::vector<uint8_t> m_data;
+};
+
+/**
+ * @brief Copy tensors, see TensorCopy
+ *
+ * @param tensors The tensors to copy
+ * @return The copies, in the same order
+ */
+inline auto copyTensors(const std::vector<std::shared_ptr<Tensor>>& tensors)
+    -> std::vector<std::shared_ptr<Tensor>> {
+    std::vector<std::shared_ptr<Tensor>> copies;
+    copies.reserve(tensors.size());
+    for (const auto& tensor : tensors) {
+        copies.emplace_back(std::make_shared<TensorCopy>(*tensor));
+    }
+
+    return copies;
+}
+
 }  // namespace edge
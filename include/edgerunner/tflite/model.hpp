@@ -6,33 +6,71 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include <tensorflow/lite/core/c/c_api_types.h>
 #include <tensorflow/lite/core/c/common.h>
 #include <tensorflow/lite/interpreter.h>
 #include <tensorflow/lite/kernels/register.h>
 #include <tensorflow/lite/model.h>
+#include <tensorflow/lite/profiling/buffered_profiler.h>
 
+#include "edgerunner/alignedBuffer.hpp"
+#include "edgerunner/arenaGroup.hpp"
 #include "edgerunner/model.hpp"
+#include "edgerunner/options.hpp"
 
 namespace edge::tflite {
 
 /**
  * @class ModelImpl
  * @brief Implementation of the Model interface for TensorFlow Lite models.
+ *
+ * When created with an ArenaGroup, the non-persistent arena of the
+ * interpreter is only held while the model is the active group member, and
+ * input and output tensors are backed by dedicated buffers.
  */
-class ModelImpl final : public Model {
+class ModelImpl final
+    : public Model
+    , private ArenaGroup::Member {
   public:
     /**
      * @brief Constructor for ModelImpl.
      * @param modelPath The path to the TensorFlow Lite model file.
+     * @param options Options used to configure the model.
      */
-    explicit ModelImpl(const std::filesystem::path& modelPath);
+    explicit ModelImpl(const std::filesystem::path& modelPath,
+                       const ModelOptions& options = {});
 
     /**
      * @brief Constructor for ModelImpl.
-     * @param modelPath The path to the TensorFlow Lite model file.
+     * @param modelBuffer The buffer containing the TensorFlow Lite model.
+     * @param options Options used to configure the model.
      */
-    explicit ModelImpl(const nonstd::span<uint8_t>& modelBuffer);
+    explicit ModelImpl(const nonstd::span<uint8_t>& modelBuffer,
+                       const ModelOptions& options = {});
+
+    /**
+     * @brief Constructor for ModelImpl.
+     *
+     * The flatbuffer is built in place from the TFLITE section.
+     *
+     * @param bundle The bundle holding the model.
+     * @param options Options used to configure the model.
+     */
+    explicit ModelImpl(const std::shared_ptr<Bundle>& bundle,
+                       const ModelOptions& options = {});
 
     ModelImpl(const ModelImpl&) = delete;
     ModelImpl(ModelImpl&&) = delete;
@@ -48,7 +86,8 @@ class ModelImpl final : public Model {
      * @brief Loads the TensorFlow Lite model from the specified path.
      *
      * This function loads a TensorFlow Lite model from the specified file path.
-     * The model file should be in the TensorFlow Lite format.
+     * The model file should be in the TensorFlow Lite format. zstd and lz4
+     * compressed files are decompressed into a buffer owned by the model.
      *
      * @param modelPath The path to the TensorFlow Lite model file.
      * @return STATUS Returns a status indicating whether the model was
@@ -75,13 +114,215 @@ class ModelImpl final : public Model {
      */
     auto applyDelegate(const DELEGATE& delegate) -> STATUS final;
 
+    /**
+     * @brief Keeps interpreters with the given delegates applied alive, such
+     * that applyDelegate() switches between them by exchanging pointers.
+     *
+     * Input and output tensors are backed by stable buffers shared by all
+     * prepared interpreters, keeping input contents. Binding tensors and
+     * state apply to all of them. Rebuilding the interpreter, e.g. through
+     * setNumThreads(), applyPrecision() or applying the current delegate
+     * again, releases the prepared interpreters. resizeInput(), addState()
+     * and selectGraph() fail while interpreters are prepared. Unavailable to
+     * ArenaGroup members and once a signature is selected.
+     *
+     * @param delegates The delegates to prepare besides the current delegate.
+     * @return The status of the operation, no interpreter is prepared on
+     * failure.
+     */
+    auto prepareDelegates(const std::vector<DELEGATE>& delegates)
+        -> STATUS final;
+
+    /**
+     * @brief Selects the execution precision and applies the delegate again.
+     *
+     * On CPU, FLOAT16 and INT8 or UINT8 apply an XNNPACK delegate forcing
+     * fp16 inference, respectively enabling its quantized kernels, while
+     * FLOAT32 keeps the default kernels. On GPU, FLOAT32 disallows precision
+     * loss, other precisions allow fp16. On NPU, FLOAT16 selects the fp16
+     * precision of the QNN delegate and INT8 or UINT8 its quantized
+     * precision, FLOAT32 is not supported. INT8 and UINT8 require a quantized
+     * model.
+     *
+     * @param precision The precision, FLOAT32, FLOAT16, INT8 or UINT8.
+     * @return The status of the operation, the previous precision is kept on
+     * failure.
+     */
+    auto applyPrecision(const TensorType& precision) -> STATUS final;
+
+    /**
+     * @brief Sets the number of threads used by the interpreter.
+     *
+     * The interpreter is rebuilt with the current delegate, such that the
+     * thread count also applies to delegates created from the interpreter.
+     * Input and output tensors are reallocated.
+     *
+     * @param numThreads The number of threads, 0 for the TensorFlow Lite
+     * default.
+     * @return The status of the operation.
+     */
+    auto setNumThreads(size_t numThreads) -> STATUS final;
+
+    /**
+     * @brief Gets the number of threads used by the interpreter.
+     * @return The number of threads, 0 for the TensorFlow Lite default.
+     */
+    auto getNumThreads() const -> size_t final { return m_numThreads; }
+
+    /**
+     * @brief Resizes an input tensor of the interpreter.
+     *
+     * The new dimensions are kept when the interpreter is rebuilt, e.g. by
+     * applyDelegate(). Members of an ArenaGroup rebuild the interpreter, since
+     * their I/O buffers are sized at allocation.
+     *
+     * @param index The index of the input tensor.
+     * @param dimensions The new dimensions of the input tensor.
+     * @return The status of the operation.
+     */
+    auto resizeInput(size_t index, const std::vector<size_t>& dimensions)
+        -> STATUS final;
+
+    /**
+     * @brief Binds caller-owned memory to an input tensor.
+     *
+     * Uses a TFLite custom allocation, kept when the interpreter is rebuilt.
+     * Rebinding a bound tensor only updates its data pointer, without
+     * reallocating tensors.
+     *
+     * @param index The index of the input tensor.
+     * @param data The memory to bind.
+     * @param numBytes The size of the memory.
+     * @return The status of the operation.
+     */
+    auto bindInput(size_t index, void* data, size_t numBytes) -> STATUS final;
+
+    /**
+     * @brief Binds caller-owned memory to an output tensor.
+     *
+     * Uses a TFLite custom allocation, kept when the interpreter is rebuilt.
+     * Rebinding a bound tensor only updates its data pointer, without
+     * reallocating tensors.
+     *
+     * @param index The index of the output tensor.
+     * @param data The memory to bind.
+     * @param numBytes The size of the memory.
+     * @return The status of the operation.
+     */
+    auto bindOutput(size_t index, void* data, size_t numBytes) -> STATUS final;
+
+    /**
+     * @brief Declares an input and output pair carrying model state.
+     *
+     * Both tensors are backed by dedicated buffers bound as TFLite custom
+     * allocations, swapped after each execution.
+     *
+     * @param inputIndex The index of the state input tensor.
+     * @param outputIndex The index of the state output tensor.
+     * @return The status of the operation.
+     */
+    auto addState(size_t inputIndex, size_t outputIndex) -> STATUS final;
+
+    /**
+     * @brief Zeroes declared state and resets TFLite variable tensors.
+     * @return The status of the operation.
+     */
+    auto resetState() -> STATUS final;
+
+    using Model::execute;
+
+    /**
+     * @brief Gets the signature keys of the model.
+     * @return The signature keys, empty if the model has no signatures.
+     */
+    auto getGraphNames() const -> std::vector<std::string> final;
+
+    /**
+     * @brief Selects a signature used by execute(), getInputs() and
+     * getOutputs().
+     *
+     * Signatures are executed by a TFLite SignatureRunner of the same
+     * interpreter, sharing weights between signatures, with tensors named
+     * after the signature inputs and outputs. Each signature has its own
+     * allocation, kept when switching between signatures. Until a signature
+     * is selected, the primary subgraph is used.
+     *
+     * resizeInput(), bindInput(), bindOutput() and addState() apply to the
+     * primary subgraph, and fail once a signature is selected. Members of an
+     * ArenaGroup cannot select signatures, whose arenas are not shared.
+     *
+     * @param graphName The signature key.
+     * @return The status of the operation.
+     */
+    auto selectGraph(const std::string& graphName) -> STATUS final;
+
     /**
      * @brief Executes the TensorFlow Lite model.
      * @return The status of the operation.
      */
     auto execute() -> STATUS final;
 
+    /**
+     * @brief Executes the TensorFlow Lite model, cancelling the execution
+     * once the timeout elapses.
+     *
+     * The interpreter checks for cancellation before each operation, such
+     * that a partition of a delegate completes before the execution is
+     * cancelled.
+     *
+     * @param timeout The maximum duration of the execution.
+     * @return The status of the operation.
+     */
+    auto execute(std::chrono::microseconds timeout) -> STATUS final;
+
+    /**
+     * @brief Cancels the execution in progress before its next operation.
+     * @return The status of the operation.
+     */
+    auto cancel() -> STATUS final;
+
+    /**
+     * @brief Enables profiling using a buffered TensorFlow Lite profiler.
+     *
+     * BASIC collects interpreter level events (allocation, delegation,
+     * invocation). DETAILED additionally collects per-operator events.
+     *
+     * @param level The profiling level to enable.
+     * @return The status of the operation.
+     */
+    auto enableProfiling(const PROFILING_LEVEL& level) -> STATUS final;
+
+    /**
+     * @brief Get the profiling events collected since the last call.
+     * @return The collected profiling events.
+     */
+    auto getProfilingEvents() -> std::vector<ProfilingEvent> final;
+
+    /**
+     * @brief Get the memory footprint of the model.
+     *
+     * Reports the model allocation, the arenas and dynamic tensors of all
+     * subgraphs, and tensors backed by delegate buffer handles. Input and
+     * output tensors live in the arenas, unless the model belongs to an arena
+     * group in which case their buffers are reported as I/O.
+     *
+     * @return The memory footprint of the model.
+     */
+    auto getMemoryStats() -> MemoryStats final;
+
   private:
+    /**
+     * Loads the model and prepares it for execution.
+     *
+     * Shared by all constructors, which only differ in how the model is
+     * loaded. The bundle or model path must be set before.
+     *
+     * @param options Options used to configure the model.
+     * @param load Loads the model, before the interpreter is created.
+     */
+    void initialize(const ModelOptions& options,
+                    const std::function<STATUS()>& load);
+
     /**
      * Creates a new interpreter object.
      *
@@ -102,6 +343,65 @@ class ModelImpl final : public Model {
      */
     auto allocate() -> STATUS;
 
+    /**
+     * Allocates the tensors of the interpreter, through the arena group if
+     * the model belongs to one.
+     *
+     * @return The status of the operation.
+     */
+    auto allocateTensors() -> STATUS;
+
+    /**
+     * Backs input and output tensors with dedicated aligned buffers, such
+     * that they are preserved when the non-persistent arena is released.
+     *
+     * @return The status of the operation.
+     */
+    auto setIoAllocations() -> STATUS;
+
+    /**
+     * @brief Sets the custom allocations of bound tensors.
+     * @return The status of the operation.
+     */
+    auto setBoundAllocations() -> STATUS;
+
+    /**
+     * @brief Binds memory to an interpreter tensor and reallocates tensors.
+     * @param tensorIndex The interpreter index of the tensor.
+     * @param data The memory to bind.
+     * @param numBytes The size of the memory.
+     * @return The status of the operation.
+     */
+    auto bindTensor(int tensorIndex, void* data, size_t numBytes) -> STATUS;
+
+    /**
+     * @brief Allocates the selected signature and exposes its tensors as
+     * model I/O.
+     * @return The status of the operation.
+     */
+    auto setSignatureTensors() -> STATUS;
+
+    /**
+     * @brief Swaps the buffers of state inputs and outputs, such that the
+     * state output of an execution is the state input of the next.
+     * @return The status of the operation.
+     */
+    auto swapState() -> STATUS;
+
+    /**
+     * Acquires the non-persistent arena, called by the arena group.
+     *
+     * @return The status of the operation.
+     */
+    auto acquireScratch() -> STATUS final;
+
+    /**
+     * Releases the non-persistent arena, called by the arena group.
+     *
+     * @return The status of the operation.
+     */
+    auto releaseScratch() -> STATUS final;
+
     /**
      * Deletes the delegate object.
      *
@@ -110,6 +410,50 @@ class ModelImpl final : public Model {
      */
     void deleteDelegate();
 
+    /**
+     * @brief An interpreter prepared for a delegate, see prepareDelegates()
+     */
+    struct PreparedInterpreter {
+        DELEGATE delegate {};
+        std::unique_ptr<::tflite::Interpreter> interpreter;
+        TfLiteDelegate* tfliteDelegate = nullptr;
+        TfLiteDelegate* xnnpackDelegate = nullptr;
+        std::vector<std::shared_ptr<Tensor>> inputs;
+        std::vector<std::shared_ptr<Tensor>> outputs;
+    };
+
+    /**
+     * @brief Exchanges the current interpreter, its delegates and tensors with
+     * a prepared interpreter.
+     * @param prepared The prepared interpreter.
+     */
+    void swapInterpreter(PreparedInterpreter& prepared);
+
+    /**
+     * @brief Releases the prepared interpreters and their delegates.
+     */
+    void releasePreparedInterpreters();
+
+    /**
+     * @brief Repoints a tensor of the current and prepared interpreters.
+     * @param tensorIndex The index of the tensor.
+     * @param allocation The memory of the tensor.
+     * @return The status of the operation.
+     */
+    auto setCustomAllocation(int tensorIndex,
+                             const TfLiteCustomAllocation& allocation)
+        -> STATUS;
+
+    /**
+     * @brief Applies an XNNPACK delegate for the selected CPU precision.
+     *
+     * The default XNNPACK delegate of the interpreter is kept when no
+     * precision or FLOAT32 is selected.
+     *
+     * @return The status of the operation.
+     */
+    auto applyXnnpackDelegate() -> STATUS;
+
     /**
      * Detects graph operation precision
      *
@@ -118,16 +462,89 @@ class ModelImpl final : public Model {
      */
     auto detectPrecision() -> TensorType;
 
+    /**
+     * @brief Cancellation hook of the interpreter, checked before each
+     * operation.
+     *
+     * @param data The model.
+     * @return Whether the execution in progress is cancelled or timed out.
+     */
+    static auto checkCancelled(void* data) -> bool;
+
+    /**
+     * @brief Hashes the loaded model buffer.
+     * @return The hash of the model, 0 if the buffer is not accessible.
+     */
+    auto hashModel() const -> uint64_t final;
+
     std::filesystem::path
         m_modelPath;  ///< The path to the TensorFlow Lite model file
 
+    AlignedBuffer m_decompressedModel;  ///< Model decompressed from a
+                                        ///< compressed file, must outlive
+                                        ///< the model buffer
+
     std::unique_ptr<::tflite::FlatBufferModel>
         m_modelBuffer;  ///< The TensorFlow Lite model buffer
 
+    std::unique_ptr<::tflite::profiling::BufferedProfiler>
+        m_profiler;  ///< The profiler, must outlive the interpreter
+
+    std::shared_ptr<ArenaGroup>
+        m_arenaGroup;  ///< The group sharing scratch memory, if any
+
+    std::vector<AlignedBuffer>
+        m_ioBuffers;  ///< I/O buffers of group members, must outlive the
+                      ///< interpreter
+
+    std::vector<AlignedBuffer>
+        m_stateBuffers;  ///< Buffers of state tensors, must outlive the
+                         ///< interpreter
+
+    std::vector<AlignedBuffer>
+        m_preparedBuffers;  ///< I/O buffers shared by prepared interpreters,
+                            ///< must outlive the interpreters
+
     std::unique_ptr<::tflite::Interpreter>
         m_interpreter;  ///< The TensorFlow Lite interpreter
 
+    std::vector<PreparedInterpreter>
+        m_preparedInterpreters;  ///< Interpreters prepared for other delegates
+
+    std::string m_signatureKey;  ///< The selected signature, if any
+
+    ::tflite::SignatureRunner* m_signatureRunner =
+        nullptr;  ///< Runner of the selected signature, owned by the
+                  ///< interpreter
+
     TfLiteDelegate* m_delegate = nullptr;  ///< The TensorFlow Lite delegate
+
+    TfLiteDelegate* m_xnnpackDelegate =
+        nullptr;  ///< XNNPACK delegate applying the CPU precision, if any
+
+    std::optional<TensorType>
+        m_selectedPrecision;  ///< Precision selected by the user, if any
+
+    size_t m_numThreads {};  ///< Interpreter threads, 0 for the default
+
+    std::map<size_t, std::vector<int>>
+        m_inputDimensions;  ///< Resized input dimensions, by input index
+
+    std::map<int, TfLiteCustomAllocation>
+        m_boundAllocations;  ///< Bound and state memory, by tensor index
+
+    std::vector<std::pair<int, int>>
+        m_stateTensors;  ///< State input and output tensor indices
+
+    std::atomic<uint64_t> m_generation {
+        0};  ///< Incremented when an execution starts
+
+    std::atomic<uint64_t> m_cancelledGeneration {
+        0};  ///< Generation of the execution cancelled by cancel()
+
+    std::chrono::steady_clock::time_point m_deadline =
+        std::chrono::steady_clock::time_point::max();  ///< Deadline of the
+                                                       ///< execution
 };
 
 }  // namespace edge::tflite
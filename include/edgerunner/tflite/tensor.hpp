@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <string>
+#include <utility>
 #include <vector>
 
 #include <edgerunner/edgerunner_export.hpp>
@@ -28,6 +30,16 @@ class EDGERUNNER_EXPORT TensorImpl final : public Tensor {
     explicit TensorImpl(TfLiteTensor* tfLiteTensor = nullptr)
         : m_tensor(tfLiteTensor) {}
 
+    /**
+     * @brief Constructor for TensorImpl with a name other than the name of
+     * the TfLiteTensor, such as the input or output name of a signature.
+     * @param tfLiteTensor Pointer to the TfLiteTensor object.
+     * @param name The name of the tensor.
+     */
+    TensorImpl(TfLiteTensor* tfLiteTensor, std::string name)
+        : m_tensor(tfLiteTensor)
+        , m_name(std::move(name)) {}
+
     TensorImpl(const TensorImpl& other) = default;
     TensorImpl(TensorImpl&&) = default;
     auto operator=(const TensorImpl&) -> TensorImpl& = default;
@@ -75,6 +87,9 @@ class EDGERUNNER_EXPORT TensorImpl final : public Tensor {
   private:
     EDGERUNNER_SUPPRESS_C4251
     TfLiteTensor* m_tensor;  ///< The underlying TFlite tensor
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::string m_name;  ///< The name of the tensor, empty for the TFLite name
 };
 
 }  // namespace edge::tflite
@@ -0,0 +1,221 @@
+/**
+ * @file trace.hpp
+ * @brief Definition of the Tracer class, a ring buffer of timeline events
+ * exportable as Chrome trace JSON
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "edgerunner/edgerunner_export.hpp"
+
+namespace edge {
+
+enum class STATUS : uint8_t;
+
+/**
+ * @brief A completed timeline event
+ */
+struct EDGERUNNER_EXPORT TraceEvent {
+    EDGERUNNER_SUPPRESS_C4251
+    std::string name; /**< Name of the traced phase */
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::string detail; /**< Optional detail, such as the model name */
+
+    uint64_t startNs {}; /**< Start time relative to tracer creation */
+    uint64_t durationNs {}; /**< Duration of the event */
+    uint32_t threadId {}; /**< Index of the thread that recorded the event */
+};
+
+/**
+ * @brief Process wide recorder of timeline events
+ *
+ * Tracing is disabled by default. Once enabled, scoped events are recorded
+ * into a fixed capacity ring buffer, overwriting the oldest events when
+ * full. Recording is lock-free and safe from any number of threads. When
+ * disabled, the cost of a TraceScope is a single relaxed atomic load.
+ *
+ * Recorded events can be dumped in the Chrome trace event format, viewable
+ * in chrome://tracing or https://ui.perfetto.dev.
+ */
+class EDGERUNNER_EXPORT Tracer {
+  public:
+    static constexpr size_t DefaultCapacity = 16384;
+    static constexpr size_t MaxNameLength = 47;
+    static constexpr size_t MaxDetailLength = 63;
+
+    using TimePoint = std::chrono::steady_clock::time_point;
+
+    Tracer(const Tracer&) = delete;
+    Tracer(Tracer&&) = delete;
+    auto operator=(const Tracer&) -> Tracer& = delete;
+    auto operator=(Tracer&&) -> Tracer& = delete;
+
+    ~Tracer();
+
+    /**
+     * @brief Get the process wide tracer
+     * @return Reference to the tracer
+     */
+    static auto get() -> Tracer&;
+
+    /**
+     * @brief Start recording events
+     *
+     * The ring buffer is allocated on first use, subsequent calls keep the
+     * initial capacity.
+     *
+     * @param capacity The number of events retained by the ring buffer
+     */
+    void enable(size_t capacity = DefaultCapacity);
+
+    /**
+     * @brief Stop recording events, recorded events are kept
+     */
+    void disable();
+
+    /**
+     * @brief Check whether events are being recorded
+     * @return true if tracing is enabled
+     */
+    auto isEnabled() const -> bool {
+        return m_enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Record a completed event
+     *
+     * Names and details longer than MaxNameLength and MaxDetailLength are
+     * truncated.
+     *
+     * @param name Name of the traced phase
+     * @param detail Optional detail of the event, may be nullptr
+     * @param start Time at which the event started
+     * @param end Time at which the event completed
+     */
+    void record(const char* name,
+                const char* detail,
+                TimePoint start,
+                TimePoint end);
+
+    /**
+     * @brief Get the events currently held by the ring buffer
+     *
+     * Events being written concurrently are skipped.
+     *
+     * @return The recorded events, ordered by start time
+     */
+    auto getEvents() const -> std::vector<TraceEvent>;
+
+    /**
+     * @brief Clear all recorded events
+     */
+    void clear();
+
+    /**
+     * @brief Export the recorded events as Chrome trace JSON
+     * @return The Chrome trace JSON representation of the recorded events
+     */
+    auto toChromeTrace() const -> std::string;
+
+    /**
+     * @brief Write the recorded events to a Chrome trace JSON file
+     *
+     * @param tracePath The path of the file to write
+     * @return The status of the operation
+     */
+    auto dumpChromeTrace(const std::filesystem::path& tracePath) const
+        -> STATUS;
+
+  private:
+    struct Slot {
+        std::atomic<uint64_t> sequence {};
+        std::array<char, MaxNameLength + 1> name {};
+        std::array<char, MaxDetailLength + 1> detail {};
+        uint64_t startNs {};
+        uint64_t durationNs {};
+        uint32_t threadId {};
+    };
+
+    Tracer();
+
+    static auto getThreadId() -> uint32_t;
+
+    TimePoint m_epoch;
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::atomic<bool> m_enabled {};
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::atomic<uint64_t> m_nextTicket {};
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::atomic<uint64_t> m_firstTicket {};
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::atomic<Slot*> m_slots {};
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::atomic<size_t> m_capacity {};
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::unique_ptr<Slot[]> m_slotStorage; /* NOLINT */
+
+    EDGERUNNER_SUPPRESS_C4251
+    std::mutex m_allocationMutex;
+};
+
+/**
+ * @brief Records an event spanning its lifetime when tracing is enabled
+ */
+class TraceScope {
+  public:
+    /**
+     * @brief Start a traced event
+     *
+     * @param name Name of the traced phase, must outlive the scope
+     * @param detail Optional detail of the event, must outlive the scope
+     */
+    explicit TraceScope(const char* name, const char* detail = nullptr)
+        : m_name(name)
+        , m_detail(detail)
+        , m_enabled(Tracer::get().isEnabled()) {
+        if (m_enabled) {
+            m_start = std::chrono::steady_clock::now();
+        }
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope(TraceScope&&) = delete;
+    auto operator=(const TraceScope&) -> TraceScope& = delete;
+    auto operator=(TraceScope&&) -> TraceScope& = delete;
+
+    /**
+     * @brief Complete the traced event
+     */
+    ~TraceScope() {
+        if (m_enabled) {
+            Tracer::get().record(
+                m_name, m_detail, m_start, std::chrono::steady_clock::now());
+        }
+    }
+
+  private:
+    const char* m_name;
+    const char* m_detail;
+    bool m_enabled;
+    Tracer::TimePoint m_start;
+};
+
+}  // namespace edge
@@ -0,0 +1,224 @@
+/* Python bindings of edgerunner
+ *
+ * Tensors implement the buffer protocol over the memory of the model tensor,
+ * such that numpy.asarray(model.input(0)) is a writable view without a copy.
+ * Tensors keep their model alive, but are invalidated when the model
+ * reallocates its tensors, e.g. in apply_delegate().
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <pybind11/chrono.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <pybind11/stl/filesystem.h>
+
+#include "edgerunner/edgerunner.hpp"
+#include "edgerunner/model.hpp"
+#include "edgerunner/tensor.hpp"
+
+namespace py = pybind11;
+
+namespace {
+
+auto getFormat(const edge::TensorType type) -> std::string {
+    switch (type) {
+        case edge::TensorType::FLOAT16:
+            return "e";
+        case edge::TensorType::FLOAT32:
+            return py::format_descriptor<float>::format();
+        case edge::TensorType::INT8:
+            return py::format_descriptor<int8_t>::format();
+        case edge::TensorType::INT16:
+            return py::format_descriptor<int16_t>::format();
+        case edge::TensorType::INT32:
+            return py::format_descriptor<int32_t>::format();
+        case edge::TensorType::UINT8:
+            return py::format_descriptor<uint8_t>::format();
+        case edge::TensorType::UINT16:
+            return py::format_descriptor<uint16_t>::format();
+        case edge::TensorType::UINT32:
+            return py::format_descriptor<uint32_t>::format();
+        default:
+            return py::format_descriptor<uint8_t>::format();
+    }
+}
+
+auto getItemSize(const edge::TensorType type) -> size_t {
+    switch (type) {
+        case edge::TensorType::FLOAT16:
+        case edge::TensorType::INT16:
+        case edge::TensorType::UINT16:
+            return 2;
+        case edge::TensorType::FLOAT32:
+        case edge::TensorType::INT32:
+        case edge::TensorType::UINT32:
+            return 4;
+        default:
+            return 1;
+    }
+}
+
+/* C-contiguous view of the tensor memory */
+auto getBuffer(edge::Tensor& tensor) -> py::buffer_info {
+    const auto data = tensor.getTensorAs<uint8_t>();
+    auto type = tensor.getType();
+    auto dimensions = tensor.getDimensions();
+
+    /* expose unknown types and mismatched sizes as flat bytes */
+    size_t numElements = 1;
+    for (const auto dimension : dimensions) {
+        numElements *= dimension;
+    }
+    if (numElements * getItemSize(type) != data.size()) {
+        type = edge::TensorType::UNSUPPORTED;
+        dimensions = {data.size()};
+    }
+
+    const auto itemSize = getItemSize(type);
+
+    std::vector<py::ssize_t> shape;
+    std::vector<py::ssize_t> strides(dimensions.size());
+    shape.reserve(dimensions.size());
+    for (const auto dimension : dimensions) {
+        shape.push_back(static_cast<py::ssize_t>(dimension));
+    }
+
+    auto stride = static_cast<py::ssize_t>(itemSize);
+    for (size_t i = dimensions.size(); i > 0; --i) {
+        strides[i - 1] = stride;
+        stride *= shape[i - 1];
+    }
+
+    return {data.data(),
+            static_cast<py::ssize_t>(itemSize),
+            getFormat(type),
+            static_cast<py::ssize_t>(dimensions.size()),
+            shape,
+            strides,
+            /*readonly=*/false};
+}
+
+}  // namespace
+
+PYBIND11_MODULE(edgerunner, module) {
+    module.doc() = "Cross-platform ML inference library for mobile devices";
+
+    py::enum_<edge::STATUS>(module, "STATUS")
+        .value("SUCCESS", edge::STATUS::SUCCESS)
+        .value("FAIL", edge::STATUS::FAIL);
+
+    py::enum_<edge::DELEGATE>(module, "DELEGATE")
+        .value("CPU", edge::DELEGATE::CPU)
+        .value("GPU", edge::DELEGATE::GPU)
+        .value("NPU", edge::DELEGATE::NPU);
+
+    py::enum_<edge::TensorType>(module, "TensorType")
+        .value("UNSUPPORTED", edge::TensorType::UNSUPPORTED)
+        .value("NOTYPE", edge::TensorType::NOTYPE)
+        .value("FLOAT16", edge::TensorType::FLOAT16)
+        .value("FLOAT32", edge::TensorType::FLOAT32)
+        .value("INT8", edge::TensorType::INT8)
+        .value("INT16", edge::TensorType::INT16)
+        .value("INT32", edge::TensorType::INT32)
+        .value("UINT8", edge::TensorType::UINT8)
+        .value("UINT16", edge::TensorType::UINT16)
+        .value("UINT32", edge::TensorType::UINT32);
+
+    py::class_<edge::Tensor, std::shared_ptr<edge::Tensor>>(
+        module, "Tensor", py::buffer_protocol())
+        .def_property_readonly("name", &edge::Tensor::getName)
+        .def_property_readonly("type", &edge::Tensor::getType)
+        .def_property_readonly("shape", &edge::Tensor::getDimensions)
+        .def_property_readonly("size", &edge::Tensor::getSize)
+        .def_buffer(&getBuffer);
+
+    py::class_<edge::Model>(module, "Model")
+        .def_property_readonly("name", &edge::Model::name)
+        .def_property_readonly("num_inputs", &edge::Model::getNumInputs)
+        .def_property_readonly("num_outputs", &edge::Model::getNumOutputs)
+        .def_property_readonly("delegate", &edge::Model::getDelegate)
+        .def_property_readonly("precision", &edge::Model::getPrecision)
+        .def("input",
+             py::overload_cast<size_t>(&edge::Model::getInput, py::const_),
+             py::arg("index"),
+             py::keep_alive<0, 1>(),
+             "Get an input tensor, None if index is out of bounds")
+        .def("input",
+             py::overload_cast<const std::string&>(&edge::Model::getInput,
+                                                   py::const_),
+             py::arg("name"),
+             py::keep_alive<0, 1>(),
+             "Get an input tensor by name, None if there is none")
+        .def("output",
+             py::overload_cast<size_t>(&edge::Model::getOutput, py::const_),
+             py::arg("index"),
+             py::keep_alive<0, 1>(),
+             "Get an output tensor, None if index is out of bounds")
+        .def("output",
+             py::overload_cast<const std::string&>(&edge::Model::getOutput,
+                                                   py::const_),
+             py::arg("name"),
+             py::keep_alive<0, 1>(),
+             "Get an output tensor by name, None if there is none")
+        .def(
+            "inputs",
+            [](edge::Model& model) { return model.getInputs(); },
+            py::keep_alive<0, 1>(),
+            "Get all input tensors")
+        .def(
+            "outputs",
+            [](edge::Model& model) { return model.getOutputs(); },
+            py::keep_alive<0, 1>(),
+            "Get all output tensors")
+        .def_property_readonly("graph_names", &edge::Model::getGraphNames)
+        .def("select_graph",
+             &edge::Model::selectGraph,
+             py::arg("graph_name"),
+             "Select the graph or signature used by execute()")
+        .def("apply_precision",
+             &edge::Model::applyPrecision,
+             py::arg("precision"),
+             py::call_guard<py::gil_scoped_release>(),
+             "Select FLOAT32, FLOAT16 or INT8 execution, tensors obtained "
+             "before are invalidated")
+        .def("apply_delegate",
+             &edge::Model::applyDelegate,
+             py::arg("delegate"),
+             py::call_guard<py::gil_scoped_release>(),
+             "Apply a delegate, tensors obtained before are invalidated")
+        .def("prepare_delegates",
+             &edge::Model::prepareDelegates,
+             py::arg("delegates"),
+             py::call_guard<py::gil_scoped_release>(),
+             "Keep interpreters for the given delegates, such that "
+             "apply_delegate() switches to them keeping tensors valid")
+        .def("execute",
+             py::overload_cast<>(&edge::Model::execute),
+             py::call_guard<py::gil_scoped_release>(),
+             "Execute the model, releasing the GIL")
+        .def("execute",
+             py::overload_cast<std::chrono::microseconds>(
+                 &edge::Model::execute),
+             py::arg("timeout"),
+             py::call_guard<py::gil_scoped_release>(),
+             "Execute the model, cancelled once the timeout (a timedelta or "
+             "seconds) elapses")
+        .def("cancel",
+             &edge::Model::cancel,
+             "Cancel the execution in progress, e.g. from another thread");
+
+    module.def(
+        "create_model",
+        [](const std::filesystem::path& modelPath) {
+            py::gil_scoped_release release;
+            return edge::createModel(modelPath);
+        },
+        py::arg("model_path"),
+        "Create a model from a file, None on failure");
+}
@@ -0,0 +1,85 @@
+"""Tests of the edgerunner Python bindings, run from the build directory"""
+
+import threading
+from datetime import timedelta
+
+import numpy as np
+
+import edgerunner
+
+MODEL_PATH = "models/tflite/mobilenet_v3_small.tflite"
+
+
+def test_bad_model():
+    assert edgerunner.create_model("models/does_not_exist.tflite") is None
+
+
+def test_zero_copy():
+    model = edgerunner.create_model(MODEL_PATH)
+    assert model is not None
+    assert model.name == "mobilenet_v3_small"
+    assert model.num_inputs == 1
+    assert model.num_outputs == 1
+
+    tensor = model.input(0)
+    assert tensor.type == edgerunner.TensorType.FLOAT32
+    assert tensor.shape == [1, 224, 224, 3]
+
+    view = np.asarray(tensor)
+    assert view.dtype == np.float32
+    assert view.shape == (1, 224, 224, 3)
+
+    # writes through the view are seen by a new view of the same tensor
+    view.fill(0.5)
+    assert np.all(np.asarray(model.input(0)) == 0.5)
+
+    assert model.execute() == edgerunner.STATUS.SUCCESS
+
+    output = np.asarray(model.output(0))
+    assert output.shape == (1, 1000)
+    assert np.isfinite(output).all()
+
+    # views keep the model alive
+    del model
+    assert output.sum() == output.sum()
+
+
+def test_execute_releases_gil():
+    model = edgerunner.create_model(MODEL_PATH)
+    assert model is not None
+
+    ticks = []
+    running = threading.Event()
+
+    def tick():
+        while not running.is_set():
+            ticks.append(1)
+
+    thread = threading.Thread(target=tick)
+    thread.start()
+    for _ in range(5):
+        assert model.execute() == edgerunner.STATUS.SUCCESS
+    running.set()
+    thread.join()
+
+    assert ticks
+
+
+def test_timeout():
+    model = edgerunner.create_model(MODEL_PATH)
+    assert model is not None
+
+    timeout = timedelta(microseconds=1)
+    assert model.execute(timeout) == edgerunner.STATUS.FAIL
+
+    # the model remains usable after a cancelled execution
+    assert model.execute(timedelta(seconds=60)) == edgerunner.STATUS.SUCCESS
+    assert model.cancel() == edgerunner.STATUS.SUCCESS
+    assert model.execute() == edgerunner.STATUS.SUCCESS
+
+
+if __name__ == "__main__":
+    test_bad_model()
+    test_zero_copy()
+    test_execute_releases_gil()
+    test_timeout()
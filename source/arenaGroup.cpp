@@ -0,0 +1,46 @@
+#include <mutex>
+
+#include "edgerunner/arenaGroup.hpp"
+
+#include "edgerunner/model.hpp"
+
+namespace edge {
+
+auto ArenaGroup::acquire(Member& member, std::unique_lock<std::mutex>& lock)
+    -> STATUS {
+    lock = std::unique_lock<std::mutex>(m_mutex);
+
+    if (m_active == &member) {
+        return STATUS::SUCCESS;
+    }
+
+    if (m_active != nullptr) {
+        /* a member that failed to release still gives up the group */
+        m_active->releaseScratch();
+        m_active = nullptr;
+    }
+
+    if (member.acquireScratch() != STATUS::SUCCESS) {
+        return STATUS::FAIL;
+    }
+
+    m_active = &member;
+
+    return STATUS::SUCCESS;
+}
+
+void ArenaGroup::deactivate(const Member& member) {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_active == &member) {
+        m_active = nullptr;
+    }
+}
+
+auto ArenaGroup::isActive(const Member& member) -> bool {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_active == &member;
+}
+
+}  // namespace edge
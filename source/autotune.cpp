@@ -0,0 +1,494 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "edgerunner/autotune.hpp"
+
+#include <fmt/core.h>
+#include <nonstd/span.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+#    include <sys/utsname.h>
+#endif
+
+#include "edgerunner/hash.hpp"
+#include "edgerunner/model.hpp"
+#include "edgerunner/tensor.hpp"
+#include "edgerunner/trace.hpp"
+
+namespace edge {
+
+namespace {
+
+/* serializes cache updates between threads */
+auto getCacheMutex() -> std::mutex& {
+    static std::mutex cacheMutex;
+    return cacheMutex;
+}
+
+auto hashString(const std::string& value, const uint64_t seed) -> uint64_t {
+    return hashBytes(
+        {reinterpret_cast<const uint8_t*> /* NOLINT */ (value.data()),
+         value.size()},
+        seed);
+}
+
+auto getCpuModel() -> std::string {
+    std::ifstream cpuInfo("/proc/cpuinfo");
+
+    std::string line;
+    while (std::getline(cpuInfo, line)) {
+        /* x86 reports "model name", arm reports "Hardware" or "CPU part" */
+        if (line.rfind("model name", 0) == 0 || line.rfind("Hardware", 0) == 0
+            || line.rfind("CPU part", 0) == 0)
+        {
+            return line;
+        }
+    }
+
+    return {};
+}
+
+auto halfToFloat(const uint16_t half) -> float {
+    const uint32_t sign = (half & 0x8000U) << 16U;
+    uint32_t exponent = (half >> 10U) & 0x1FU;
+    uint32_t mantissa = half & 0x3FFU;
+
+    uint32_t bits = 0;
+    if (exponent == 0) {
+        if (mantissa != 0) {
+            /* subnormal, renormalize */
+            exponent = 127 - 15 + 1;
+            while ((mantissa & 0x400U) == 0) {
+                mantissa <<= 1U;
+                --exponent;
+            }
+            mantissa &= 0x3FFU;
+            bits = sign | (exponent << 23U) | (mantissa << 13U);
+        } else {
+            bits = sign;
+        }
+    } else if (exponent == 0x1FU) {
+        bits = sign | 0x7F800000U | (mantissa << 13U);
+    } else {
+        bits = sign | ((exponent + 127 - 15) << 23U) | (mantissa << 13U);
+    }
+
+    float value {};
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+template<typename T>
+void appendAs(const nonstd::span<const uint8_t> bytes,
+              std::vector<double>& values) {
+    const auto numElements = bytes.size() / sizeof(T);
+    for (size_t i = 0; i < numElements; ++i) {
+        T element {};
+        std::memcpy(&element, bytes.data() + i * sizeof(T) /* NOLINT */,
+                    sizeof(T));
+        values.push_back(static_cast<double>(element));
+    }
+}
+
+/**
+ * @brief A copy of the contents of a tensor
+ */
+struct TensorData {
+    TensorType type {};
+    std::vector<uint8_t> bytes;
+
+    auto toValues() const -> std::vector<double> {
+        std::vector<double> values;
+        const nonstd::span<const uint8_t> data {bytes.data(), bytes.size()};
+
+        switch (type) {
+            case TensorType::FLOAT16: {
+                const auto numElements = data.size() / sizeof(uint16_t);
+                for (size_t i = 0; i < numElements; ++i) {
+                    uint16_t half {};
+                    std::memcpy(&half,
+                                data.data() + i * sizeof(half) /* NOLINT */,
+                                sizeof(half));
+                    values.push_back(halfToFloat(half));
+                }
+                break;
+            }
+            case TensorType::FLOAT32:
+                appendAs<float>(data, values);
+                break;
+            case TensorType::INT8:
+                appendAs<int8_t>(data, values);
+                break;
+            case TensorType::INT16:
+                appendAs<int16_t>(data, values);
+                break;
+            case TensorType::INT32:
+                appendAs<int32_t>(data, values);
+                break;
+            case TensorType::UINT16:
+                appendAs<uint16_t>(data, values);
+                break;
+            case TensorType::UINT32:
+                appendAs<uint32_t>(data, values);
+                break;
+            default:
+                appendAs<uint8_t>(data, values);
+                break;
+        }
+
+        return values;
+    }
+};
+
+auto snapshotTensors(const std::vector<std::shared_ptr<Tensor>>& tensors)
+    -> std::vector<TensorData> {
+    std::vector<TensorData> copies;
+    copies.reserve(tensors.size());
+
+    for (const auto& tensor : tensors) {
+        const auto bytes = tensor->getTensorAs<uint8_t>();
+        copies.push_back({tensor->getType(), {bytes.begin(), bytes.end()}});
+    }
+
+    return copies;
+}
+
+void restoreTensors(const std::vector<TensorData>& copies,
+                    const std::vector<std::shared_ptr<Tensor>>& tensors) {
+    for (size_t i = 0; i < copies.size() && i < tensors.size(); ++i) {
+        auto destination = tensors[i]->getTensorAs<uint8_t>();
+        std::copy_n(copies[i].bytes.cbegin(),
+                    std::min(copies[i].bytes.size(), destination.size()),
+                    destination.begin());
+    }
+}
+
+/* root mean square difference relative to the root mean square reference */
+auto getRelativeError(const std::vector<TensorData>& reference,
+                      const std::vector<TensorData>& outputs) -> double {
+    if (reference.size() != outputs.size()) {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    double squaredError = 0.0;
+    double squaredReference = 0.0;
+    for (size_t i = 0; i < reference.size(); ++i) {
+        const auto referenceValues = reference[i].toValues();
+        const auto outputValues = outputs[i].toValues();
+        if (referenceValues.size() != outputValues.size()) {
+            return std::numeric_limits<double>::infinity();
+        }
+
+        for (size_t j = 0; j < referenceValues.size(); ++j) {
+            const auto error = outputValues[j] - referenceValues[j];
+            squaredError += error * error;
+            squaredReference += referenceValues[j] * referenceValues[j];
+        }
+    }
+
+    if (std::isnan(squaredError)) {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    return std::sqrt(squaredError / std::max(squaredReference, 1e-12));
+}
+
+auto getThreadCounts(const AutotuneOptions& options) -> std::vector<size_t> {
+    if (!options.threadCounts.empty()) {
+        return options.threadCounts;
+    }
+
+    const size_t numHardwareThreads =
+        std::max(std::thread::hardware_concurrency(), 1U);
+
+    std::vector<size_t> threadCounts;
+    for (const size_t threadCount : {size_t {1}, size_t {2}, size_t {4}}) {
+        if (threadCount < numHardwareThreads) {
+            threadCounts.push_back(threadCount);
+        }
+    }
+    threadCounts.push_back(numHardwareThreads);
+
+    return threadCounts;
+}
+
+/* median latency in milliseconds, empty if an execution failed */
+auto benchmark(Model& model,
+               const std::vector<TensorData>& inputs,
+               const AutotuneOptions& options) -> std::optional<double> {
+    restoreTensors(inputs, model.getInputs());
+
+    for (size_t i = 0; i < options.warmupRuns; ++i) {
+        if (model.execute() != STATUS::SUCCESS) {
+            return std::nullopt;
+        }
+    }
+
+    std::vector<double> latencies;
+    latencies.reserve(options.numRuns);
+    for (size_t i = 0; i < std::max<size_t>(options.numRuns, 1); ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        if (model.execute() != STATUS::SUCCESS) {
+            return std::nullopt;
+        }
+        const auto end = std::chrono::steady_clock::now();
+
+        latencies.push_back(
+            std::chrono::duration<double, std::milli>(end - start).count());
+    }
+
+    const auto median = latencies.begin()
+        + static_cast<std::ptrdiff_t>(latencies.size() / 2);
+    std::nth_element(latencies.begin(), median, latencies.end());
+
+    return *median;
+}
+
+/* apply a configuration, 0 threads keeps the backend default */
+auto configure(Model& model, const DELEGATE delegate, const size_t numThreads)
+    -> STATUS {
+    if (numThreads != model.getNumThreads()
+        && model.setNumThreads(numThreads) != STATUS::SUCCESS)
+    {
+        return STATUS::FAIL;
+    }
+
+    if (model.applyDelegate(delegate) != STATUS::SUCCESS
+        || model.getDelegate() != delegate)
+    {
+        return STATUS::FAIL;
+    }
+
+    return STATUS::SUCCESS;
+}
+
+}  // namespace
+
+auto getMachineFingerprint() -> uint64_t {
+    uint64_t fingerprint = HashOffsetBasis;
+
+#if defined(__unix__) || defined(__APPLE__)
+    utsname systemName {};
+    if (uname(&systemName) == 0) {
+        fingerprint = hashString(systemName.sysname, fingerprint);
+        fingerprint = hashString(systemName.release, fingerprint);
+        fingerprint = hashString(systemName.machine, fingerprint);
+    }
+#endif
+
+    fingerprint = hashString(getCpuModel(), fingerprint);
+    fingerprint = hashString(
+        std::to_string(std::thread::hardware_concurrency()), fingerprint);
+
+    std::string backends;
+#ifdef EDGERUNNER_TFLITE
+    backends += "tflite;";
+#endif
+#ifdef EDGERUNNER_GPU
+    backends += "gpu;";
+#endif
+#ifdef EDGERUNNER_QNN
+    backends += "qnn;";
+#endif
+
+    return hashString(backends, fingerprint);
+}
+
+AutotuneCache::AutotuneCache(std::filesystem::path path)
+    : m_path(std::move(path)) {}
+
+auto AutotuneCache::getDefaultPath() -> std::filesystem::path {
+    const auto* cacheDir = std::getenv("EDGERUNNER_CACHE_DIR");  // NOLINT
+    if (cacheDir != nullptr && *cacheDir != '\0') {
+        return std::filesystem::path {cacheDir} / "edgerunner_autotune.txt";
+    }
+
+    std::error_code errorCode;
+    const auto tempDir = std::filesystem::temp_directory_path(errorCode);
+
+    return (errorCode ? std::filesystem::path {"."} : tempDir)
+        / "edgerunner_autotune.txt";
+}
+
+auto AutotuneCache::find(const uint64_t modelHash,
+                         const uint64_t fingerprint) const
+    -> std::optional<AutotuneDecision> {
+    const std::lock_guard<std::mutex> lock(getCacheMutex());
+
+    std::ifstream file(m_path);
+
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream entry(line);
+
+        uint64_t entryModelHash {};
+        uint64_t entryFingerprint {};
+        unsigned delegate {};
+        AutotuneDecision decision;
+        if (!(entry >> std::hex >> entryModelHash >> entryFingerprint
+              >> std::dec >> delegate >> decision.numThreads
+              >> decision.latencyMs))
+        {
+            continue;
+        }
+
+        if (entryModelHash == modelHash && entryFingerprint == fingerprint) {
+            decision.delegate = static_cast<DELEGATE>(delegate);
+            return decision;
+        }
+    }
+
+    return std::nullopt;
+}
+
+auto AutotuneCache::store(const uint64_t modelHash,
+                          const uint64_t fingerprint,
+                          const AutotuneDecision& decision) -> STATUS {
+    const std::lock_guard<std::mutex> lock(getCacheMutex());
+
+    const auto key = fmt::format("{:016x} {:016x} ", modelHash, fingerprint);
+
+    /* keep the decisions of other models and machines */
+    std::vector<std::string> lines;
+    {
+        std::ifstream file(m_path);
+        std::string line;
+        while (std::getline(file, line)) {
+            if (!line.empty() && line.rfind(key, 0) != 0) {
+                lines.push_back(line);
+            }
+        }
+    }
+
+    lines.push_back(fmt::format("{}{} {} {:.3f}",
+                                key,
+                                static_cast<unsigned>(decision.delegate),
+                                decision.numThreads,
+                                decision.latencyMs));
+
+    std::error_code errorCode;
+    if (m_path.has_parent_path()) {
+        std::filesystem::create_directories(m_path.parent_path(), errorCode);
+    }
+
+    /* write then rename, such that readers never see a partial file */
+    auto tempPath = m_path;
+    tempPath += ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::trunc);
+        for (const auto& line : lines) {
+            file << line << '\n';
+        }
+
+        if (!file.flush()) {
+            return STATUS::FAIL;
+        }
+    }
+
+    std::filesystem::rename(tempPath, m_path, errorCode);
+
+    return errorCode ? STATUS::FAIL : STATUS::SUCCESS;
+}
+
+auto Model::autotune(const AutotuneOptions& options) -> STATUS {
+    const TraceScope trace {"autotune", name().c_str()};
+
+    AutotuneCache cache {options.cachePath.empty()
+                             ? AutotuneCache::getDefaultPath()
+                             : options.cachePath};
+    const auto fingerprint = getMachineFingerprint();
+
+    const auto inputs = snapshotTensors(getInputs());
+
+    if (!options.force && getModelHash() != 0) {
+        const auto decision = cache.find(getModelHash(), fingerprint);
+        if (decision.has_value()
+            && configure(*this, decision->delegate, decision->numThreads)
+                == STATUS::SUCCESS)
+        {
+            restoreTensors(inputs, getInputs());
+            return STATUS::SUCCESS;
+        }
+    }
+
+    const auto initialDelegate = getDelegate();
+    const auto initialNumThreads = getNumThreads();
+
+    /* CPU first, its outputs are the reference for other delegates */
+    std::optional<std::vector<TensorData>> reference;
+    std::optional<AutotuneDecision> best;
+
+    for (const auto delegate : {DELEGATE::CPU, DELEGATE::GPU, DELEGATE::NPU}) {
+        /* thread counts only matter on CPU, and only if supported */
+        std::vector<size_t> threadCounts {initialNumThreads};
+        if (delegate == DELEGATE::CPU
+            && setNumThreads(initialNumThreads) == STATUS::SUCCESS)
+        {
+            threadCounts = getThreadCounts(options);
+        }
+
+        for (const auto numThreads : threadCounts) {
+            if (configure(*this, delegate, numThreads) != STATUS::SUCCESS) {
+                break;
+            }
+
+            const auto latency = benchmark(*this, inputs, options);
+            if (!latency.has_value()) {
+                break;
+            }
+
+            auto outputs = snapshotTensors(getOutputs());
+            if (!reference.has_value()) {
+                reference = std::move(outputs);
+            } else if (getRelativeError(*reference, outputs)
+                       > options.tolerance)
+            {
+                break;
+            }
+
+            if (!best.has_value() || *latency < best->latencyMs) {
+                best = AutotuneDecision {delegate, numThreads, *latency};
+            }
+        }
+    }
+
+    if (!best.has_value()) {
+        configure(*this, initialDelegate, initialNumThreads);
+        restoreTensors(inputs, getInputs());
+        return STATUS::FAIL;
+    }
+
+    const auto status = configure(*this, best->delegate, best->numThreads);
+    restoreTensors(inputs, getInputs());
+
+    if (status != STATUS::SUCCESS) {
+        return STATUS::FAIL;
+    }
+
+    if (getModelHash() != 0) {
+        /* a decision that cannot be persisted still applies to this run */
+        cache.store(getModelHash(), fingerprint, *best);
+    }
+
+    return STATUS::SUCCESS;
+}
+
+}  // namespace edge
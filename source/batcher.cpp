@@ -0,0 +1,213 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <future>
+#include <iterator>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "edgerunner/batcher.hpp"
+
+#include "edgerunner/model.hpp"
+#include "edgerunner/tensor.hpp"
+#include "edgerunner/trace.hpp"
+
+namespace edge {
+
+namespace {
+
+auto getBatchDimension(const Tensor& tensor) -> size_t {
+    const auto dimensions = tensor.getDimensions();
+
+    return dimensions.empty() || dimensions.front() == 0 ? 1
+                                                         : dimensions.front();
+}
+
+}  // namespace
+
+Batcher::Batcher(Model& model, const BatcherOptions& options)
+    : m_model(model)
+    , m_options(options) {
+    m_options.maxBatchSize = std::max<size_t>(m_options.maxBatchSize, 1);
+
+    const auto numInputs = m_model.getNumInputs();
+    m_inputSampleSizes.reserve(numInputs);
+    for (size_t i = 0; i < numInputs; ++i) {
+        auto input = m_model.getInput(i);
+        m_batchSize = getBatchDimension(*input);
+        m_inputSampleSizes.push_back(input->getTensorAs<uint8_t>().size()
+                                     / m_batchSize);
+    }
+
+    m_worker = std::thread(&Batcher::run, this);
+}
+
+Batcher::~Batcher() {
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_condition.notify_all();
+
+    m_worker.join();
+}
+
+auto Batcher::submit(std::vector<std::vector<uint8_t>> inputs)
+    -> std::future<BatchResult> {
+    Pending pending {std::move(inputs), Clock::now(), {}};
+    auto future = pending.promise.get_future();
+
+    bool valid = pending.inputs.size() == m_inputSampleSizes.size();
+    for (size_t i = 0; valid && i < pending.inputs.size(); ++i) {
+        valid = pending.inputs[i].size() == m_inputSampleSizes[i];
+    }
+
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        if (!valid || m_stopping) {
+            pending.promise.set_value({STATUS::FAIL, {}});
+            return future;
+        }
+
+        m_queue.push_back(std::move(pending));
+    }
+    m_condition.notify_all();
+
+    return future;
+}
+
+auto Batcher::getInputSampleSize(const size_t index) const -> size_t {
+    return index < m_inputSampleSizes.size() ? m_inputSampleSizes[index] : 0;
+}
+
+auto Batcher::getStats() const -> BatcherStats {
+    return {m_latency.snapshot(),
+            m_requests.load(std::memory_order_relaxed),
+            m_batches.load(std::memory_order_relaxed)};
+}
+
+void Batcher::run() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_condition.wait(lock,
+                         [this]() { return m_stopping || !m_queue.empty(); });
+
+        if (m_queue.empty()) {
+            return;
+        }
+
+        /* wait for a full batch, at most maxWait after the oldest request */
+        const auto flushTime = m_queue.front().submitted + m_options.maxWait;
+        m_condition.wait_until(lock, flushTime, [this]() {
+            return m_stopping || m_queue.size() >= m_options.maxBatchSize;
+        });
+
+        const auto batchSize = std::min(m_queue.size(), m_options.maxBatchSize);
+        std::vector<Pending> batch {
+            std::make_move_iterator(m_queue.begin()),
+            std::make_move_iterator(
+                std::next(m_queue.begin(), static_cast<ptrdiff_t>(batchSize)))};
+        m_queue.erase(m_queue.begin(),
+                      std::next(m_queue.begin(),
+                                static_cast<ptrdiff_t>(batchSize)));
+
+        lock.unlock();
+        executeBatch(batch);
+        lock.lock();
+    }
+}
+
+auto Batcher::resizeBatch(const size_t batchSize) -> STATUS {
+    if (!m_resizable || batchSize == m_batchSize) {
+        return m_resizable ? STATUS::SUCCESS : STATUS::FAIL;
+    }
+
+    const auto resize = [this](const size_t size) {
+        for (size_t i = 0; i < m_model.getNumInputs(); ++i) {
+            auto dimensions = m_model.getInput(i)->getDimensions();
+            if (dimensions.empty()) {
+                return STATUS::FAIL;
+            }
+
+            dimensions.front() = size;
+            if (m_model.resizeInput(i, dimensions) != STATUS::SUCCESS) {
+                return STATUS::FAIL;
+            }
+        }
+
+        return STATUS::SUCCESS;
+    };
+
+    if (resize(batchSize) != STATUS::SUCCESS) {
+        /* fall back to the batch size of the model from now on */
+        m_resizable = false;
+        resize(m_batchSize);
+        return STATUS::FAIL;
+    }
+
+    m_batchSize = batchSize;
+
+    return STATUS::SUCCESS;
+}
+
+void Batcher::executeBatch(std::vector<Pending>& batch) {
+    const TraceScope trace {"batch", m_model.name().c_str()};
+
+    /* grow once to the largest batch, partial batches are zero-filled
+     * rather than reallocating the model for every batch size */
+    if (batch.size() > m_batchSize) {
+        resizeBatch(m_options.maxBatchSize);
+    }
+
+    for (size_t offset = 0; offset < batch.size(); offset += m_batchSize) {
+        const auto numSamples = std::min(m_batchSize, batch.size() - offset);
+
+        /* pack the samples, zero-filling unused samples */
+        for (size_t i = 0; i < m_inputSampleSizes.size(); ++i) {
+            const auto sampleSize = m_inputSampleSizes[i];
+            auto* data = m_model.getInput(i)->getTensorAs<uint8_t>().data();
+
+            for (size_t j = 0; j < numSamples; ++j) {
+                std::memcpy(data + j * sampleSize,
+                            batch[offset + j].inputs[i].data(),
+                            sampleSize);
+            }
+            std::memset(data + numSamples * sampleSize,
+                        0,
+                        (m_batchSize - numSamples) * sampleSize);
+        }
+
+        const auto status = m_model.execute();
+        m_batches.fetch_add(1, std::memory_order_relaxed);
+
+        /* scatter the outputs */
+        for (size_t j = 0; j < numSamples; ++j) {
+            BatchResult result {status, {}};
+
+            if (status == STATUS::SUCCESS) {
+                result.outputs.reserve(m_model.getNumOutputs());
+                for (size_t i = 0; i < m_model.getNumOutputs(); ++i) {
+                    const auto output =
+                        m_model.getOutput(i)->getTensorAs<uint8_t>();
+                    const auto sampleSize = output.size() / m_batchSize;
+                    const auto* data = output.data() + j * sampleSize;
+                    result.outputs.emplace_back(data, data + sampleSize);
+                }
+            }
+
+            auto& pending = batch[offset + j];
+            const auto latency =
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    Clock::now() - pending.submitted);
+            m_latency.record(static_cast<uint64_t>(latency.count()));
+            m_requests.fetch_add(1, std::memory_order_relaxed);
+
+            pending.promise.set_value(std::move(result));
+        }
+    }
+}
+
+}  // namespace edge
@@ -0,0 +1,393 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "edgerunner/bundle.hpp"
+
+#include <nonstd/span.hpp>
+
+#include "edgerunner/alignedBuffer.hpp"
+#include "edgerunner/model.hpp"
+#include "edgerunner/trace.hpp"
+
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#else
+#    include <process.h>
+#endif
+
+namespace edge {
+
+namespace {
+
+constexpr std::array<char, 8> Magic {'E', 'D', 'G', 'E', 'B', 'N', 'D', 'L'};
+constexpr uint32_t Version = 1;
+constexpr size_t NameSize = 40;
+
+struct Header {
+    std::array<char, 8> magic;
+    uint32_t version;
+    uint32_t numSections;
+};
+
+struct Entry {
+    uint32_t type;
+    uint32_t delegate;
+    uint64_t offset;
+    uint64_t size;
+    std::array<char, NameSize> name;
+};
+
+static_assert(sizeof(Header) == 16 && sizeof(Entry) == 64,
+              "the bundle layout must not contain padding");
+
+/* structs are copied in host byte order, which must match the little-endian
+ * layout. Compilers without __BYTE_ORDER__ (MSVC) only target little-endian */
+#ifdef __BYTE_ORDER__
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__,
+              "bundles are only read and written on little-endian hosts");
+#endif
+
+template<typename T>
+auto readStruct(const uint8_t* data) -> T {
+    T value {};
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+template<typename T>
+void appendStruct(std::vector<uint8_t>& bytes, const T& value) {
+    const auto* data = reinterpret_cast<const uint8_t*> /* NOLINT */ (&value);
+    bytes.insert(bytes.end(), data, data + sizeof(T));
+}
+
+auto isKnownSection(const uint32_t type) -> bool {
+    return type >= static_cast<uint32_t>(SECTION::TFLITE)
+        && type <= static_cast<uint32_t>(SECTION::METADATA);
+}
+
+auto isKnownDelegate(const uint32_t delegate) -> bool {
+    return delegate <= static_cast<uint32_t>(DELEGATE::NPU);
+}
+
+/* unique per process and write, such that concurrent writers of a bundle do
+ * not write to the same temporary file */
+auto getTemporaryPath(const std::filesystem::path& bundlePath)
+    -> std::filesystem::path {
+    static std::atomic<uint64_t> numWrites {0};
+
+#ifndef _WIN32
+    const auto processId = getpid();
+#else
+    const auto processId = _getpid();
+#endif
+
+    auto temporaryPath = bundlePath;
+    temporaryPath += "." + std::to_string(processId) + "."
+        + std::to_string(numWrites.fetch_add(1)) + ".tmp";
+    return temporaryPath;
+}
+
+/* flushes a file or directory to storage */
+auto syncPath(const std::filesystem::path& path) -> STATUS {
+#ifndef _WIN32
+    const auto fileDescriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fileDescriptor < 0) {
+        return STATUS::FAIL;
+    }
+
+    const auto status = fsync(fileDescriptor) == 0 ? STATUS::SUCCESS
+                                                   : STATUS::FAIL;
+    close(fileDescriptor);
+    return status;
+#else
+    static_cast<void>(path);
+    return STATUS::SUCCESS;
+#endif
+}
+
+}  // namespace
+
+auto Bundle::open(const std::filesystem::path& bundlePath)
+    -> std::shared_ptr<Bundle> {
+    const TraceScope trace {"openBundle"};
+
+    std::shared_ptr<Bundle> bundle {new Bundle()};
+    bundle->m_name = bundlePath.stem().string();
+
+#ifndef _WIN32
+    const auto fileDescriptor = ::open(bundlePath.c_str(), O_RDONLY);
+    if (fileDescriptor < 0) {
+        return nullptr;
+    }
+
+    struct stat status {};
+    if (fstat(fileDescriptor, &status) != 0 || status.st_size <= 0) {
+        close(fileDescriptor);
+        return nullptr;
+    }
+
+    /* copy-on-write, backends may require writable buffers */
+    auto* data = mmap(nullptr,
+                      static_cast<size_t>(status.st_size),
+                      PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE,
+                      fileDescriptor,
+                      0);
+    close(fileDescriptor);
+
+    if (data == MAP_FAILED) {
+        return nullptr;
+    }
+
+    bundle->m_data = static_cast<uint8_t*>(data);
+    bundle->m_size = static_cast<size_t>(status.st_size);
+#else
+    std::error_code errorCode;
+    const auto fileSize = std::filesystem::file_size(bundlePath, errorCode);
+    std::ifstream file(bundlePath, std::ios::binary);
+    if (errorCode || fileSize == 0 || !file) {
+        return nullptr;
+    }
+
+    bundle->m_buffer = AlignedBuffer {static_cast<size_t>(fileSize),
+                                      SectionAlignment};
+    if (bundle->m_buffer.data() == nullptr
+        || !file.read(
+            reinterpret_cast<char*> /* NOLINT */ (bundle->m_buffer.data()),
+            static_cast<std::streamsize>(fileSize)))
+    {
+        return nullptr;
+    }
+
+    bundle->m_data = bundle->m_buffer.data();
+    bundle->m_size = bundle->m_buffer.size();
+#endif
+
+    if (bundle->parse() != STATUS::SUCCESS) {
+        return nullptr;
+    }
+
+    return bundle;
+}
+
+Bundle::~Bundle() {
+#ifndef _WIN32
+    if (m_data != nullptr) {
+        munmap(m_data, m_size);
+    }
+#endif
+}
+
+auto Bundle::parse() -> STATUS {
+    if (m_size < sizeof(Header)) {
+        return STATUS::FAIL;
+    }
+
+    const auto header = readStruct<Header>(m_data);
+    if (header.magic != Magic || header.version != Version
+        || header.numSections > (m_size - sizeof(Header)) / sizeof(Entry))
+    {
+        return STATUS::FAIL;
+    }
+
+    m_sections.reserve(header.numSections);
+    for (size_t i = 0; i < header.numSections; ++i) {
+        const auto entry =
+            readStruct<Entry>(m_data + sizeof(Header) + i * sizeof(Entry));
+
+        if (!isKnownSection(entry.type) || !isKnownDelegate(entry.delegate)
+            || entry.offset % SectionAlignment != 0 || entry.offset > m_size
+            || entry.size > m_size - entry.offset
+            || entry.name.back() != '\0')
+        {
+            return STATUS::FAIL;
+        }
+
+        m_sections.push_back(
+            {static_cast<SECTION>(entry.type),
+             static_cast<DELEGATE>(entry.delegate),
+             entry.name.data(),
+             {m_data + entry.offset, static_cast<size_t>(entry.size)}});
+    }
+
+    return STATUS::SUCCESS;
+}
+
+auto Bundle::getSection(const SECTION type, const std::string& name) const
+    -> nonstd::span<uint8_t> {
+    const auto section = std::find_if(
+        m_sections.cbegin(),
+        m_sections.cend(),
+        [type, &name](const BundleSection& bundleSection) {
+            return bundleSection.type == type
+                && (name.empty() || bundleSection.name == name);
+        });
+
+    return section != m_sections.cend() ? section->data
+                                        : nonstd::span<uint8_t> {};
+}
+
+auto Bundle::getDelegateCache(const DELEGATE delegate) const
+    -> nonstd::span<uint8_t> {
+    const auto section = std::find_if(
+        m_sections.cbegin(),
+        m_sections.cend(),
+        [delegate](const BundleSection& bundleSection) {
+            return bundleSection.type == SECTION::QNN_CONTEXT
+                && bundleSection.delegate == delegate;
+        });
+
+    return section != m_sections.cend() ? section->data
+                                        : nonstd::span<uint8_t> {};
+}
+
+auto Bundle::getLabels() const -> std::vector<std::string_view> {
+    const auto section = getSection(SECTION::LABELS);
+    const std::string_view labels {
+        reinterpret_cast<const char*> /* NOLINT */ (section.data()),
+        section.size()};
+
+    std::vector<std::string_view> result;
+    size_t start = 0;
+    while (start < labels.size()) {
+        auto end = labels.find('\n', start);
+        if (end == std::string_view::npos) {
+            end = labels.size();
+        }
+
+        auto label = labels.substr(start, end - start);
+        if (!label.empty() && label.back() == '\r') {
+            label.remove_suffix(1);
+        }
+        result.push_back(label);
+
+        start = end + 1;
+    }
+
+    return result;
+}
+
+auto Bundle::getMetadata(const std::string& name) const -> std::string_view {
+    const auto section = getSection(SECTION::METADATA, name);
+
+    return {reinterpret_cast<const char*> /* NOLINT */ (section.data()),
+            section.size()};
+}
+
+auto BundleWriter::addSection(const SECTION type,
+                              std::vector<uint8_t> data,
+                              const std::string& name,
+                              const DELEGATE delegate) -> STATUS {
+    if (name.size() >= NameSize) {
+        return STATUS::FAIL;
+    }
+
+    m_sections.push_back({type, delegate, name, std::move(data)});
+
+    return STATUS::SUCCESS;
+}
+
+auto BundleWriter::addFile(const SECTION type,
+                           const std::filesystem::path& path,
+                           const std::string& name,
+                           const DELEGATE delegate) -> STATUS {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return STATUS::FAIL;
+    }
+
+    std::vector<uint8_t> data {std::istreambuf_iterator<char>(file),
+                               std::istreambuf_iterator<char>()};
+
+    return addSection(type, std::move(data), name, delegate);
+}
+
+auto BundleWriter::write(const std::filesystem::path& bundlePath) const
+    -> STATUS {
+    std::vector<uint8_t> index;
+
+    const Header header {Magic, Version, static_cast<uint32_t>(m_sections.size())};
+    appendStruct(index, header);
+
+    /* sections follow the index, each padded to the section alignment */
+    auto offset = AlignedBuffer::alignUp(
+        sizeof(Header) + m_sections.size() * sizeof(Entry),
+        Bundle::SectionAlignment);
+    for (const auto& section : m_sections) {
+        Entry entry {static_cast<uint32_t>(section.type),
+                     static_cast<uint32_t>(section.delegate),
+                     offset,
+                     section.data.size(),
+                     {}};
+        std::copy(section.name.cbegin(), section.name.cend(),
+                  entry.name.begin());
+        appendStruct(index, entry);
+
+        offset = AlignedBuffer::alignUp(offset + section.data.size(),
+                                        Bundle::SectionAlignment);
+    }
+
+    /* replaces an existing bundle atomically */
+    const auto temporaryPath = getTemporaryPath(bundlePath);
+
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+
+        const auto writePadded = [&file](const std::vector<uint8_t>& bytes) {
+            const auto padding =
+                AlignedBuffer::alignUp(bytes.size(), Bundle::SectionAlignment)
+                - bytes.size();
+            const std::vector<char> zeros(padding);
+
+            file.write(reinterpret_cast<const char*> /* NOLINT */ (bytes.data()),
+                       static_cast<std::streamsize>(bytes.size()));
+            file.write(zeros.data(), static_cast<std::streamsize>(padding));
+        };
+
+        writePadded(index);
+        for (const auto& section : m_sections) {
+            writePadded(section.data);
+        }
+
+        if (!file.flush()) {
+            std::filesystem::remove(temporaryPath);
+            return STATUS::FAIL;
+        }
+    }
+
+    /* the contents must be stored before the rename, otherwise a crash can
+     * leave an empty or partial bundle at bundlePath */
+    std::error_code errorCode;
+    if (syncPath(temporaryPath) != STATUS::SUCCESS) {
+        std::filesystem::remove(temporaryPath, errorCode);
+        return STATUS::FAIL;
+    }
+
+    std::filesystem::rename(temporaryPath, bundlePath, errorCode);
+    if (errorCode) {
+        std::filesystem::remove(temporaryPath, errorCode);
+        return STATUS::FAIL;
+    }
+
+    /* persists the rename */
+    const auto directory = bundlePath.parent_path();
+    return syncPath(directory.empty() ? "." : directory);
+}
+
+}  // namespace edge
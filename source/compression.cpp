@@ -0,0 +1,262 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+#include "edgerunner/compression.hpp"
+
+#include <nonstd/span.hpp>
+
+#include "edgerunner/alignedBuffer.hpp"
+#include "edgerunner/trace.hpp"
+
+#ifdef EDGERUNNER_COMPRESSION
+#    include <lz4frame.h>
+#    include <zstd.h>
+#endif
+
+namespace edge {
+
+#ifdef EDGERUNNER_COMPRESSION
+
+namespace {
+
+/* size of the compressed chunks read from the file */
+constexpr size_t ChunkSize = 1024 * 1024;
+
+/* initial buffer size relative to the file size when the content size is not
+ * recorded in the frame header */
+constexpr size_t UnknownSizeRatio = 4;
+
+/* only used when the content size is unknown or exceeded */
+auto grow(AlignedBuffer& buffer, const size_t used) -> bool {
+    AlignedBuffer grown {std::max(2 * buffer.size(), ChunkSize)};
+    if (grown.data() == nullptr) {
+        return false;
+    }
+
+    std::copy_n(buffer.data(), used, grown.data());
+    buffer = std::move(grown);
+
+    return true;
+}
+
+auto readChunk(std::ifstream& file, std::vector<char>& chunk) -> size_t {
+    file.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+    return static_cast<size_t>(file.gcount());
+}
+
+auto initialSize(const std::filesystem::path& modelPath,
+                 const uint64_t contentSize) -> size_t {
+    if (contentSize > 0) {
+        return static_cast<size_t>(contentSize);
+    }
+
+    std::error_code errorCode;
+    const auto fileSize = std::filesystem::file_size(modelPath, errorCode);
+
+    return std::max(errorCode ? 0 : UnknownSizeRatio * fileSize, ChunkSize);
+}
+
+auto decompressZstd(const std::filesystem::path& modelPath,
+                    std::ifstream& file,
+                    AlignedBuffer& buffer) -> size_t {
+    const std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> context {
+        ZSTD_createDCtx(), &ZSTD_freeDCtx};
+    if (context == nullptr) {
+        return 0;
+    }
+
+    std::vector<char> chunk(ChunkSize);
+    auto chunkSize = readChunk(file, chunk);
+
+    auto contentSize = ZSTD_getFrameContentSize(chunk.data(), chunkSize);
+    if (contentSize == ZSTD_CONTENTSIZE_ERROR) {
+        return 0;
+    }
+    if (contentSize == ZSTD_CONTENTSIZE_UNKNOWN) {
+        contentSize = 0;
+    }
+
+    buffer = AlignedBuffer {initialSize(modelPath, contentSize)};
+
+    size_t used = 0;
+    size_t remaining = 0; /* 0 once a frame is complete and flushed */
+    while (chunkSize > 0) {
+        ZSTD_inBuffer input {chunk.data(), chunkSize, 0};
+
+        while (input.pos < input.size) {
+            if (buffer.data() == nullptr) {
+                return 0;
+            }
+
+            const auto consumed = input.pos;
+            ZSTD_outBuffer output {buffer.data(), buffer.size(), used};
+            remaining = ZSTD_decompressStream(context.get(), &output, &input);
+            if (ZSTD_isError(remaining) != 0U) {
+                return 0;
+            }
+
+            /* no progress, the buffer is full */
+            const auto progressed = output.pos > used || input.pos > consumed;
+            used = output.pos;
+            if (!progressed && !grow(buffer, used)) {
+                return 0;
+            }
+        }
+
+        chunkSize = readChunk(file, chunk);
+    }
+
+    /* flush output held back by the decoder */
+    while (remaining != 0) {
+        if (used == buffer.size() && !grow(buffer, used)) {
+            return 0;
+        }
+
+        ZSTD_inBuffer input {nullptr, 0, 0};
+        ZSTD_outBuffer output {buffer.data(), buffer.size(), used};
+        remaining = ZSTD_decompressStream(context.get(), &output, &input);
+        if (ZSTD_isError(remaining) != 0U) {
+            return 0;
+        }
+
+        /* truncated file */
+        if (output.pos == used && used < buffer.size()) {
+            return 0;
+        }
+        used = output.pos;
+    }
+
+    return used;
+}
+
+auto decompressLz4(const std::filesystem::path& modelPath,
+                   std::ifstream& file,
+                   AlignedBuffer& buffer) -> size_t {
+    LZ4F_dctx* dctx = nullptr;
+    if (LZ4F_isError(LZ4F_createDecompressionContext(&dctx, LZ4F_VERSION))
+        != 0U)
+    {
+        return 0;
+    }
+    const std::unique_ptr<LZ4F_dctx, decltype(&LZ4F_freeDecompressionContext)>
+        context {dctx, &LZ4F_freeDecompressionContext};
+
+    std::vector<char> chunk(ChunkSize);
+    auto chunkSize = readChunk(file, chunk);
+
+    LZ4F_frameInfo_t frameInfo {};
+    size_t offset = chunkSize;
+    size_t remaining =
+        LZ4F_getFrameInfo(context.get(), &frameInfo, chunk.data(), &offset);
+    if (LZ4F_isError(remaining) != 0U) {
+        return 0;
+    }
+
+    buffer = AlignedBuffer {initialSize(modelPath, frameInfo.contentSize)};
+
+    size_t used = 0;
+    while (chunkSize > 0) {
+        while (offset < chunkSize) {
+            if (buffer.data() == nullptr) {
+                return 0;
+            }
+
+            auto outputSize = buffer.size() - used;
+            auto inputSize = chunkSize - offset;
+            remaining = LZ4F_decompress(context.get(),
+                                        buffer.data() + used,
+                                        &outputSize,
+                                        chunk.data() + offset,
+                                        &inputSize,
+                                        nullptr);
+            if (LZ4F_isError(remaining) != 0U) {
+                return 0;
+            }
+
+            offset += inputSize;
+            used += outputSize;
+
+            /* no progress, the buffer is full */
+            if (inputSize == 0 && outputSize == 0 && !grow(buffer, used)) {
+                return 0;
+            }
+        }
+
+        chunkSize = readChunk(file, chunk);
+        offset = 0;
+    }
+
+    /* flush output held back by the decoder */
+    while (remaining != 0) {
+        if (used == buffer.size() && !grow(buffer, used)) {
+            return 0;
+        }
+
+        auto outputSize = buffer.size() - used;
+        size_t inputSize = 0;
+        remaining = LZ4F_decompress(context.get(),
+                                    buffer.data() + used,
+                                    &outputSize,
+                                    nullptr,
+                                    &inputSize,
+                                    nullptr);
+        if (LZ4F_isError(remaining) != 0U) {
+            return 0;
+        }
+
+        /* truncated file */
+        if (outputSize == 0) {
+            return 0;
+        }
+        used += outputSize;
+    }
+
+    return used;
+}
+
+}  // namespace
+
+auto decompressModel(const std::filesystem::path& modelPath,
+                     AlignedBuffer& buffer) -> nonstd::span<uint8_t> {
+    const TraceScope trace {"decompressModel"};
+
+    std::ifstream file(modelPath, std::ios::binary);
+    if (!file) {
+        return {};
+    }
+
+    size_t size = 0;
+    switch (getCompression(modelPath)) {
+        case COMPRESSION::ZSTD:
+            size = decompressZstd(modelPath, file, buffer);
+            break;
+        case COMPRESSION::LZ4:
+            size = decompressLz4(modelPath, file, buffer);
+            break;
+        case COMPRESSION::NONE:
+            break;
+    }
+
+    if (size == 0) {
+        buffer = {};
+        return {};
+    }
+
+    return {buffer.data(), size};
+}
+
+#else
+
+auto decompressModel(const std::filesystem::path& /*modelPath*/,
+                     AlignedBuffer& /*buffer*/) -> nonstd::span<uint8_t> {
+    return {};
+}
+
+#endif
+
+}  // namespace edge
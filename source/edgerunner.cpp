@@ -1,13 +1,24 @@
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
+#include <future>
 #include <memory>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "edgerunner/edgerunner.hpp"
 
 #include <nonstd/span.hpp>
 
+#include "edgerunner/bundle.hpp"
+#include "edgerunner/compression.hpp"
 #include "edgerunner/model.hpp"
+#include "edgerunner/options.hpp"
+#include "edgerunner/trace.hpp"
 
 #ifdef EDGERUNNER_TFLITE
 #    include "edgerunner/tflite/model.hpp"
@@ -17,23 +28,44 @@
 #    include "edgerunner/qnn/model.hpp"
 #endif
 
+#ifdef EDGERUNNER_REMOTE
+#    include "edgerunner/remote/model.hpp"
+#endif
+
 namespace edge {
 
-auto createModel(const std::filesystem::path& modelPath)
-    -> std::unique_ptr<Model> {
-    const auto modelExtension = modelPath.extension().string().substr(1);
+auto createModel(const std::filesystem::path& modelPath,
+                 const ModelOptions& options) -> std::unique_ptr<Model> {
+    /* compressed models are dispatched on their inner extension */
+    const auto uncompressedPath = getUncompressedPath(modelPath);
+    const auto modelExtension = uncompressedPath.extension().string().substr(1);
+    const auto modelName = uncompressedPath.stem().string();
+    const TraceScope trace {"createModel", modelName.c_str()};
 
     std::unique_ptr<Model> model;
 
+#ifdef EDGERUNNER_REMOTE
+    /* models of any format are served by the daemon */
+    if (!options.remoteSocketPath.empty()) {
+        model = std::make_unique<remote::ModelImpl>(modelPath, options);
+        return model->getCreationStatus() == STATUS::SUCCESS ? std::move(model)
+                                                             : nullptr;
+    }
+#endif
+
+    if (modelExtension == "edgerunner") {
+        return createModel(Bundle::open(modelPath), options);
+    }
+
 #ifdef EDGERUNNER_TFLITE
     if (modelExtension == "tflite") {
-        model = std::make_unique<tflite::ModelImpl>(modelPath);
+        model = std::make_unique<tflite::ModelImpl>(modelPath, options);
     }
 #endif
 
 #ifdef EDGERUNNER_QNN
     if (modelExtension == "so" || modelExtension == "bin") {
-        model = std::make_unique<qnn::ModelImpl>(modelPath);
+        model = std::make_unique<qnn::ModelImpl>(modelPath, options);
     }
 #endif
 
@@ -46,18 +78,55 @@ auto createModel(const std::filesystem::path& modelPath)
 }
 
 auto createModel(const nonstd::span<uint8_t>& modelBuffer,
-                 const std::string& modelExtension) -> std::unique_ptr<Model> {
+                 const std::string& modelExtension,
+                 const ModelOptions& options) -> std::unique_ptr<Model> {
+    const TraceScope trace {"createModel", modelExtension.c_str()};
+
     std::unique_ptr<Model> model;
 
 #ifdef EDGERUNNER_TFLITE
     if (modelExtension == "tflite") {
-        model = std::make_unique<tflite::ModelImpl>(modelBuffer);
+        model = std::make_unique<tflite::ModelImpl>(modelBuffer, options);
     }
 #endif
 
 #ifdef EDGERUNNER_QNN
     if (modelExtension == "so" || modelExtension == "bin") {
-        model = std::make_unique<qnn::ModelImpl>(modelBuffer);
+        model = std::make_unique<qnn::ModelImpl>(modelBuffer, options);
+    }
+#endif
+
+    if (model != nullptr && model->getCreationStatus() == STATUS::SUCCESS) {
+        return model;
+    }
+
+    /* unsupported or failed */
+    return nullptr;
+}
+
+auto createModel(const std::shared_ptr<Bundle>& bundle,
+                 const ModelOptions& options) -> std::unique_ptr<Model> {
+    if (bundle == nullptr) {
+        return nullptr;
+    }
+
+    const TraceScope trace {"createModel", bundle->name().c_str()};
+
+    std::unique_ptr<Model> model;
+
+#ifdef EDGERUNNER_QNN
+    /* prefer the compiled cache, falling back to the flatbuffer */
+    if (!bundle->getDelegateCache(DELEGATE::NPU).empty()) {
+        model = std::make_unique<qnn::ModelImpl>(bundle, options);
+        if (model->getCreationStatus() == STATUS::SUCCESS) {
+            return model;
+        }
+    }
+#endif
+
+#ifdef EDGERUNNER_TFLITE
+    if (!bundle->getSection(SECTION::TFLITE).empty()) {
+        model = std::make_unique<tflite::ModelImpl>(bundle, options);
     }
 #endif
 
@@ -69,4 +138,47 @@ auto createModel(const nonstd::span<uint8_t>& modelBuffer,
     return nullptr;
 }
 
+auto createModelAsync(const std::filesystem::path& modelPath,
+                      const ModelOptions& options)
+    -> std::future<std::unique_ptr<Model>> {
+    return std::async(std::launch::async, [modelPath, options]() {
+        return createModel(modelPath, options);
+    });
+}
+
+auto createModels(const std::vector<std::filesystem::path>& modelPaths,
+                  const ModelOptions& options,
+                  size_t maxThreads) -> std::vector<std::unique_ptr<Model>> {
+    const TraceScope trace {"createModels"};
+
+    std::vector<std::unique_ptr<Model>> models(modelPaths.size());
+
+    if (maxThreads == 0) {
+        maxThreads = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    const auto numThreads = std::min(maxThreads, modelPaths.size());
+
+    /* workers pick the next model to load until all are claimed */
+    std::atomic<size_t> nextIndex {0};
+    const auto loadModels = [&models, &modelPaths, &options, &nextIndex]() {
+        for (auto index = nextIndex.fetch_add(1); index < modelPaths.size();
+             index = nextIndex.fetch_add(1))
+        {
+            models[index] = createModel(modelPaths[index], options);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i) {
+        workers.emplace_back(loadModels);
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    return models;
+}
+
 }  // namespace edge
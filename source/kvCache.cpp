@@ -0,0 +1,378 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "edgerunner/kvCache.hpp"
+
+#include <nonstd/span.hpp>
+
+#include "edgerunner/alignedBuffer.hpp"
+#include "edgerunner/model.hpp"
+#include "edgerunner/trace.hpp"
+
+#ifdef __linux__
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <unistd.h>
+#endif
+
+namespace edge {
+
+namespace {
+
+/* marks window slots without a block, mapped to the zero block */
+constexpr size_t NoBlock = SIZE_MAX;
+
+#ifdef __linux__
+auto getPageSize() -> size_t {
+    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+#endif
+
+}  // namespace
+
+KVCache::KVCache(const KVCacheOptions& options)
+    : m_options(options) {
+#ifdef __linux__
+    if (options.numCaches == 0 || options.bytesPerToken == 0
+        || options.maxTokens == 0 || options.blockTokens == 0
+        || options.numBlocks == 0
+        || options.bytesPerToken % AlignedBuffer::DefaultAlignment != 0)
+    {
+        return;
+    }
+
+    /* blocks are mapped individually, so must be whole pages. The alignment
+     * of tokens bounds the rounding to pageSize / DefaultAlignment tokens */
+    const auto pageSize = getPageSize();
+    const auto pageTokens =
+        pageSize / std::gcd(options.bytesPerToken, pageSize);
+    m_blockTokens = (options.blockTokens + pageTokens - 1) / pageTokens
+        * pageTokens;
+    m_blockBytes = m_blockTokens * options.bytesPerToken;
+    m_windowSlots = (options.maxTokens + m_blockTokens - 1) / m_blockTokens;
+
+    /* every cache tensor has its own pool of blocks, followed by the block
+     * of zeros backing unused window slots */
+    const auto arenaBytes =
+        (options.numCaches * options.numBlocks + 1) * m_blockBytes;
+
+    m_fileDescriptor = memfd_create("edgerunner-kvcache", MFD_CLOEXEC);
+    if (m_fileDescriptor < 0) {
+        return;
+    }
+
+    /* preallocate, such that appending never runs out of memory */
+    if (ftruncate(m_fileDescriptor, static_cast<off_t>(arenaBytes)) != 0
+        || fallocate(m_fileDescriptor, 0, 0, static_cast<off_t>(arenaBytes))
+            != 0)
+    {
+        close(m_fileDescriptor);
+        m_fileDescriptor = -1;
+        return;
+    }
+
+    m_freeBlocks.resize(options.numBlocks);
+    /* allocate the lowest blocks first */
+    std::iota(m_freeBlocks.rbegin(), m_freeBlocks.rend(), size_t {0});
+#endif
+}
+
+KVCache::~KVCache() {
+#ifdef __linux__
+    for (auto& [id, sequence] : m_sequences) {
+        for (auto* window : sequence.windows) {
+            munmap(window, m_windowSlots * m_blockBytes);
+        }
+    }
+
+    if (m_fileDescriptor >= 0) {
+        close(m_fileDescriptor);
+    }
+#endif
+}
+
+auto KVCache::getCreationStatus() const -> STATUS {
+    return m_fileDescriptor >= 0 ? STATUS::SUCCESS : STATUS::FAIL;
+}
+
+auto KVCache::createSequence(size_t& sequence) -> STATUS {
+#ifdef __linux__
+    if (m_fileDescriptor < 0) {
+        return STATUS::FAIL;
+    }
+
+    Sequence created;
+
+    /* reserve the address range of each window, then map the zero block
+     * into all of its slots */
+    for (size_t cache = 0; cache < m_options.numCaches; ++cache) {
+        auto* window = mmap(nullptr,
+                            m_windowSlots * m_blockBytes,
+                            PROT_NONE,
+                            MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+                            -1,
+                            0);
+        if (window == MAP_FAILED) {
+            for (auto* mapped : created.windows) {
+                munmap(mapped, m_windowSlots * m_blockBytes);
+            }
+            return STATUS::FAIL;
+        }
+        created.windows.push_back(static_cast<uint8_t*>(window));
+    }
+
+    for (size_t slot = 0; slot < m_windowSlots; ++slot) {
+        if (mapSlot(created, slot) != STATUS::SUCCESS) {
+            for (auto* window : created.windows) {
+                munmap(window, m_windowSlots * m_blockBytes);
+            }
+            return STATUS::FAIL;
+        }
+    }
+
+    sequence = m_nextSequence++;
+    m_sequences.emplace(sequence, std::move(created));
+
+    return STATUS::SUCCESS;
+#else
+    static_cast<void>(sequence);
+    return STATUS::FAIL;
+#endif
+}
+
+auto KVCache::removeSequence(const size_t sequence) -> STATUS {
+    auto found = m_sequences.find(sequence);
+    if (found == m_sequences.end()) {
+        return STATUS::FAIL;
+    }
+
+    auto& removed = found->second;
+    for (const auto block : removed.blockTable) {
+        m_freeBlocks.push_back(block);
+    }
+
+#ifdef __linux__
+    for (auto* window : removed.windows) {
+        munmap(window, m_windowSlots * m_blockBytes);
+    }
+#endif
+
+    m_sequences.erase(found);
+
+    return STATUS::SUCCESS;
+}
+
+auto KVCache::mapSlot(const Sequence& sequence, const size_t slot) -> STATUS {
+#ifdef __linux__
+    const auto block =
+        slot < sequence.blockTable.size() ? sequence.blockTable[slot] : NoBlock;
+
+    for (size_t cache = 0; cache < sequence.windows.size(); ++cache) {
+        const auto isZero = block == NoBlock;
+        const auto offset = isZero
+            ? m_options.numCaches * m_options.numBlocks * m_blockBytes
+            : (cache * m_options.numBlocks + block) * m_blockBytes;
+
+        /* the zero block is shared, and only read */
+        auto* mapped = mmap(sequence.windows[cache] + slot * m_blockBytes,
+                            m_blockBytes,
+                            isZero ? PROT_READ : PROT_READ | PROT_WRITE,
+                            MAP_SHARED | MAP_FIXED,
+                            m_fileDescriptor,
+                            static_cast<off_t>(offset));
+        if (mapped == MAP_FAILED) {
+            return STATUS::FAIL;
+        }
+    }
+
+    return STATUS::SUCCESS;
+#else
+    static_cast<void>(sequence);
+    static_cast<void>(slot);
+    return STATUS::FAIL;
+#endif
+}
+
+void KVCache::freeBlocks(Sequence& sequence, const size_t numBlocks) {
+    for (size_t i = 0; i < numBlocks && !sequence.blockTable.empty(); ++i) {
+        m_freeBlocks.push_back(sequence.blockTable.back());
+        sequence.blockTable.pop_back();
+        mapSlot(sequence, sequence.blockTable.size());
+    }
+}
+
+auto KVCache::reserve(const size_t sequence, const size_t numTokens)
+    -> STATUS {
+    auto* reserved = findSequence(sequence);
+    if (reserved == nullptr || numTokens > m_options.maxTokens) {
+        return STATUS::FAIL;
+    }
+
+    if (reserved->length + numTokens > m_options.maxTokens) {
+        if (!m_options.slidingWindow) {
+            return STATUS::FAIL;
+        }
+
+        const auto excess =
+            reserved->length + numTokens - m_options.maxTokens;
+        if (evict(sequence, (excess + m_blockTokens - 1) / m_blockTokens)
+            != STATUS::SUCCESS)
+        {
+            return STATUS::FAIL;
+        }
+    }
+
+    const auto numSlots =
+        (reserved->length + numTokens + m_blockTokens - 1) / m_blockTokens;
+
+    while (reserved->blockTable.size() < numSlots) {
+        if (m_freeBlocks.empty()) {
+            return STATUS::FAIL;
+        }
+
+        const auto slot = reserved->blockTable.size();
+        reserved->blockTable.push_back(m_freeBlocks.back());
+        m_freeBlocks.pop_back();
+
+        if (mapSlot(*reserved, slot) != STATUS::SUCCESS) {
+            freeBlocks(*reserved, 1);
+            return STATUS::FAIL;
+        }
+
+        /* blocks are reused across sequences */
+        for (auto* window : reserved->windows) {
+            std::fill_n(window + slot * m_blockBytes, m_blockBytes, uint8_t {0});
+        }
+    }
+
+    return STATUS::SUCCESS;
+}
+
+auto KVCache::append(const size_t sequence, const size_t numTokens) -> STATUS {
+    auto* appended = findSequence(sequence);
+    if (appended == nullptr
+        || appended->length + numTokens
+            > appended->blockTable.size() * m_blockTokens
+        || appended->length + numTokens > m_options.maxTokens)
+    {
+        return STATUS::FAIL;
+    }
+
+    appended->length += numTokens;
+
+    return STATUS::SUCCESS;
+}
+
+auto KVCache::truncate(const size_t sequence, const size_t length) -> STATUS {
+    auto* truncated = findSequence(sequence);
+    if (truncated == nullptr || length > truncated->length) {
+        return STATUS::FAIL;
+    }
+
+    truncated->length = length;
+
+    const auto numSlots = (length + m_blockTokens - 1) / m_blockTokens;
+    freeBlocks(*truncated, truncated->blockTable.size() - numSlots);
+
+    return STATUS::SUCCESS;
+}
+
+auto KVCache::evict(const size_t sequence, size_t numBlocks) -> STATUS {
+    const TraceScope trace {"evict", "kvCache"};
+
+    auto* evicted = findSequence(sequence);
+    if (evicted == nullptr) {
+        return STATUS::FAIL;
+    }
+
+    auto& blockTable = evicted->blockTable;
+    numBlocks = std::min(numBlocks, blockTable.size());
+
+    const auto evictedEnd =
+        std::next(blockTable.cbegin(), static_cast<std::ptrdiff_t>(numBlocks));
+    m_freeBlocks.insert(m_freeBlocks.end(), blockTable.cbegin(), evictedEnd);
+    blockTable.erase(blockTable.cbegin(), evictedEnd);
+
+    const auto numTokens = std::min(evicted->length, numBlocks * m_blockTokens);
+    evicted->length -= numTokens;
+    evicted->numEvicted += numTokens;
+
+    /* shift the remaining blocks to the start of the windows */
+    for (size_t slot = 0; slot < m_windowSlots; ++slot) {
+        if (mapSlot(*evicted, slot) != STATUS::SUCCESS) {
+            return STATUS::FAIL;
+        }
+    }
+
+    return STATUS::SUCCESS;
+}
+
+auto KVCache::bind(Model& model,
+                   const size_t sequence,
+                   const std::vector<KVCacheBinding>& bindings,
+                   const size_t numTokens) -> STATUS {
+    if (reserve(sequence, numTokens) != STATUS::SUCCESS) {
+        return STATUS::FAIL;
+    }
+
+    const auto& bound = *findSequence(sequence);
+
+    for (const auto& binding : bindings) {
+        if (binding.cache >= bound.windows.size()) {
+            return STATUS::FAIL;
+        }
+
+        auto* window = bound.windows[binding.cache];
+        auto* slot = window + bound.length * m_options.bytesPerToken;
+
+        if (model.bindInput(
+                binding.inputIndex, window, m_windowSlots * m_blockBytes)
+                != STATUS::SUCCESS
+            || model.bindOutput(binding.outputIndex,
+                                slot,
+                                numTokens * m_options.bytesPerToken)
+                != STATUS::SUCCESS)
+        {
+            return STATUS::FAIL;
+        }
+    }
+
+    return STATUS::SUCCESS;
+}
+
+auto KVCache::getCache(const size_t sequence, const size_t cache)
+    -> nonstd::span<uint8_t> {
+    auto* found = findSequence(sequence);
+    if (found == nullptr || cache >= found->windows.size()) {
+        return {};
+    }
+
+    return {found->windows[cache], m_options.maxTokens * m_options.bytesPerToken};
+}
+
+auto KVCache::getLength(const size_t sequence) const -> size_t {
+    const auto* found = findSequence(sequence);
+    return found != nullptr ? found->length : 0;
+}
+
+auto KVCache::getNumEvicted(const size_t sequence) const -> size_t {
+    const auto* found = findSequence(sequence);
+    return found != nullptr ? found->numEvicted : 0;
+}
+
+auto KVCache::findSequence(const size_t sequence) -> Sequence* {
+    const auto found = m_sequences.find(sequence);
+    return found != m_sequences.end() ? &found->second : nullptr;
+}
+
+auto KVCache::findSequence(const size_t sequence) const -> const Sequence* {
+    const auto found = m_sequences.find(sequence);
+    return found != m_sequences.end() ? &found->second : nullptr;
+}
+
+}  // namespace edge
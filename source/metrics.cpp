@@ -0,0 +1,320 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "edgerunner/metrics.hpp"
+
+#include <fmt/core.h>
+#include <fmt/format.h>
+
+#include "edgerunner/model.hpp"
+
+namespace edge {
+
+namespace {
+
+auto getHighestBit(uint64_t value) -> size_t {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<size_t>(63 - __builtin_clzll(value));
+#else
+    size_t bit = 0;
+    while (value >>= 1U) {
+        ++bit;
+    }
+    return bit;
+#endif
+}
+
+void updateMin(std::atomic<uint64_t>& current, const uint64_t value) {
+    auto observed = current.load(std::memory_order_relaxed);
+    while (value < observed
+           && !current.compare_exchange_weak(
+               observed, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+void updateMax(std::atomic<uint64_t>& current, const uint64_t value) {
+    auto observed = current.load(std::memory_order_relaxed);
+    while (value > observed
+           && !current.compare_exchange_weak(
+               observed, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+auto escapeLabel(const std::string& label) -> std::string {
+    std::string escaped;
+    escaped.reserve(label.size());
+    for (const auto character : label) {
+        switch (character) {
+            case '\\':
+                escaped += "\\\\";
+                break;
+            case '"':
+                escaped += "\\\"";
+                break;
+            case '\n':
+                escaped += "\\n";
+                break;
+            default:
+                escaped += character;
+                break;
+        }
+    }
+    return escaped;
+}
+
+struct Quantile {
+    const char* label;
+    double percentile;
+};
+
+constexpr std::array<Quantile, 4> Quantiles {{
+    {"0.5", 50.0},
+    {"0.9", 90.0},
+    {"0.99", 99.0},
+    {"0.999", 99.9},
+}};
+
+auto histogramToJson(const HistogramSnapshot& histogram) -> std::string {
+    return fmt::format(
+        R"({{"count":{},"sum_us":{},"min_us":{},"max_us":{},"mean_us":{:.3f},)"
+        R"("p50_us":{},"p90_us":{},"p99_us":{},"p999_us":{}}})",
+        histogram.count,
+        histogram.sum,
+        histogram.min,
+        histogram.max,
+        histogram.getMean(),
+        histogram.getPercentile(50.0),
+        histogram.getPercentile(90.0),
+        histogram.getPercentile(99.0),
+        histogram.getPercentile(99.9));
+}
+
+void appendSummary(std::string& output,
+                   const std::string& metricName,
+                   const std::string& help,
+                   const HistogramSnapshot& histogram,
+                   const std::string& modelLabel) {
+    auto outputIt = std::back_inserter(output);
+    fmt::format_to(outputIt, "# HELP {} {}\n", metricName, help);
+    fmt::format_to(outputIt, "# TYPE {} summary\n", metricName);
+    for (const auto& quantile : Quantiles) {
+        fmt::format_to(outputIt,
+                       "{}{{model=\"{}\",quantile=\"{}\"}} {}\n",
+                       metricName,
+                       modelLabel,
+                       quantile.label,
+                       histogram.getPercentile(quantile.percentile));
+    }
+    fmt::format_to(outputIt,
+                   "{}_sum{{model=\"{}\"}} {}\n",
+                   metricName,
+                   modelLabel,
+                   histogram.sum);
+    fmt::format_to(outputIt,
+                   "{}_count{{model=\"{}\"}} {}\n",
+                   metricName,
+                   modelLabel,
+                   histogram.count);
+}
+
+void appendCounter(std::string& output,
+                   const std::string& metricName,
+                   const std::string& help,
+                   const uint64_t value,
+                   const std::string& modelLabel) {
+    auto outputIt = std::back_inserter(output);
+    fmt::format_to(outputIt, "# HELP {} {}\n", metricName, help);
+    fmt::format_to(outputIt, "# TYPE {} counter\n", metricName);
+    fmt::format_to(
+        outputIt, "{}{{model=\"{}\"}} {}\n", metricName, modelLabel, value);
+}
+
+}  // namespace
+
+auto HistogramSnapshot::getPercentile(const double percentile) const
+    -> uint64_t {
+    if (count == 0) {
+        return 0;
+    }
+
+    const auto clamped = std::clamp(percentile, 0.0, 100.0);
+    const auto rank = std::max<uint64_t>(
+        1,
+        static_cast<uint64_t>(
+            std::ceil(clamped / 100.0 * static_cast<double>(count))));
+
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        cumulative += buckets[i];
+        if (cumulative >= rank) {
+            return std::clamp(
+                LatencyHistogram::getBucketUpperBound(i), min, max);
+        }
+    }
+
+    return max;
+}
+
+auto HistogramSnapshot::getMean() const -> double {
+    if (count == 0) {
+        return 0.0;
+    }
+
+    return static_cast<double>(sum) / static_cast<double>(count);
+}
+
+auto LatencyHistogram::getBucketIndex(uint64_t value) noexcept -> size_t {
+    value = std::min(value, MaxValue);
+
+    if (value < SubBucketCount) {
+        return static_cast<size_t>(value);
+    }
+
+    const auto shift = getHighestBit(value) - SubBucketBits;
+    const auto subBucket =
+        static_cast<size_t>(value >> shift) - SubBucketCount;
+
+    return (shift + 1) * SubBucketCount + subBucket;
+}
+
+auto LatencyHistogram::getBucketUpperBound(const size_t index) noexcept
+    -> uint64_t {
+    if (index < SubBucketCount) {
+        return index;
+    }
+
+    const auto shift = index / SubBucketCount - 1;
+    const auto subBucket = index % SubBucketCount;
+    const auto lowerBound = static_cast<uint64_t>(SubBucketCount + subBucket)
+        << shift;
+
+    return lowerBound + (uint64_t {1} << shift) - 1;
+}
+
+void LatencyHistogram::record(const uint64_t value) noexcept {
+    m_buckets[getBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(value, std::memory_order_relaxed);
+    updateMin(m_min, value);
+    updateMax(m_max, value);
+}
+
+auto LatencyHistogram::snapshot() const -> HistogramSnapshot {
+    HistogramSnapshot snapshot;
+    snapshot.buckets.reserve(m_buckets.size());
+
+    for (const auto& bucket : m_buckets) {
+        const auto bucketCount = bucket.load(std::memory_order_relaxed);
+        snapshot.buckets.push_back(bucketCount);
+        snapshot.count += bucketCount;
+    }
+
+    snapshot.sum = m_sum.load(std::memory_order_relaxed);
+
+    if (snapshot.count > 0) {
+        snapshot.min = m_min.load(std::memory_order_relaxed);
+        snapshot.max = m_max.load(std::memory_order_relaxed);
+    }
+
+    return snapshot;
+}
+
+void LatencyHistogram::reset() noexcept {
+    for (auto& bucket : m_buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    m_sum.store(0, std::memory_order_relaxed);
+    m_min.store(std::numeric_limits<uint64_t>::max(),
+                std::memory_order_relaxed);
+    m_max.store(0, std::memory_order_relaxed);
+}
+
+void ModelMetrics::recordExecution(const TimePoint start,
+                                   const STATUS status) noexcept {
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+
+    m_execute.record(static_cast<uint64_t>(elapsed.count()));
+    m_executions.fetch_add(1, std::memory_order_relaxed);
+
+    if (status != STATUS::SUCCESS) {
+        m_failures.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+auto ModelMetrics::snapshot() const -> MetricsSnapshot {
+    MetricsSnapshot snapshot;
+    snapshot.load = m_load.snapshot();
+    snapshot.allocate = m_allocate.snapshot();
+    snapshot.execute = m_execute.snapshot();
+    snapshot.executions = m_executions.load(std::memory_order_relaxed);
+    snapshot.failures = m_failures.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+void ModelMetrics::reset() noexcept {
+    m_load.reset();
+    m_allocate.reset();
+    m_execute.reset();
+    m_executions.store(0, std::memory_order_relaxed);
+    m_failures.store(0, std::memory_order_relaxed);
+}
+
+auto toJson(const MetricsSnapshot& snapshot, const std::string& modelName)
+    -> std::string {
+    return fmt::format(
+        R"({{"model":"{}","executions":{},"failures":{},"load":{},)"
+        R"("allocate":{},"execute":{}}})",
+        escapeLabel(modelName),
+        snapshot.executions,
+        snapshot.failures,
+        histogramToJson(snapshot.load),
+        histogramToJson(snapshot.allocate),
+        histogramToJson(snapshot.execute));
+}
+
+auto toPrometheus(const MetricsSnapshot& snapshot,
+                  const std::string& modelName) -> std::string {
+    const auto modelLabel = escapeLabel(modelName);
+
+    std::string output;
+    appendSummary(output,
+                  "edgerunner_load_latency_microseconds",
+                  "Model load latency in microseconds",
+                  snapshot.load,
+                  modelLabel);
+    appendSummary(output,
+                  "edgerunner_allocate_latency_microseconds",
+                  "Tensor allocation latency in microseconds",
+                  snapshot.allocate,
+                  modelLabel);
+    appendSummary(output,
+                  "edgerunner_execute_latency_microseconds",
+                  "Model execution latency in microseconds",
+                  snapshot.execute,
+                  modelLabel);
+    appendCounter(output,
+                  "edgerunner_executions_total",
+                  "Number of model executions",
+                  snapshot.executions,
+                  modelLabel);
+    appendCounter(output,
+                  "edgerunner_execution_failures_total",
+                  "Number of failed model executions",
+                  snapshot.failures,
+                  modelLabel);
+
+    return output;
+}
+
+}  // namespace edge
@@ -17,20 +17,29 @@
 #include <QnnInterface.h>
 #include <QnnLog.h>
 #include <QnnProperty.h>
+#include <System/QnnSystemInterface.h>
 #include <dlfcn.h>
 #include <nonstd/span.hpp>
 
 #include "edgerunner/model.hpp"
 #include "edgerunner/qnn/config.hpp"
+#include "edgerunner/trace.hpp"
 
 namespace edge::qnn {
 
 using QnnInterfaceGetProvidersFnT =
     Qnn_ErrorHandle_t (*)(const QnnInterface_t***, uint32_t*);
 
+using QnnSystemInterfaceGetProvidersFnT =
+    Qnn_ErrorHandle_t (*)(const QnnSystemInterface_t***, uint32_t*);
+
 Backend::Backend(const DELEGATE delegate)
     : m_delegate(delegate) {
     setCreationStatus(loadBackend());
+    if (getCreationStatus() == STATUS::FAIL) {
+        return;
+    }
+
     setCreationStatus(createLogger());
     setCreationStatus(initializeBackend());
     setCreationStatus(createDevice());
@@ -40,7 +49,9 @@ Backend::Backend(const DELEGATE delegate)
 }
 
 Backend::~Backend() {
-    destroyPowerConfig();
+    if (m_delegate == DELEGATE::NPU) {
+        destroyPowerConfig();
+    }
 
     if (m_deviceHandle != nullptr && m_qnnInterface.deviceFree != nullptr) {
         m_qnnInterface.deviceFree(m_deviceHandle);
@@ -50,10 +61,14 @@ Backend::~Backend() {
         m_qnnInterface.backendFree(m_backendHandle);
     }
 
-    dlclose(m_backendLibHandle);
+    if (m_backendLibHandle != nullptr) {
+        dlclose(m_backendLibHandle);
+    }
 }
 
 auto Backend::loadBackend() -> STATUS {
+    const TraceScope trace {"loadBackend"};
+
     m_backendLibHandle =
         dlopen(m_backendLibrariesByDelegate.at(m_delegate).c_str(),
                RTLD_NOW | RTLD_LOCAL);
@@ -67,7 +82,6 @@ auto Backend::loadBackend() -> STATUS {
             dlsym(m_backendLibHandle, "QnnInterface_getProviders"));
 
     if (nullptr == getInterfaceProviders) {
-        dlclose(m_backendLibHandle);
         return STATUS::FAIL;
     }
 
@@ -79,11 +93,9 @@ auto Backend::loadBackend() -> STATUS {
             const_cast<const QnnInterface_t***>(&interfaceProvidersPtr),
             &numProviders))
     {
-        dlclose(m_backendLibHandle);
         return STATUS::FAIL;
     }
     if (nullptr == interfaceProvidersPtr || 0 == numProviders) {
-        dlclose(m_backendLibHandle);
         return STATUS::FAIL;
     }
 
@@ -100,7 +112,6 @@ auto Backend::loadBackend() -> STATUS {
             m_qnnInterface = interfaceProvider->QNN_INTERFACE_VER_NAME;
             backendId = interfaceProvider->backendId;
         } else {
-            dlclose(m_backendLibHandle);
             return STATUS::FAIL;
         }
     }
@@ -154,6 +165,8 @@ auto Backend::createLogger() -> STATUS {
 }
 
 auto Backend::initializeBackend() -> STATUS {
+    const TraceScope trace {"initializeBackend"};
+
     const auto status = m_qnnInterface.backendCreate(
         m_logHandle,
         const_cast<const QnnBackend_Config_t**>(m_backendConfig),
@@ -172,6 +185,11 @@ auto Backend::createDevice() -> STATUS {
         if (QNN_PROPERTY_ERROR_UNKNOWN_KEY == status) {
             return STATUS::FAIL;
         }
+
+        /* contexts are created without a device on backends such as CPU */
+        if (QNN_PROPERTY_NOT_SUPPORTED == status) {
+            return STATUS::SUCCESS;
+        }
     }
 
     Config<QnnDevice_Config_t, void*> deviceConfig {QNN_DEVICE_CONFIG_INIT, {}};
@@ -282,4 +300,61 @@ auto Backend::validateBackendId(const uint32_t backendId) const -> STATUS {
     }
 }
 
+SystemLibrary::SystemLibrary() {
+    m_creationStatus = loadSystemLibrary();
+}
+
+SystemLibrary::~SystemLibrary() {
+    if (m_systemLibHandle != nullptr) {
+        dlclose(m_systemLibHandle);
+    }
+}
+
+auto SystemLibrary::loadSystemLibrary() -> STATUS {
+    const TraceScope trace {"loadSystemLibrary"};
+
+    m_systemLibHandle = dlopen("libQnnSystem.so", RTLD_NOW | RTLD_LOCAL);
+    if (nullptr == m_systemLibHandle) {
+        return STATUS::FAIL;
+    }
+
+    auto getSystemInterfaceProviders =
+        reinterpret_cast<QnnSystemInterfaceGetProvidersFnT> /* NOLINT */ (
+            dlsym(m_systemLibHandle, "QnnSystemInterface_getProviders"));
+    if (nullptr == getSystemInterfaceProviders) {
+        return STATUS::FAIL;
+    }
+
+    QnnSystemInterface_t** systemInterfaceProvidersPtr {nullptr};
+    uint32_t numProviders = 0;
+    if (QNN_SUCCESS
+        != getSystemInterfaceProviders(
+            const_cast<const QnnSystemInterface_t***>(
+                &systemInterfaceProvidersPtr),
+            &numProviders))
+    {
+        return STATUS::FAIL;
+    }
+    if (nullptr == systemInterfaceProvidersPtr || 0 == numProviders) {
+        return STATUS::FAIL;
+    }
+
+    const nonstd::span<QnnSystemInterface_t*> systemInterfaceProviders {
+        systemInterfaceProvidersPtr, numProviders};
+
+    for (const auto& systemInterfaceProvider : systemInterfaceProviders) {
+        const auto systemApiVersion = systemInterfaceProvider->systemApiVersion;
+
+        if (QNN_SYSTEM_API_VERSION_MAJOR == systemApiVersion.major
+            && QNN_SYSTEM_API_VERSION_MINOR <= systemApiVersion.minor)
+        {
+            m_qnnSystemInterface =
+                systemInterfaceProvider->QNN_SYSTEM_INTERFACE_VER_NAME;
+            return STATUS::SUCCESS;
+        }
+    }
+
+    return STATUS::FAIL;
+}
+
 }  // namespace edge::qnn
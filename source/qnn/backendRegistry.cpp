@@ -0,0 +1,53 @@
+#include <memory>
+#include <mutex>
+
+#include "edgerunner/qnn/backendRegistry.hpp"
+
+#include "edgerunner/model.hpp"
+#include "edgerunner/qnn/backend.hpp"
+
+namespace edge::qnn {
+
+auto BackendRegistry::get() -> BackendRegistry& {
+    static BackendRegistry registry;
+    return registry;
+}
+
+auto BackendRegistry::acquire(const DELEGATE delegate)
+    -> std::shared_ptr<Backend> {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto& cachedBackend = m_backends[delegate];
+    if (auto backend = cachedBackend.lock()) {
+        return backend;
+    }
+
+    auto backend = std::make_shared<Backend>(delegate);
+    if (backend->getCreationStatus() != STATUS::SUCCESS) {
+        return nullptr;
+    }
+
+    cachedBackend = backend;
+
+    return backend;
+}
+
+auto BackendRegistry::acquireSystemLibrary()
+    -> std::shared_ptr<SystemLibrary> {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (auto systemLibrary = m_systemLibrary.lock()) {
+        return systemLibrary;
+    }
+
+    auto systemLibrary = std::make_shared<SystemLibrary>();
+    if (systemLibrary->getCreationStatus() != STATUS::SUCCESS) {
+        return nullptr;
+    }
+
+    m_systemLibrary = systemLibrary;
+
+    return systemLibrary;
+}
+
+}  // namespace edge::qnn
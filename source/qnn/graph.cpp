@@ -1,3 +1,4 @@
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -6,6 +7,10 @@
 #include <fstream>
 #include <functional>
 #include <ios>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -18,6 +23,7 @@
 #include <QnnGraph.h>
 #include <QnnInterface.h>
 #include <QnnLog.h>
+#include <QnnProfile.h>
 #include <QnnTypes.h>
 #include <System/QnnSystemCommon.h>
 #include <System/QnnSystemContext.h>
@@ -27,15 +33,15 @@
 #include <nonstd/span.hpp>
 
 #include "edgerunner/model.hpp"
+#include "edgerunner/profiling.hpp"
+#include "edgerunner/qnn/backendRegistry.hpp"
 #include "edgerunner/qnn/config.hpp"
 #include "edgerunner/qnn/tensorOps.hpp"
 #include "edgerunner/tensor.hpp"
+#include "edgerunner/trace.hpp"
 
 namespace edge::qnn {
 
-using QnnSystemInterfaceGetProvidersFnT =
-    Qnn_ErrorHandle_t (*)(const QnnSystemInterface_t***, uint32_t*);
-
 using ContextBinaryInfoVariant =
     std::variant<std::reference_wrapper<QnnSystemContext_BinaryInfoV1_t>,
                  std::reference_wrapper<QnnSystemContext_BinaryInfoV2_t>>;
@@ -77,15 +83,21 @@ auto getContextBinaryInfoVariant(
 }
 
 Graph::~Graph() {
+    waitForAsync();
+
     if (m_graphsInfo != nullptr && m_freeGraphInfoFnHandle != nullptr) {
         m_freeGraphInfoFnHandle(&m_graphsInfo, m_graphsCount);
     } else {
         try {
-            for (auto& tensor : m_inputTensors) {
-                freeQnnTensor(tensor);
+            for (auto& tensors : m_inputTensors) {
+                for (auto& tensor : tensors) {
+                    freeQnnTensor(tensor);
+                }
             }
-            for (auto& tensor : m_outputTensors) {
-                freeQnnTensor(tensor);
+            for (auto& tensors : m_outputTensors) {
+                for (auto& tensor : tensors) {
+                    freeQnnTensor(tensor);
+                }
             }
         } catch (std::exception& ex) {
             fmt::print(stderr, "Failed to free graph tensors: {}\n", ex.what());
@@ -95,6 +107,8 @@ Graph::~Graph() {
         m_qnnInterface.contextFree(m_context, nullptr);
     }
 
+    freeProfile();
+
     if (m_libModelHandle != nullptr) {
         try {
             dlclose(m_libModelHandle);
@@ -108,6 +122,8 @@ Graph::~Graph() {
 
 auto Graph::loadFromSharedLibrary(const std::filesystem::path& modelPath)
     -> STATUS {
+    const TraceScope trace {"loadFromSharedLibrary"};
+
     m_libModelHandle = dlopen(modelPath.string().data(), RTLD_NOW | RTLD_LOCAL);
 
     if (nullptr == m_libModelHandle) {
@@ -131,9 +147,22 @@ auto Graph::loadFromSharedLibrary(const std::filesystem::path& modelPath)
 
 auto Graph::createContext(QNN_INTERFACE_VER_TYPE& qnnInterface,
                           Qnn_BackendHandle_t& backendHandle,
-                          Qnn_DeviceHandle_t& deviceHandle) -> STATUS {
-    Config<QnnContext_Config_t, void*> contextConfig {QNN_CONTEXT_CONFIG_INIT,
-                                                      {}};
+                          Qnn_DeviceHandle_t& deviceHandle,
+                          const HtpOptions& htpOptions) -> STATUS {
+    Config<QnnContext_Config_t, QnnHtpContext_CustomConfig_t> contextConfig {
+        QNN_CONTEXT_CONFIG_INIT, {}};
+
+    if (htpOptions.weightSharing) {
+        auto& weightSharingCustomConfig = contextConfig.createCustomConfig();
+        weightSharingCustomConfig.option =
+            QNN_HTP_CONTEXT_CONFIG_OPTION_WEIGHT_SHARING_ENABLED;
+        weightSharingCustomConfig.weightSharingEnabled /* NOLINT */ = true;
+
+        auto& weightSharingConfig = contextConfig.createConfig();
+        weightSharingConfig.option = QNN_CONTEXT_CONFIG_OPTION_CUSTOM;
+        weightSharingConfig.customConfig /* NOLINT */ =
+            &weightSharingCustomConfig;
+    }
 
     m_qnnInterface = qnnInterface;
 
@@ -148,6 +177,9 @@ auto Graph::createContext(QNN_INTERFACE_VER_TYPE& qnnInterface,
 }
 
 auto Graph::composeGraphs(Qnn_BackendHandle_t& qnnBackendHandle) -> STATUS {
+    const TraceScope trace {"composeGraphs"};
+    const auto start = std::chrono::steady_clock::now();
+
     const auto status = m_composeGraphsFnHandle(qnnBackendHandle,
                                                 m_qnnInterface,
                                                 m_context,
@@ -163,15 +195,81 @@ auto Graph::composeGraphs(Qnn_BackendHandle_t& qnnBackendHandle) -> STATUS {
         return STATUS::FAIL;
     }
 
+    /* graph composition does not accept a profile handle, time it instead */
+    if (m_profile != nullptr) {
+        const auto elapsed =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start);
+        m_profilingEvents.push_back({"composeGraphs",
+                                     PROFILING_EVENT::INIT,
+                                     static_cast<uint64_t>(elapsed.count()),
+                                     PROFILING_UNIT::MICROSECONDS});
+    }
+
     setGraph();
 
     return STATUS::SUCCESS;
 }
 
-auto Graph::setGraphConfig(DELEGATE delegate, TensorType precision) -> STATUS {
+auto Graph::getInputs(const size_t graphIndex) -> nonstd::span<Qnn_Tensor_t> {
+    if (graphIndex >= m_graphsCount) {
+        return {};
+    }
+
+    auto* graphInfo = getGraphsInfo()[graphIndex];
+    return {graphInfo->inputTensors, graphInfo->numInputTensors};
+}
+
+auto Graph::getOutputs(const size_t graphIndex) -> nonstd::span<Qnn_Tensor_t> {
+    if (graphIndex >= m_graphsCount) {
+        return {};
+    }
+
+    auto* graphInfo = getGraphsInfo()[graphIndex];
+    return {graphInfo->outputTensors, graphInfo->numOutputTensors};
+}
+
+auto Graph::getGraphNames() const -> std::vector<std::string> {
+    std::vector<std::string> graphNames;
+    graphNames.reserve(m_graphsCount);
+
+    for (const auto* graphInfo : getGraphsInfo()) {
+        graphNames.emplace_back(
+            graphInfo->graphName != nullptr ? graphInfo->graphName : "");
+    }
+
+    return graphNames;
+}
+
+auto Graph::setGraph(const std::string& graphName) -> STATUS {
+    const auto graphsInfo = getGraphsInfo();
+
+    for (size_t graphIndex = 0; graphIndex < graphsInfo.size(); ++graphIndex) {
+        const auto* graphInfo = graphsInfo[graphIndex];
+        if (graphInfo->graphName != nullptr
+            && graphName == graphInfo->graphName)
+        {
+            setGraph(graphIndex);
+            return STATUS::SUCCESS;
+        }
+    }
+
+    return STATUS::FAIL;
+}
+
+auto Graph::setGraphConfig(DELEGATE delegate,
+                           TensorType precision,
+                           const HtpOptions& htpOptions) -> STATUS {
     Config<QnnGraph_Config_t, QnnHtpGraph_CustomConfig_t> graphConfigs {
         QNN_GRAPH_CONFIG_INIT, QNN_HTP_GRAPH_CUSTOM_CONFIG_INIT};
 
+    const auto addCustomConfig =
+        [&graphConfigs](QnnHtpGraph_CustomConfig_t& customConfig) {
+            auto& config = graphConfigs.createConfig();
+            config.option = QNN_GRAPH_CONFIG_OPTION_CUSTOM;
+            config.customConfig /* NOLINT */ = &customConfig;
+        };
+
     if (delegate == DELEGATE::NPU) {
         if (precision == TensorType::FLOAT16) {
             auto& precisionCustomConfig = graphConfigs.createCustomConfig();
@@ -181,9 +279,7 @@ auto Graph::setGraphConfig(DELEGATE delegate, TensorType precision) -> STATUS {
             precisionCustomConfig.precision /* NOLINT */ =
                 QNN_PRECISION_FLOAT16;
 
-            auto& precisionConfig = graphConfigs.createConfig();
-            precisionConfig.option = QNN_GRAPH_CONFIG_OPTION_CUSTOM;
-            precisionConfig.customConfig /* NOLINT */ = &precisionCustomConfig;
+            addCustomConfig(precisionCustomConfig);
         }
 
         auto& optimizationCustomConfig = graphConfigs.createCustomConfig();
@@ -193,32 +289,56 @@ auto Graph::setGraphConfig(DELEGATE delegate, TensorType precision) -> STATUS {
             QNN_HTP_GRAPH_OPTIMIZATION_TYPE_FINALIZE_OPTIMIZATION_FLAG;
         static constexpr float GraphOptimizationLevel = 3.0F;
         optimizationCustomConfig.optimizationOption /* NOLINT */.floatValue =
-            GraphOptimizationLevel;
+            htpOptions.optimizationLevel.value_or(GraphOptimizationLevel);
+
+        addCustomConfig(optimizationCustomConfig);
+
+        if (htpOptions.vtcmSizeMb.has_value()) {
+            auto& vtcmCustomConfig = graphConfigs.createCustomConfig();
+            vtcmCustomConfig.option = QNN_HTP_GRAPH_CONFIG_OPTION_VTCM_SIZE;
+            vtcmCustomConfig.vtcmSizeInMB /* NOLINT */ =
+                htpOptions.vtcmSizeMb.value();
+
+            addCustomConfig(vtcmCustomConfig);
+        }
+
+        if (htpOptions.hvxThreads.has_value()) {
+            auto& hvxCustomConfig = graphConfigs.createCustomConfig();
+            hvxCustomConfig.option =
+                QNN_HTP_GRAPH_CONFIG_OPTION_NUM_HVX_THREADS;
+            hvxCustomConfig.numHvxThreads /* NOLINT */ =
+                htpOptions.hvxThreads.value();
 
-        auto& optimizationConfig = graphConfigs.createConfig();
-        optimizationConfig.option = QNN_GRAPH_CONFIG_OPTION_CUSTOM;
-        optimizationConfig.customConfig /* NOLINT */ =
-            &optimizationCustomConfig;
+            addCustomConfig(hvxCustomConfig);
+        }
     }
 
-    const auto status = m_qnnInterface.graphSetConfig(m_graphInfo->graph,
-                                                      graphConfigs.getPtr());
+    for (auto* graphInfo : getGraphsInfo()) {
+        const auto status = m_qnnInterface.graphSetConfig(
+            graphInfo->graph, graphConfigs.getPtr());
 
-    if (QNN_GRAPH_NO_ERROR != status) {
-        return STATUS::FAIL;
+        if (QNN_GRAPH_NO_ERROR != status) {
+            return STATUS::FAIL;
+        }
     }
 
     return STATUS::SUCCESS;
 }
 
 auto Graph::finalizeGraphs() -> STATUS {
-    const auto status =
-        m_qnnInterface.graphFinalize(m_graphInfo->graph, nullptr, nullptr);
+    const TraceScope trace {"graphFinalize"};
 
-    if (QNN_GRAPH_NO_ERROR != status) {
-        return STATUS::FAIL;
+    for (auto* graphInfo : getGraphsInfo()) {
+        const auto status =
+            m_qnnInterface.graphFinalize(graphInfo->graph, m_profile, nullptr);
+
+        if (QNN_GRAPH_NO_ERROR != status) {
+            return STATUS::FAIL;
+        }
     }
 
+    collectProfilingEvents(PROFILING_EVENT::FINALIZE);
+
     return STATUS::SUCCESS;
 }
 
@@ -261,57 +381,23 @@ auto Graph::saveContextBinary(const std::filesystem::path& binaryPath)
 }
 
 auto Graph::loadSystemLibrary() -> STATUS {
-    void* systemLibraryHandle =
-        dlopen("libQnnSystem.so", RTLD_NOW | RTLD_LOCAL);
-    if (nullptr == systemLibraryHandle) {
+    m_systemLibrary = BackendRegistry::get().acquireSystemLibrary();
+    if (m_systemLibrary == nullptr) {
         return STATUS::FAIL;
     }
 
-    QnnSystemInterfaceGetProvidersFnT getSystemInterfaceProviders {nullptr};
-    getSystemInterfaceProviders =
-        reinterpret_cast<QnnSystemInterfaceGetProvidersFnT> /* NOLINT */ (
-            dlsym(systemLibraryHandle, "QnnSystemInterface_getProviders"));
-    if (nullptr == getSystemInterfaceProviders) {
-        return STATUS::FAIL;
-    }
-
-    QnnSystemInterface_t** systemInterfaceProvidersPtr {nullptr};
-    uint32_t numProviders = 0;
-    if (QNN_SUCCESS
-        != getSystemInterfaceProviders(
-            const_cast<const QnnSystemInterface_t***>(
-                &systemInterfaceProvidersPtr),
-            &numProviders))
-    {
-        return STATUS::FAIL;
-    }
-    if (nullptr == systemInterfaceProvidersPtr || 0 == numProviders) {
-        return STATUS::FAIL;
-    }
-
-    const nonstd::span<QnnSystemInterface_t*> systemInterfaceProviders {
-        systemInterfaceProvidersPtr, numProviders};
-
-    for (const auto& systemInterfaceProvider : systemInterfaceProviders) {
-        const auto systemApiVersion = systemInterfaceProvider->systemApiVersion;
-
-        if (QNN_SYSTEM_API_VERSION_MAJOR == systemApiVersion.major
-            && QNN_SYSTEM_API_VERSION_MINOR <= systemApiVersion.minor)
-        {
-            m_qnnSystemInterface =
-                systemInterfaceProvider->QNN_SYSTEM_INTERFACE_VER_NAME;
-            return STATUS::SUCCESS;
-        }
-    }
+    m_qnnSystemInterface = m_systemLibrary->getInterface();
 
-    return STATUS::FAIL;
+    return STATUS::SUCCESS;
 }
 
 auto Graph::loadContextFromBinary(QNN_INTERFACE_VER_TYPE& qnnInterface,
                                   Qnn_BackendHandle_t& backendHandle,
                                   Qnn_DeviceHandle_t& deviceHandle,
-                                  const nonstd::span<uint8_t>& modelBuffer)
-    -> STATUS {
+                                  const nonstd::span<uint8_t>& modelBuffer,
+                                  const HtpOptions& htpOptions) -> STATUS {
+    const TraceScope trace {"contextCreateFromBinary"};
+
     m_qnnInterface = qnnInterface;
 
     QnnSystemContext_Handle_t sysCtxHandle {nullptr};
@@ -346,9 +432,20 @@ auto Graph::loadContextFromBinary(QNN_INTERFACE_VER_TYPE& qnnInterface,
     Config<QnnContext_Config_t, QnnHtpContext_CustomConfig_t> contextConfigs {
         QNN_CONTEXT_CONFIG_INIT, {}};
 
-    auto& contextCustomConfig = contextConfigs.createCustomConfig();
-    contextCustomConfig.option =
-        QNN_HTP_CONTEXT_CONFIG_OPTION_REGISTER_MULTI_CONTEXTS;
+    if (htpOptions.spillFillBufferSize.has_value()) {
+        /* start a new group of contexts sharing one spill-fill buffer */
+        auto& groupCustomConfig = contextConfigs.createCustomConfig();
+        groupCustomConfig.option =
+            QNN_HTP_CONTEXT_CONFIG_OPTION_REGISTER_MULTI_CONTEXTS;
+        groupCustomConfig.groupRegistration /* NOLINT */.firstGroupHandle =
+            nullptr;
+        groupCustomConfig.groupRegistration /* NOLINT */.maxSpillFillBuffer =
+            htpOptions.spillFillBufferSize.value();
+
+        auto& groupConfig = contextConfigs.createConfig();
+        groupConfig.option = QNN_CONTEXT_CONFIG_OPTION_CUSTOM;
+        groupConfig.customConfig /* NOLINT */ = &groupCustomConfig;
+    }
 
     if (m_qnnInterface.contextCreateFromBinary(
             backendHandle,
@@ -357,24 +454,28 @@ auto Graph::loadContextFromBinary(QNN_INTERFACE_VER_TYPE& qnnInterface,
             static_cast<void*>(modelBuffer.data()),
             modelBuffer.size(),
             &m_context,
-            nullptr)
+            m_profile)
         != 0U)
     {
         return STATUS::FAIL;
     }
 
+    collectProfilingEvents(PROFILING_EVENT::DESERIALIZE);
+
     return STATUS::SUCCESS;
 }
 
 auto Graph::retrieveGraphFromContext() -> STATUS {
-    for (size_t graphIdx = 0; graphIdx < m_graphsCount; ++graphIdx) {
-        if (nullptr == m_qnnInterface.graphRetrieve) {
-            return STATUS::FAIL;
-        }
-        auto& graphInfo = (*m_graphsInfo)[graphIdx] /* NOLINT */;
+    const TraceScope trace {"retrieveGraphFromContext"};
+
+    if (nullptr == m_qnnInterface.graphRetrieve) {
+        return STATUS::FAIL;
+    }
+
+    for (auto* graphInfo : getGraphsInfo()) {
         if (QNN_SUCCESS
             != m_qnnInterface.graphRetrieve(
-                m_context, graphInfo.graphName, &graphInfo.graph))
+                m_context, graphInfo->graphName, &graphInfo->graph))
         {
             return STATUS::FAIL;
         }
@@ -385,22 +486,288 @@ auto Graph::retrieveGraphFromContext() -> STATUS {
     return STATUS::SUCCESS;
 }
 
-auto Graph::execute() -> STATUS {
+auto Graph::execute(Qnn_SignalHandle_t signal) -> STATUS {
+    const TraceScope trace {"graphExecute"};
+
     const auto executeStatus =
         m_qnnInterface.graphExecute(m_graphInfo->graph,
                                     m_graphInfo->inputTensors,
                                     m_graphInfo->numInputTensors,
                                     m_graphInfo->outputTensors,
                                     m_graphInfo->numOutputTensors,
-                                    nullptr,
-                                    nullptr);
+                                    m_profile,
+                                    signal);
     if (QNN_GRAPH_NO_ERROR != executeStatus) {
         return STATUS::FAIL;
     }
 
+    collectProfilingEvents(PROFILING_EVENT::EXECUTE);
+
     return STATUS::SUCCESS;
 }
 
+namespace {
+
+struct AsyncContext {
+    Graph* graph;
+    std::function<void(STATUS)> onComplete;
+};
+
+}  // namespace
+
+auto Graph::executeAsync(const size_t graphIndex,
+                         const nonstd::span<Qnn_Tensor_t> inputs,
+                         const nonstd::span<Qnn_Tensor_t> outputs,
+                         std::function<void(STATUS)> onComplete) -> STATUS {
+    if (graphIndex >= m_graphsCount) {
+        return STATUS::FAIL;
+    }
+
+    auto* graphInfo = getGraphsInfo()[graphIndex];
+
+    if (nullptr == m_qnnInterface.graphExecuteAsync) {
+        const TraceScope trace {"graphExecute"};
+
+        const auto executeStatus =
+            m_qnnInterface.graphExecute(graphInfo->graph,
+                                        inputs.data(),
+                                        static_cast<uint32_t>(inputs.size()),
+                                        outputs.data(),
+                                        static_cast<uint32_t>(outputs.size()),
+                                        nullptr,
+                                        nullptr);
+        onComplete(QNN_GRAPH_NO_ERROR == executeStatus ? STATUS::SUCCESS
+                                                       : STATUS::FAIL);
+        return STATUS::SUCCESS;
+    }
+
+    const TraceScope trace {"graphExecuteAsync"};
+
+    {
+        const std::lock_guard<std::mutex> lock(m_asyncMutex);
+        ++m_asyncInFlight;
+    }
+
+    /* owned by notifyAsync once submitted */
+    auto context = std::make_unique<AsyncContext>(
+        AsyncContext {this, std::move(onComplete)});
+
+    const auto submitStatus = m_qnnInterface.graphExecuteAsync(
+        graphInfo->graph,
+        inputs.data(),
+        static_cast<uint32_t>(inputs.size()),
+        outputs.data(),
+        static_cast<uint32_t>(outputs.size()),
+        nullptr,
+        nullptr,
+        &Graph::notifyAsync,
+        context.get());
+
+    if (QNN_GRAPH_NO_ERROR != submitStatus) {
+        {
+            const std::lock_guard<std::mutex> lock(m_asyncMutex);
+            --m_asyncInFlight;
+        }
+        m_asyncCondition.notify_all();
+        return STATUS::FAIL;
+    }
+
+    static_cast<void>(context.release());
+
+    return STATUS::SUCCESS;
+}
+
+void Graph::notifyAsync(void* notifyParam, Qnn_NotifyStatus_t notifyStatus) {
+    const std::unique_ptr<AsyncContext> context {
+        static_cast<AsyncContext*>(notifyParam)};
+
+    context->onComplete(QNN_SUCCESS == notifyStatus.error ? STATUS::SUCCESS
+                                                          : STATUS::FAIL);
+
+    auto* graph = context->graph;
+    {
+        const std::lock_guard<std::mutex> lock(graph->m_asyncMutex);
+        --graph->m_asyncInFlight;
+    }
+    graph->m_asyncCondition.notify_all();
+}
+
+auto Graph::setAsyncQueueDepth(const uint32_t queueDepth) -> STATUS {
+    Config<QnnGraph_Config_t, QnnHtpGraph_CustomConfig_t> graphConfigs {
+        QNN_GRAPH_CONFIG_INIT, QNN_HTP_GRAPH_CUSTOM_CONFIG_INIT};
+
+    auto& queueDepthConfig = graphConfigs.createConfig();
+    queueDepthConfig.option =
+        QNN_GRAPH_CONFIG_OPTION_ASYNC_EXECUTION_QUEUE_DEPTH;
+    queueDepthConfig.asyncExeQueueDepth /* NOLINT */.type =
+        QNN_GRAPH_ASYNC_EXECUTION_QUEUE_DEPTH_TYPE_NUMERIC;
+    queueDepthConfig.asyncExeQueueDepth /* NOLINT */.depth = queueDepth;
+
+    for (auto* graphInfo : getGraphsInfo()) {
+        const auto status = m_qnnInterface.graphSetConfig(
+            graphInfo->graph, graphConfigs.getPtr());
+
+        if (QNN_GRAPH_NO_ERROR != status) {
+            return STATUS::FAIL;
+        }
+    }
+
+    return STATUS::SUCCESS;
+}
+
+void Graph::waitForAsync() {
+    std::unique_lock<std::mutex> lock(m_asyncMutex);
+    m_asyncCondition.wait(lock, [this]() { return m_asyncInFlight == 0; });
+}
+
+auto Graph::createProfile(QNN_INTERFACE_VER_TYPE& qnnInterface,
+                          Qnn_BackendHandle_t& backendHandle,
+                          const PROFILING_LEVEL level) -> STATUS {
+    m_qnnInterface = qnnInterface;
+
+    freeProfile();
+
+    if (level == PROFILING_LEVEL::OFF) {
+        return STATUS::SUCCESS;
+    }
+
+    if (nullptr == m_qnnInterface.profileCreate) {
+        return STATUS::FAIL;
+    }
+
+    const auto qnnLevel = level == PROFILING_LEVEL::DETAILED
+        ? QNN_PROFILE_LEVEL_DETAILED
+        : QNN_PROFILE_LEVEL_BASIC;
+
+    if (QNN_PROFILE_NO_ERROR
+        != m_qnnInterface.profileCreate(backendHandle, qnnLevel, &m_profile))
+    {
+        m_profile = nullptr;
+        return STATUS::FAIL;
+    }
+
+    return STATUS::SUCCESS;
+}
+
+auto Graph::getProfilingEvents() -> std::vector<ProfilingEvent> {
+    auto events = std::move(m_profilingEvents);
+    m_profilingEvents.clear();
+    return events;
+}
+
+void Graph::freeProfile() {
+    if (m_profile != nullptr && m_qnnInterface.profileFree != nullptr) {
+        m_qnnInterface.profileFree(m_profile);
+    }
+    m_profile = nullptr;
+}
+
+void Graph::collectProfilingEvents(const PROFILING_EVENT phase) {
+    if (m_profile == nullptr || m_qnnInterface.profileGetEvents == nullptr) {
+        return;
+    }
+
+    /* events of a profile handle are reset by each API call using it, so
+     * collect them immediately after every profiled call */
+    const QnnProfile_EventId_t* eventIds {};
+    uint32_t numEvents {};
+    if (QNN_PROFILE_NO_ERROR
+        != m_qnnInterface.profileGetEvents(m_profile, &eventIds, &numEvents))
+    {
+        return;
+    }
+
+    const nonstd::span<const QnnProfile_EventId_t> events {eventIds,
+                                                           numEvents};
+    for (const auto eventId : events) {
+        appendProfilingEvent(eventId, phase);
+    }
+}
+
+void Graph::appendProfilingEvent(const QnnProfile_EventId_t eventId,
+                                 const PROFILING_EVENT phase) {
+    /* bound memory usage if events are never retrieved */
+    static constexpr size_t MaxProfilingEvents = 65536;
+    if (m_profilingEvents.size() >= MaxProfilingEvents) {
+        return;
+    }
+
+    QnnProfile_EventData_t eventData {};
+    if (QNN_PROFILE_NO_ERROR
+        != m_qnnInterface.profileGetEventData(eventId, &eventData))
+    {
+        return;
+    }
+
+    PROFILING_EVENT type = PROFILING_EVENT::OTHER;
+    switch (eventData.type) {
+        case QNN_PROFILE_EVENTTYPE_INIT:
+            type = phase == PROFILING_EVENT::DESERIALIZE
+                ? PROFILING_EVENT::DESERIALIZE
+                : PROFILING_EVENT::INIT;
+            break;
+        case QNN_PROFILE_EVENTTYPE_FINALIZE:
+            type = PROFILING_EVENT::FINALIZE;
+            break;
+        case QNN_PROFILE_EVENTTYPE_EXECUTE:
+            type = PROFILING_EVENT::EXECUTE;
+            break;
+        case QNN_PROFILE_EVENTTYPE_NODE:
+            type = PROFILING_EVENT::NODE;
+            break;
+        default:
+            break;
+    }
+
+    bool supportedUnit = true;
+    PROFILING_UNIT unit = PROFILING_UNIT::COUNT;
+    switch (eventData.unit) {
+        case QNN_PROFILE_EVENTUNIT_MICROSEC:
+            unit = PROFILING_UNIT::MICROSECONDS;
+            break;
+        case QNN_PROFILE_EVENTUNIT_CYCLES:
+            unit = PROFILING_UNIT::CYCLES;
+            break;
+        case QNN_PROFILE_EVENTUNIT_BYTES:
+            unit = PROFILING_UNIT::BYTES;
+            break;
+        case QNN_PROFILE_EVENTUNIT_COUNT:
+            unit = PROFILING_UNIT::COUNT;
+            break;
+        default:
+            supportedUnit = false;
+            break;
+    }
+
+    if (supportedUnit) {
+        m_profilingEvents.push_back(
+            {eventData.identifier != nullptr ? eventData.identifier : "",
+             type,
+             eventData.value,
+             unit});
+    }
+
+    /* per-node events are reported as sub-events at the detailed level */
+    if (m_qnnInterface.profileGetSubEvents == nullptr) {
+        return;
+    }
+
+    const QnnProfile_EventId_t* subEventIds {};
+    uint32_t numSubEvents {};
+    if (QNN_PROFILE_NO_ERROR
+        != m_qnnInterface.profileGetSubEvents(
+            eventId, &subEventIds, &numSubEvents))
+    {
+        return;
+    }
+
+    const nonstd::span<const QnnProfile_EventId_t> subEvents {subEventIds,
+                                                              numSubEvents};
+    for (const auto subEventId : subEvents) {
+        appendProfilingEvent(subEventId, phase);
+    }
+}
+
 auto Graph::setComposeGraphsFnHandle(
     ComposeGraphsFnHandleTypeT composeGraphsFnHandle) -> STATUS {
     m_composeGraphsFnHandle = composeGraphsFnHandle;
@@ -433,20 +800,23 @@ auto Graph::copyGraphsInfoV1(const QnnSystemContext_GraphInfoV1_t* graphInfoSrc,
     graphInfoDst->inputTensors = nullptr;
     graphInfoDst->numInputTensors = 0;
     if (graphInfoSrc->graphInputs != nullptr) {
-        m_inputTensors = createTensorsFromInfo(graphInfoSrc->graphInputs,
-                                               graphInfoSrc->numGraphInputs);
-        graphInfoDst->inputTensors = m_inputTensors.data();
+        /* each graph owns its tensors, moving the inner vectors on growth
+         * keeps their data pointers valid */
+        auto& inputTensors = m_inputTensors.emplace_back(createTensorsFromInfo(
+            graphInfoSrc->graphInputs, graphInfoSrc->numGraphInputs));
+        graphInfoDst->inputTensors = inputTensors.data();
         graphInfoDst->numInputTensors =
-            static_cast<uint32_t>(m_inputTensors.size());
+            static_cast<uint32_t>(inputTensors.size());
     }
     graphInfoDst->outputTensors = nullptr;
     graphInfoDst->numOutputTensors = 0;
     if (graphInfoSrc->graphOutputs != nullptr) {
-        m_outputTensors = createTensorsFromInfo(graphInfoSrc->graphOutputs,
-                                                graphInfoSrc->numGraphOutputs);
-        graphInfoDst->outputTensors = m_outputTensors.data();
+        auto& outputTensors =
+            m_outputTensors.emplace_back(createTensorsFromInfo(
+                graphInfoSrc->graphOutputs, graphInfoSrc->numGraphOutputs));
+        graphInfoDst->outputTensors = outputTensors.data();
         graphInfoDst->numOutputTensors =
-            static_cast<uint32_t>(m_outputTensors.size());
+            static_cast<uint32_t>(outputTensors.size());
     }
     return true;
 }
@@ -459,6 +829,8 @@ auto Graph::copyGraphsInfo(const QnnSystemContext_GraphInfo_t* graphsInput,
     m_graphs.resize(numGraphs);
     m_graphPtrs.clear();
     m_graphPtrs.reserve(numGraphs);
+    m_inputTensors.reserve(numGraphs);
+    m_outputTensors.reserve(numGraphs);
 
     for (auto& graph : m_graphs) {
         m_graphPtrs.push_back(&graph);
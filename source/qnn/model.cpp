@@ -1,95 +1,509 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <future>
 #include <ios>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <system_error>
 #include <vector>
 
 #include "edgerunner/model.hpp"
 
+#include <QnnSignal.h>
 #include <nonstd/span.hpp>
 
+#include "edgerunner/alignedBuffer.hpp"
+#include "edgerunner/bundle.hpp"
+#include "edgerunner/compression.hpp"
+#include "edgerunner/hash.hpp"
+#include "edgerunner/memoryStats.hpp"
+#include "edgerunner/metrics.hpp"
+#include "edgerunner/options.hpp"
+#include "edgerunner/profiling.hpp"
 #include "edgerunner/qnn/backend.hpp"
+#include "edgerunner/qnn/backendRegistry.hpp"
+#include "edgerunner/qnn/graph.hpp"
 #include "edgerunner/qnn/model.hpp"
 #include "edgerunner/qnn/tensor.hpp"
+#include "edgerunner/qnn/tensorOps.hpp"
 #include "edgerunner/tensor.hpp"
+#include "edgerunner/trace.hpp"
 
 namespace edge::qnn {
 
-std::unique_ptr<Backend> ModelImpl::m_backend = nullptr;
+namespace {
+
+/* HTP has no fp32 execution */
+auto supportsPrecision(const DELEGATE delegate, const TensorType precision)
+    -> bool {
+    switch (precision) {
+        case TensorType::FLOAT32:
+            return delegate != DELEGATE::NPU;
+        case TensorType::FLOAT16:
+        case TensorType::INT8:
+        case TensorType::UINT8:
+            return true;
+        default:
+            return false;
+    }
+}
+
+auto getAlignedNumBytes(Qnn_Tensor_t& tensorSpec) -> size_t {
+    return AlignedBuffer::alignUp(TensorImpl {&tensorSpec, false}.getNumBytes(),
+                                  AlignedBuffer::DefaultAlignment);
+}
+
+auto getAlignedNumBytes(const nonstd::span<Qnn_Tensor_t> tensorSpecs)
+    -> size_t {
+    size_t numBytes = 0;
+    for (auto& tensorSpec : tensorSpecs) {
+        numBytes += getAlignedNumBytes(tensorSpec);
+    }
+    return numBytes;
+}
+
+/* creates tensors backed by consecutive cache line aligned regions of an
+ * arena, starting at offset */
+auto createTensors(const nonstd::span<Qnn_Tensor_t> tensorSpecs,
+                   AlignedBuffer& arena,
+                   size_t& offset) -> std::vector<std::shared_ptr<Tensor>> {
+    std::vector<std::shared_ptr<Tensor>> tensors;
+    tensors.reserve(tensorSpecs.size());
+
+    for (auto& tensorSpec : tensorSpecs) {
+        const auto numBytes = TensorImpl {&tensorSpec, false}.getNumBytes();
+        const nonstd::span<uint8_t> buffer {
+            arena.data() + offset /* NOLINT */, numBytes};
+        offset += AlignedBuffer::alignUp(numBytes,
+                                         AlignedBuffer::DefaultAlignment);
+        tensors.emplace_back(std::make_shared<TensorImpl>(&tensorSpec, buffer));
+    }
 
-ModelImpl::ModelImpl(const std::filesystem::path& modelPath)
-    : Model(modelPath) {
-    const auto modelExtension = modelPath.extension().string().substr(1);
+    return tensors;
+}
+
+}  // namespace
+
+ModelImpl::ModelImpl(const std::filesystem::path& modelPath,
+                     const ModelOptions& options)
+    : Model(modelPath)
+    , m_modelPath(modelPath)
+    , m_asyncQueueDepth(std::max<size_t>(options.asyncQueueDepth, 1))
+    , m_htpOptions(options.htp) {
+    const auto compression = getCompression(modelPath);
+    const auto modelExtension =
+        getUncompressedPath(modelPath).extension().string().substr(1);
     m_loadCachedBinary = modelExtension == "bin";
 
+    /* shared libraries are loaded from a file */
+    if (compression != COMPRESSION::NONE && !m_loadCachedBinary) {
+        setCreationStatus(STATUS::FAIL);
+        return;
+    }
+
+    initialize(options, [this, &modelPath]() {
+        return m_loadCachedBinary ? loadContextBinary(modelPath)
+                                  : loadSharedLibrary(modelPath);
+    });
+}
+
+ModelImpl::ModelImpl(const nonstd::span<uint8_t>& modelBuffer,
+                     const ModelOptions& options)
+    : m_asyncQueueDepth(std::max<size_t>(options.asyncQueueDepth, 1))
+    , m_htpOptions(options.htp) {
+    /* the buffer is owned by the caller, hash it while accessible */
+    setModelHash(hashBytes(modelBuffer));
+
+    initialize(options, [this, &modelBuffer]() {
+        return loadContextBinary(modelBuffer);
+    });
+}
+
+ModelImpl::ModelImpl(const std::shared_ptr<Bundle>& bundle,
+                     const ModelOptions& options)
+    : Model(bundle)
+    , m_asyncQueueDepth(std::max<size_t>(options.asyncQueueDepth, 1))
+    , m_htpOptions(options.htp) {
+    /* the context binary is compiled for the backend, bundle sections stay
+     * mapped and are hashed on first use */
+    const auto modelBuffer = bundle->getDelegateCache(DELEGATE::NPU);
+
+    initialize(options, [this, &modelBuffer]() {
+        return loadContextBinary(modelBuffer);
+    });
+}
+
+void ModelImpl::initialize(const ModelOptions& options,
+                           const std::function<STATUS()>& load) {
+    if (options.precision.has_value()) {
+        m_htpOptions.precision = options.precision;
+    }
+
     setCreationStatus(initializeBackend());
     if (getCreationStatus() == STATUS::FAIL) {
         return;
     }
 
-    if (!m_loadCachedBinary) {
-        setCreationStatus(loadModel(modelPath));
-        setCreationStatus(composeGraphs());
-        setPrecision(detectPrecision());
-        setCreationStatus(
-            m_graph.setGraphConfig(m_backend->getDelegate(), getPrecision()));
-        setCreationStatus(m_graph.finalizeGraphs());
+    setCreationStatus(enableProfiling(options.profilingLevel));
+    {
+        const ScopedLatency loadLatency {getMetrics().getLoadLatency()};
+        setCreationStatus(load());
+    }
+    if (getCreationStatus() == STATUS::FAIL) {
+        return;
+    }
 
-        // m_graphInfo.saveContextBinary(name() + ".bin");
-    } else {
-        setCreationStatus(m_graph.loadSystemLibrary());
+    setCreationStatus(allocate());
+}
 
-        std::ifstream file(modelPath, std::ios::binary);
-        if (!file) {
-            setCreationStatus(STATUS::FAIL);
-            return;
-        }
+auto ModelImpl::loadSharedLibrary(const std::filesystem::path& modelPath)
+    -> STATUS {
+    if (loadModel(modelPath) != STATUS::SUCCESS
+        || composeGraphs(*m_graph, *m_backend) != STATUS::SUCCESS)
+    {
+        return STATUS::FAIL;
+    }
 
-        const auto bufferSize = std::filesystem::file_size(modelPath);
+    setPrecision(m_htpOptions.precision.value_or(detectPrecision()));
+    if (!supportsPrecision(m_backend->getDelegate(), getPrecision())
+        || m_graph->setGraphConfig(
+               m_backend->getDelegate(), getPrecision(), m_htpOptions)
+            != STATUS::SUCCESS)
+    {
+        return STATUS::FAIL;
+    }
 
-        std::vector<uint8_t> modelBuffer(bufferSize);
+    // m_graphInfo.saveContextBinary(name() + ".bin");
+    return m_graph->finalizeGraphs();
+}
 
-        if (!file.read(
-                reinterpret_cast<char*> /* NOLINT */ (modelBuffer.data()),
-                static_cast<std::streamsize>(modelBuffer.size())))
-        {
-            setCreationStatus(STATUS::FAIL);
-            return;
-        }
+auto ModelImpl::loadContextBinary(const std::filesystem::path& modelPath)
+    -> STATUS {
+    /* the context is created straight from the decompressed buffer */
+    if (getCompression(modelPath) != COMPRESSION::NONE) {
+        AlignedBuffer decompressed;
+        return loadContextBinary(decompressModel(modelPath, decompressed));
+    }
 
-        setCreationStatus(loadModel(modelBuffer));
+    std::ifstream file(modelPath, std::ios::binary);
+    if (!file) {
+        return STATUS::FAIL;
     }
 
-    setCreationStatus(allocate());
+    std::error_code errorCode;
+    const auto bufferSize = std::filesystem::file_size(modelPath, errorCode);
+    if (errorCode) {
+        return STATUS::FAIL;
+    }
+
+    std::vector<uint8_t> modelBuffer(bufferSize);
+    if (!file.read(reinterpret_cast<char*> /* NOLINT */ (modelBuffer.data()),
+                   static_cast<std::streamsize>(modelBuffer.size())))
+    {
+        return STATUS::FAIL;
+    }
+
+    return loadContextBinary(nonstd::span<uint8_t> {modelBuffer});
 }
 
-ModelImpl::ModelImpl(const nonstd::span<uint8_t>& modelBuffer) {
-    setCreationStatus(loadModel(modelBuffer));
+auto ModelImpl::loadContextBinary(const nonstd::span<uint8_t>& modelBuffer)
+    -> STATUS {
+    if (modelBuffer.empty()
+        || m_graph->loadSystemLibrary() != STATUS::SUCCESS)
+    {
+        return STATUS::FAIL;
+    }
+
+    return loadModel(modelBuffer);
+}
+
+ModelImpl::~ModelImpl() {
+    m_graph->waitForAsync();
+
+    /* signals belong to the backend */
+    freeSignal(m_signal);
+}
+
+auto ModelImpl::hashModel() const -> uint64_t {
+    /* bundle sections stay mapped for the lifetime of the model */
+    if (getBundle() != nullptr) {
+        return hashBytes(getBundle()->getDelegateCache(DELEGATE::NPU));
+    }
+
+    return m_modelPath.empty() ? 0 : hashFile(m_modelPath);
 }
 
 auto ModelImpl::loadModel(const std::filesystem::path& modelPath) -> STATUS {
-    return m_graph.loadFromSharedLibrary(modelPath);
+    std::error_code errorCode;
+    const auto modelBytes = std::filesystem::file_size(modelPath, errorCode);
+    m_modelBytes = errorCode ? 0 : static_cast<size_t>(modelBytes);
+
+    return m_graph->loadFromSharedLibrary(modelPath);
 }
 
 auto ModelImpl::loadModel(const nonstd::span<uint8_t>& modelBuffer) -> STATUS {
+    m_modelBytes = modelBuffer.size();
+
     return loadFromContextBinary(modelBuffer);
 }
 
 auto ModelImpl::applyDelegate(const DELEGATE& delegate) -> STATUS {
-    if (delegate != DELEGATE::NPU) {
+    if (m_backend == nullptr) {
         return STATUS::FAIL;
     }
 
-    setDelegate(delegate);
+    if (delegate == m_backend->getDelegate()) {
+        setDelegate(delegate);
+        return STATUS::SUCCESS;
+    }
+
+    /* context binaries are prepared for a single backend */
+    if (m_loadCachedBinary || m_modelPath.empty()
+        || !supportsPrecision(delegate, getPrecision()))
+    {
+        return STATUS::FAIL;
+    }
+
+    return recomposeGraphs(delegate, getPrecision());
+}
+
+auto ModelImpl::applyPrecision(const TensorType& precision) -> STATUS {
+    if (m_backend == nullptr
+        || !supportsPrecision(m_backend->getDelegate(), precision))
+    {
+        return STATUS::FAIL;
+    }
+
+    if (precision == getPrecision()) {
+        return STATUS::SUCCESS;
+    }
+
+    /* context binaries are prepared for a single precision */
+    if (m_loadCachedBinary || m_modelPath.empty()
+        || recomposeGraphs(m_backend->getDelegate(), precision)
+            != STATUS::SUCCESS)
+    {
+        return STATUS::FAIL;
+    }
+
+    m_htpOptions.precision = precision;
+    setPrecision(precision);
 
     return STATUS::SUCCESS;
 }
 
+auto ModelImpl::recomposeGraphs(const DELEGATE& delegate,
+                                const TensorType& precision) -> STATUS {
+    auto backend = BackendRegistry::get().acquire(delegate);
+    if (backend == nullptr) {
+        return STATUS::FAIL;
+    }
+
+    /* compose the graphs on the new backend before releasing the current
+     * ones, such that the model is left untouched on failure */
+    auto graph = std::make_unique<Graph>();
+    if (graph->loadFromSharedLibrary(m_modelPath) != STATUS::SUCCESS) {
+        return STATUS::FAIL;
+    }
+
+    if (getProfilingLevel() != PROFILING_LEVEL::OFF
+        && graph->createProfile(backend->getInterface(),
+                                backend->getHandle(),
+                                getProfilingLevel())
+            != STATUS::SUCCESS)
+    {
+        return STATUS::FAIL;
+    }
+
+    if (composeGraphs(*graph, *backend) != STATUS::SUCCESS
+        || graph->setGraphConfig(delegate, precision, m_htpOptions)
+            != STATUS::SUCCESS
+        || graph->finalizeGraphs() != STATUS::SUCCESS)
+    {
+        return STATUS::FAIL;
+    }
+
+    const auto graphNames = m_graph->getGraphNames();
+    const auto graphIndex = m_graph->getGraphIndex();
+    if (graphIndex < graphNames.size()
+        && graph->setGraph(graphNames[graphIndex]) != STATUS::SUCCESS)
+    {
+        return STATUS::FAIL;
+    }
+
+    m_graph->waitForAsync();
+    {
+        const std::lock_guard<std::mutex> lock(m_asyncMutex);
+        m_asyncSlots.clear();
+        m_nextAsyncSlot = 0;
+    }
+
+    freeSignal(m_signal);
+
+    m_graph = std::move(graph);
+    m_backend = std::move(backend);
+
+    setDelegate(delegate);
+
+    return allocate();
+}
+
 auto ModelImpl::execute() -> STATUS {
-    return m_graph.execute();
+    return executeSignaled(0);
+}
+
+auto ModelImpl::execute(const std::chrono::microseconds timeout) -> STATUS {
+    if (timeout.count() <= 0) {
+        return STATUS::FAIL;
+    }
+
+    return executeSignaled(static_cast<uint64_t>(timeout.count()));
+}
+
+auto ModelImpl::cancel() -> STATUS {
+    if (m_backend == nullptr
+        || m_backend->getInterface().signalTrigger == nullptr)
+    {
+        return STATUS::FAIL;
+    }
+
+    const std::lock_guard<std::mutex> lock(m_signalMutex);
+
+    /* nothing to cancel between executions */
+    if (m_activeSignal == nullptr || m_signalTriggered) {
+        return STATUS::SUCCESS;
+    }
+
+    if (m_backend->getInterface().signalTrigger(m_activeSignal) != QNN_SUCCESS)
+    {
+        return STATUS::FAIL;
+    }
+
+    m_signalTriggered = true;
+
+    return STATUS::SUCCESS;
+}
+
+auto ModelImpl::createSignal(const uint64_t timeoutUs) -> Qnn_SignalHandle_t {
+    auto& qnnInterface = m_backend->getInterface();
+    if (qnnInterface.signalCreate == nullptr) {
+        return nullptr;
+    }
+
+    QnnSignal_Config_t timeoutConfig = QNN_SIGNAL_CONFIG_INIT;
+    timeoutConfig.option = QNN_SIGNAL_CONFIG_OPTION_TIMEOUT;
+    timeoutConfig.timeoutDurationUs = timeoutUs;
+
+    const std::array<const QnnSignal_Config_t*, 2> configs = {&timeoutConfig,
+                                                              nullptr};
+
+    Qnn_SignalHandle_t signal = nullptr;
+    if (qnnInterface.signalCreate(m_backend->getHandle(),
+                                  timeoutUs > 0 ? configs.data() : nullptr,
+                                  &signal)
+        != QNN_SUCCESS)
+    {
+        return nullptr;
+    }
+
+    return signal;
+}
+
+void ModelImpl::freeSignal(Qnn_SignalHandle_t& signal) {
+    if (signal != nullptr && m_backend != nullptr
+        && m_backend->getInterface().signalFree != nullptr)
+    {
+        m_backend->getInterface().signalFree(signal);
+    }
+    signal = nullptr;
+}
+
+auto ModelImpl::executeSignaled(const uint64_t timeoutUs) -> STATUS {
+    const auto start = ModelMetrics::now();
+    const TraceScope trace {"execute", name().c_str()};
+
+    /* timeouts are fixed when a signal is created */
+    Qnn_SignalHandle_t signal = nullptr;
+    if (timeoutUs > 0) {
+        signal = createSignal(timeoutUs);
+        if (signal == nullptr) {
+            getMetrics().recordExecution(start, STATUS::FAIL);
+            return STATUS::FAIL;
+        }
+    } else {
+        if (m_signal == nullptr) {
+            m_signal = createSignal(0);
+        }
+        signal = m_signal;
+    }
+
+    {
+        const std::lock_guard<std::mutex> lock(m_signalMutex);
+        m_activeSignal = signal;
+        m_signalTriggered = false;
+    }
+
+    const auto status = m_graph->execute(signal);
+
+    bool triggered = false;
+    {
+        const std::lock_guard<std::mutex> lock(m_signalMutex);
+        m_activeSignal = nullptr;
+        triggered = m_signalTriggered;
+    }
+
+    /* signals with a timeout, and triggered signals, are not reused */
+    if (signal != m_signal) {
+        freeSignal(signal);
+    } else if (triggered) {
+        freeSignal(m_signal);
+    }
+
+    if (status == STATUS::SUCCESS) {
+        const auto graphIndex = m_graph->getGraphIndex();
+        for (auto& state : m_states) {
+            if (state.graphIndex == graphIndex) {
+                swapState(state);
+            }
+        }
+    }
+
+    getMetrics().recordExecution(start, status);
+
+    return status;
+}
+
+auto ModelImpl::enableProfiling(const PROFILING_LEVEL& level) -> STATUS {
+    if (m_graph->createProfile(
+            m_backend->getInterface(), m_backend->getHandle(), level)
+        != STATUS::SUCCESS)
+    {
+        return STATUS::FAIL;
+    }
+
+    setProfilingLevel(level);
+
+    return STATUS::SUCCESS;
+}
+
+auto ModelImpl::getProfilingEvents() -> std::vector<ProfilingEvent> {
+    return m_graph->getProfilingEvents();
+}
+
+auto ModelImpl::getMemoryStats() -> MemoryStats {
+    MemoryStats stats;
+    stats.modelBytes = m_modelBytes;
+    stats.ioBytes = m_ioArena.size();
+
+    return stats;
 }
 
 auto ModelImpl::loadFromContextBinary(const nonstd::span<uint8_t>& modelBuffer)
@@ -98,28 +512,36 @@ auto ModelImpl::loadFromContextBinary(const nonstd::span<uint8_t>& modelBuffer)
     auto& backendHandle = m_backend->getHandle();
     auto& deviceHandle = m_backend->getDeviceHandle();
 
-    if (m_graph.loadContextFromBinary(
-            qnnInterface, backendHandle, deviceHandle, modelBuffer)
+    if (m_graph->loadContextFromBinary(qnnInterface,
+                                       backendHandle,
+                                       deviceHandle,
+                                       modelBuffer,
+                                       m_htpOptions)
         != STATUS::SUCCESS)
     {
         return STATUS::FAIL;
     }
 
-    return m_graph.retrieveGraphFromContext();
+    return m_graph->retrieveGraphFromContext();
 }
 
-auto ModelImpl::composeGraphs() -> STATUS {
-    auto& qnnInterface = m_backend->getInterface();
-    auto& qnnBackendHandle = m_backend->getHandle();
-    auto& qnnDeviceHandle = m_backend->getDeviceHandle();
+auto ModelImpl::composeGraphs(Graph& graph, Backend& backend) -> STATUS {
+    auto& qnnInterface = backend.getInterface();
+    auto& qnnBackendHandle = backend.getHandle();
+    auto& qnnDeviceHandle = backend.getDeviceHandle();
 
-    m_graph.createContext(qnnInterface, qnnBackendHandle, qnnDeviceHandle);
+    if (graph.createContext(
+            qnnInterface, qnnBackendHandle, qnnDeviceHandle, m_htpOptions)
+        != STATUS::SUCCESS)
+    {
+        return STATUS::FAIL;
+    }
 
-    return m_graph.composeGraphs(qnnBackendHandle);
+    return graph.composeGraphs(qnnBackendHandle);
 }
 
 auto ModelImpl::detectPrecision() -> TensorType {
-    const auto inputTensorSpecs = m_graph.getInputs();
+    const auto inputTensorSpecs = m_graph->getInputs();
 
     std::vector<TensorImpl> inputs;
     inputs.reserve(inputTensorSpecs.size());
@@ -139,31 +561,263 @@ auto ModelImpl::detectPrecision() -> TensorType {
 }
 
 auto ModelImpl::allocate() -> STATUS {
-    auto& inputs = getInputs();
-    auto& outputs = getOutputs();
+    const ScopedLatency allocateLatency {getMetrics().getAllocateLatency()};
 
-    inputs.clear();
-    outputs.clear();
+    const auto graphCount = m_graph->getGraphCount();
+    if (graphCount == 0) {
+        return STATUS::FAIL;
+    }
 
-    const auto inputTensorSpecs = m_graph.getInputs();
-    const auto outputTensorSpecs = m_graph.getOutputs();
+    size_t arenaSize = 0;
+    for (size_t graphIndex = 0; graphIndex < graphCount; ++graphIndex) {
+        const auto inputTensorSpecs = m_graph->getInputs(graphIndex);
+        const auto outputTensorSpecs = m_graph->getOutputs(graphIndex);
 
+        if (inputTensorSpecs.data() == nullptr
+            || outputTensorSpecs.data() == nullptr)
+        {
+            return STATUS::FAIL;
+        }
+
+        arenaSize += getAlignedNumBytes(inputTensorSpecs)
+            + getAlignedNumBytes(outputTensorSpecs);
+    }
+
+    if (m_ioArena.size() != arenaSize) {
+        m_ioArena = AlignedBuffer {arenaSize};
+        if (arenaSize > 0 && m_ioArena.data() == nullptr) {
+            return STATUS::FAIL;
+        }
+    }
+
+    m_graphTensors.clear();
+    m_graphTensors.resize(graphCount);
+
+    size_t offset = 0;
+    for (size_t graphIndex = 0; graphIndex < graphCount; ++graphIndex) {
+        auto& graphTensors = m_graphTensors[graphIndex];
+        graphTensors.inputs =
+            createTensors(m_graph->getInputs(graphIndex), m_ioArena, offset);
+        graphTensors.outputs =
+            createTensors(m_graph->getOutputs(graphIndex), m_ioArena, offset);
+    }
+
+    /* tensors were recreated on their own buffers, restore swapped state */
+    for (auto& state : m_states) {
+        if (state.swapped) {
+            state.swapped = false;
+            swapState(state);
+        }
+    }
+
+    setGraphTensors();
+
+    return STATUS::SUCCESS;
+}
+
+void ModelImpl::setGraphTensors() {
+    const auto graphIndex = m_graph->getGraphIndex();
+
+    if (graphIndex >= m_graphTensors.size()) {
+        getInputs().clear();
+        getOutputs().clear();
+        return;
+    }
+
+    getInputs() = m_graphTensors[graphIndex].inputs;
+    getOutputs() = m_graphTensors[graphIndex].outputs;
+}
+
+auto ModelImpl::addState(const size_t inputIndex, const size_t outputIndex)
+    -> STATUS {
+    const auto graphIndex = m_graph->getGraphIndex();
+
+    const auto& inputs = getInputs();
+    const auto& outputs = getOutputs();
+    if (inputIndex >= inputs.size() || outputIndex >= outputs.size()) {
+        return STATUS::FAIL;
+    }
+
+    const auto isState = std::any_of(
+        m_states.cbegin(), m_states.cend(), [&](const StateTensors& state) {
+            return state.graphIndex == graphIndex
+                && (state.inputIndex == inputIndex
+                    || state.outputIndex == outputIndex);
+        });
+
+    auto input = inputs[inputIndex]->getTensorAs<uint8_t>();
+    auto output = outputs[outputIndex]->getTensorAs<uint8_t>();
+    if (isState || input.empty() || input.size() != output.size()
+        || inputs[inputIndex]->getType() != outputs[outputIndex]->getType())
+    {
+        return STATUS::FAIL;
+    }
+
+    std::fill(input.begin(), input.end(), uint8_t {0});
+    std::fill(output.begin(), output.end(), uint8_t {0});
+
+    m_states.push_back({graphIndex, inputIndex, outputIndex});
+
+    return STATUS::SUCCESS;
+}
+
+auto ModelImpl::resetState() -> STATUS {
+    for (const auto& state : m_states) {
+        auto& graphTensors = m_graphTensors[state.graphIndex];
+        for (auto* tensor : {graphTensors.inputs[state.inputIndex].get(),
+                             graphTensors.outputs[state.outputIndex].get()})
+        {
+            auto data = tensor->getTensorAs<uint8_t>();
+            std::fill(data.begin(), data.end(), uint8_t {0});
+        }
+    }
+
+    return STATUS::SUCCESS;
+}
+
+void ModelImpl::swapState(StateTensors& state) {
+    auto& input = m_graph->getInputs(state.graphIndex)[state.inputIndex];
+    auto& output = m_graph->getOutputs(state.graphIndex)[state.outputIndex];
+
+    const auto inputBuffer = getQnnTensorClientBuf(input);
+    setQnnTensorClientBuf(input, getQnnTensorClientBuf(output));
+    setQnnTensorClientBuf(output, inputBuffer);
+
+    state.swapped = !state.swapped;
+}
+
+auto ModelImpl::executeAsync() -> std::future<AsyncResult> {
+    const TraceScope trace {"executeAsync", name().c_str()};
+
+    std::unique_lock<std::mutex> lock(m_asyncMutex);
+
+    if (createAsyncSlots(lock) != STATUS::SUCCESS) {
+        std::promise<AsyncResult> promise;
+        promise.set_value({STATUS::FAIL, {}});
+        return promise.get_future();
+    }
+
+    auto& slot = *m_asyncSlots[m_nextAsyncSlot];
+    m_nextAsyncSlot = (m_nextAsyncSlot + 1) % m_asyncSlots.size();
+
+    /* bound the number of executions in flight */
+    m_asyncCondition.wait(lock, [&slot]() { return !slot.inFlight; });
+
+    const auto& inputs = getInputs();
+    for (size_t i = 0; i < slot.inputs.size() && i < inputs.size(); ++i) {
+        const auto source = inputs[i]->getTensorAs<uint8_t>();
+        auto destination = slot.inputs[i]->getTensorAs<uint8_t>();
+        std::copy_n(source.cbegin(),
+                    std::min(source.size(), destination.size()),
+                    destination.begin());
+    }
+
+    slot.inFlight = true;
+    slot.promise = std::promise<AsyncResult> {};
+    auto future = slot.promise.get_future();
+
+    /* completion may run inline, on this thread */
+    lock.unlock();
+
+    const auto start = ModelMetrics::now();
+
+    const auto onComplete = [this, &slot, start](const STATUS status) {
+        getMetrics().recordExecution(start, status);
+
+        std::promise<AsyncResult> promise;
+        AsyncResult result {status, {}};
+        {
+            const std::lock_guard<std::mutex> slotLock(m_asyncMutex);
+            promise = std::move(slot.promise);
+            /* the slot is reused by later submissions */
+            result.outputs = copyTensors(slot.outputs);
+            slot.inFlight = false;
+        }
+        m_asyncCondition.notify_all();
+
+        promise.set_value(std::move(result));
+    };
+
+    if (m_graph->executeAsync(
+            slot.graphIndex, slot.inputSpecs, slot.outputSpecs, onComplete)
+        != STATUS::SUCCESS)
+    {
+        onComplete(STATUS::FAIL);
+    }
+
+    return future;
+}
+
+auto ModelImpl::createAsyncSlots(std::unique_lock<std::mutex>& lock)
+    -> STATUS {
+    const auto graphIndex = m_graph->getGraphIndex();
+
+    if (!m_asyncSlots.empty() && m_asyncSlots.front()->graphIndex == graphIndex)
+    {
+        return STATUS::SUCCESS;
+    }
+
+    /* tensor sets of another graph are recreated once idle */
+    m_asyncCondition.wait(lock, [this]() {
+        return std::none_of(m_asyncSlots.cbegin(),
+                            m_asyncSlots.cend(),
+                            [](const auto& slot) { return slot->inFlight; });
+    });
+
+    m_asyncSlots.clear();
+    m_nextAsyncSlot = 0;
+
+    const auto inputTensorSpecs = m_graph->getInputs(graphIndex);
+    const auto outputTensorSpecs = m_graph->getOutputs(graphIndex);
     if (inputTensorSpecs.data() == nullptr
         || outputTensorSpecs.data() == nullptr)
     {
         return STATUS::FAIL;
     }
 
-    inputs.reserve(inputTensorSpecs.size());
-    for (auto& inputTensorSpec : inputTensorSpecs) {
-        inputs.emplace_back(std::make_shared<TensorImpl>(&inputTensorSpec));
+    /* best effort, graphs retrieved from a context may not accept it */
+    m_graph->setAsyncQueueDepth(static_cast<uint32_t>(m_asyncQueueDepth));
+
+    m_asyncSlots.reserve(m_asyncQueueDepth);
+    for (size_t i = 0; i < m_asyncQueueDepth; ++i) {
+        auto slot = std::make_unique<AsyncSlot>();
+        slot->graphIndex = graphIndex;
+
+        /* shallow copies, sharing names and dimensions with the graph */
+        slot->inputSpecs.assign(inputTensorSpecs.begin(),
+                                inputTensorSpecs.end());
+        slot->outputSpecs.assign(outputTensorSpecs.begin(),
+                                 outputTensorSpecs.end());
+
+        const auto bufferSize = getAlignedNumBytes(slot->inputSpecs)
+            + getAlignedNumBytes(slot->outputSpecs);
+        slot->buffer = AlignedBuffer {bufferSize};
+        if (bufferSize > 0 && slot->buffer.data() == nullptr) {
+            m_asyncSlots.clear();
+            return STATUS::FAIL;
+        }
+
+        size_t offset = 0;
+        slot->inputs = createTensors(slot->inputSpecs, slot->buffer, offset);
+        slot->outputs = createTensors(slot->outputSpecs, slot->buffer, offset);
+
+        m_asyncSlots.emplace_back(std::move(slot));
     }
 
-    outputs.reserve(outputTensorSpecs.size());
-    for (auto& outputTensorSpec : outputTensorSpecs) {
-        outputs.emplace_back(std::make_shared<TensorImpl>(&outputTensorSpec));
+    return STATUS::SUCCESS;
+}
+
+auto ModelImpl::getGraphNames() const -> std::vector<std::string> {
+    return m_graph->getGraphNames();
+}
+
+auto ModelImpl::selectGraph(const std::string& graphName) -> STATUS {
+    if (m_graph->setGraph(graphName) != STATUS::SUCCESS) {
+        return STATUS::FAIL;
     }
 
+    setGraphTensors();
+
     return STATUS::SUCCESS;
 }
 
@@ -22,17 +22,25 @@ TensorImpl::TensorImpl(Qnn_Tensor_t* qnnTensor, const bool allocate)
         return;
     }
 
+    m_data.resize(getNumBytes());
+
+    setClientBuffer(m_data);
+}
+
+TensorImpl::TensorImpl(Qnn_Tensor_t* qnnTensor,
+                       const nonstd::span<uint8_t> buffer)
+    : m_tensor(qnnTensor) {
+    setClientBuffer(buffer);
+}
+
+void TensorImpl::setClientBuffer(const nonstd::span<uint8_t> buffer) {
     /* TODO: use memhandle */
     setQnnTensorMemType(*m_tensor, QNN_TENSORMEMTYPE_RAW);
 
     Qnn_ClientBuffer_t clientBuffer = QNN_CLIENT_BUFFER_INIT;
 
-    const auto numBytes = getNumBytes();
-
-    m_data.resize(numBytes);
-
-    clientBuffer.data = m_data.data();
-    clientBuffer.dataSize = static_cast<uint32_t>(numBytes);
+    clientBuffer.data = buffer.data();
+    clientBuffer.dataSize = static_cast<uint32_t>(buffer.size());
 
     setQnnTensorClientBuf(*m_tensor, clientBuffer);
 }
@@ -0,0 +1,183 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "edgerunner/reloadableModel.hpp"
+
+#include "edgerunner/edgerunner.hpp"
+#include "edgerunner/model.hpp"
+#include "edgerunner/options.hpp"
+#include "edgerunner/tensor.hpp"
+#include "edgerunner/trace.hpp"
+
+namespace edge {
+
+namespace {
+
+/* interval at which replaced versions are checked for remaining holders */
+constexpr std::chrono::milliseconds ReclaimInterval {10};
+
+auto hasSameTensors(const std::vector<std::shared_ptr<Tensor>>& tensors,
+                    const std::vector<std::shared_ptr<Tensor>>& other) -> bool {
+    return std::equal(tensors.cbegin(),
+                      tensors.cend(),
+                      other.cbegin(),
+                      other.cend(),
+                      [](const auto& tensor, const auto& otherTensor) {
+                          return tensor->getType() == otherTensor->getType()
+                              && tensor->getDimensions()
+                              == otherTensor->getDimensions();
+                      });
+}
+
+}  // namespace
+
+ReloadableModel::ReloadableModel(std::unique_ptr<Model> model)
+    : m_model(std::move(model)) {
+    /* without a first version there is nothing to serve or reload */
+    if (m_model == nullptr) {
+        m_stopping = true;
+        return;
+    }
+
+    m_worker = std::thread(&ReloadableModel::run, this);
+}
+
+ReloadableModel::~ReloadableModel() {
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_condition.notify_all();
+
+    if (m_worker.joinable()) {
+        m_worker.join();
+    }
+}
+
+auto ReloadableModel::getCreationStatus() const -> STATUS {
+    return m_worker.joinable() ? STATUS::SUCCESS : STATUS::FAIL;
+}
+
+auto ReloadableModel::acquire() const -> std::shared_ptr<Model> {
+    return std::atomic_load(&m_model);
+}
+
+auto ReloadableModel::getVersion() const -> uint64_t {
+    return m_version.load();
+}
+
+auto ReloadableModel::reload(const std::filesystem::path& modelPath,
+                             const ModelOptions& options)
+    -> std::future<STATUS> {
+    return reload([this, modelPath, options]() -> std::unique_ptr<Model> {
+        auto model = createModel(modelPath, options);
+
+        /* keep serving on the delegate of the current version */
+        const auto delegate = acquire()->getDelegate();
+        if (model != nullptr && model->getDelegate() != delegate
+            && model->applyDelegate(delegate) != STATUS::SUCCESS)
+        {
+            return nullptr;
+        }
+
+        return model;
+    });
+}
+
+auto ReloadableModel::reload(Loader loader) -> std::future<STATUS> {
+    Pending pending {std::move(loader), {}};
+    auto future = pending.promise.get_future();
+
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        if (!pending.loader || m_stopping) {
+            pending.promise.set_value(STATUS::FAIL);
+            return future;
+        }
+
+        m_queue.push_back(std::move(pending));
+    }
+    m_condition.notify_all();
+
+    return future;
+}
+
+void ReloadableModel::run() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        const auto ready = [this]() { return m_stopping || !m_queue.empty(); };
+
+        /* poll for released versions while any are retired */
+        if (m_retired.empty()) {
+            m_condition.wait(lock, ready);
+        } else {
+            m_condition.wait_for(lock, ReclaimInterval, ready);
+        }
+
+        if (m_queue.empty()) {
+            if (m_stopping) {
+                return;
+            }
+
+            lock.unlock();
+            reclaim();
+            lock.lock();
+            continue;
+        }
+
+        auto pending = std::move(m_queue.front());
+        m_queue.pop_front();
+
+        lock.unlock();
+        pending.promise.set_value(swapIn(pending.loader));
+        reclaim();
+        lock.lock();
+    }
+}
+
+auto ReloadableModel::swapIn(const Loader& loader) -> STATUS {
+    const TraceScope trace {"reload"};
+
+    std::shared_ptr<Model> model = loader();
+    if (model == nullptr) {
+        return STATUS::FAIL;
+    }
+
+    /* callers fill and read tensors as laid out by the current version */
+    const auto current = acquire();
+    if (!hasSameTensors(model->getInputs(), current->getInputs())
+        || !hasSameTensors(model->getOutputs(), current->getOutputs()))
+    {
+        return STATUS::FAIL;
+    }
+
+    /* the first execution initializes kernels and delegate resources */
+    if (model->execute() != STATUS::SUCCESS) {
+        return STATUS::FAIL;
+    }
+
+    m_retired.push_back(std::atomic_exchange(&m_model, std::move(model)));
+    m_version.fetch_add(1);
+
+    return STATUS::SUCCESS;
+}
+
+void ReloadableModel::reclaim() {
+    /* a retired version cannot be acquired anymore, once the worker holds the
+     * only reference no caller can use it */
+    m_retired.erase(std::remove_if(m_retired.begin(),
+                                   m_retired.end(),
+                                   [](const std::shared_ptr<Model>& model) {
+                                       return model.use_count() == 1;
+                                   }),
+                    m_retired.end());
+}
+
+}  // namespace edge
@@ -0,0 +1,114 @@
+/* edgerunnerd: serves models to other processes, see remote::Server
+ *
+ * usage: edgerunnerd [--socket PATH] [--delegate cpu|gpu|npu]
+ *                    [--model-dir DIRECTORY] [MODEL...]
+ *
+ * Models given on the command line are loaded at startup, models within the
+ * model directory are loaded on first request. Other models are not served.
+ * Runs until interrupted.
+ */
+
+#include <csignal>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/core.h>
+#include <pthread.h>
+
+#include "edgerunner/edgerunner.hpp"
+#include "edgerunner/model.hpp"
+#include "edgerunner/remote/protocol.hpp"
+#include "edgerunner/remote/server.hpp"
+
+namespace {
+
+auto parseDelegate(const std::string& name, edge::DELEGATE& delegate) -> bool {
+    if (name == "cpu") {
+        delegate = edge::DELEGATE::CPU;
+    } else if (name == "gpu") {
+        delegate = edge::DELEGATE::GPU;
+    } else if (name == "npu") {
+        delegate = edge::DELEGATE::NPU;
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+    const std::vector<std::string> arguments {argv + 1, argv + argc};
+
+    auto socketPath = edge::remote::getDefaultSocketPath();
+    auto delegate = edge::DELEGATE::CPU;
+    std::filesystem::path modelDirectory;
+    std::vector<std::string> modelPaths;
+
+    for (size_t i = 0; i < arguments.size(); ++i) {
+        const auto& argument = arguments[i];
+        const auto hasValue = i + 1 < arguments.size();
+
+        if (argument == "--socket" && hasValue) {
+            socketPath = arguments[++i];
+        } else if (argument == "--delegate" && hasValue) {
+            if (!parseDelegate(arguments[++i], delegate)) {
+                fmt::print(stderr, "unknown delegate {}\n", arguments[i]);
+                return EXIT_FAILURE;
+            }
+        } else if (argument == "--model-dir" && hasValue) {
+            modelDirectory = arguments[++i];
+        } else if (argument.rfind("--", 0) == 0) {
+            fmt::print(stderr,
+                       "usage: edgerunnerd [--socket PATH] "
+                       "[--delegate cpu|gpu|npu] [--model-dir DIRECTORY] "
+                       "[MODEL...]\n");
+            return EXIT_FAILURE;
+        } else {
+            modelPaths.push_back(argument);
+        }
+    }
+
+    /* handle termination signals synchronously, also in server threads */
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+    edge::remote::Server server {socketPath, {}, modelDirectory};
+
+    for (const auto& modelPath : modelPaths) {
+        std::shared_ptr<edge::Model> model = edge::createModel(modelPath);
+        if (model == nullptr) {
+            fmt::print(stderr, "failed to load {}\n", modelPath);
+            return EXIT_FAILURE;
+        }
+
+        if (model->applyDelegate(delegate) != edge::STATUS::SUCCESS) {
+            fmt::print(stderr, "failed to apply delegate to {}\n", modelPath);
+        }
+
+        server.addModel(modelPath, std::move(model));
+    }
+
+    if (server.start() != edge::STATUS::SUCCESS) {
+        fmt::print(stderr, "failed to listen on {}\n", socketPath.string());
+        return EXIT_FAILURE;
+    }
+
+    fmt::print("serving on {}\n", socketPath.string());
+
+    int signal {};
+    sigwait(&signals, &signal);
+
+    server.stop();
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,186 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "edgerunner/remote/model.hpp"
+
+#include <nonstd/span.hpp>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "edgerunner/metrics.hpp"
+#include "edgerunner/model.hpp"
+#include "edgerunner/options.hpp"
+#include "edgerunner/remote/protocol.hpp"
+#include "edgerunner/remote/sharedBuffer.hpp"
+#include "edgerunner/remote/tensor.hpp"
+#include "edgerunner/trace.hpp"
+
+namespace edge::remote {
+
+ModelImpl::ModelImpl(const std::filesystem::path& modelPath,
+                     const ModelOptions& options)
+    : Model(modelPath)
+    , m_socketPath(options.remoteSocketPath) {
+    const ScopedLatency loadLatency {getMetrics().getLoadLatency()};
+    setCreationStatus(loadModel(modelPath));
+}
+
+ModelImpl::~ModelImpl() {
+    if (m_socket >= 0) {
+        close(m_socket);
+    }
+}
+
+auto ModelImpl::connect() -> STATUS {
+    if (m_socket >= 0) {
+        return STATUS::SUCCESS;
+    }
+
+    sockaddr_un address {};
+    address.sun_family = AF_UNIX;
+
+    const auto path = m_socketPath.string();
+    if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+        return STATUS::FAIL;
+    }
+    std::copy(path.cbegin(), path.cend(), std::begin(address.sun_path));
+
+    m_socket = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (m_socket < 0) {
+        return STATUS::FAIL;
+    }
+
+    if (::connect(m_socket,
+                  reinterpret_cast<sockaddr*>(&address),  // NOLINT
+                  sizeof(address))
+        != 0)
+    {
+        close(m_socket);
+        m_socket = -1;
+        return STATUS::FAIL;
+    }
+
+    return STATUS::SUCCESS;
+}
+
+auto ModelImpl::request(const Message& message, Message& reply) -> STATUS {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (connect() != STATUS::SUCCESS
+        || sendMessage(m_socket, message) != STATUS::SUCCESS
+        || receiveMessage(m_socket, reply) != STATUS::SUCCESS)
+    {
+        return STATUS::FAIL;
+    }
+
+    return reply.header.type == message.header.type
+            && reply.header.status == static_cast<uint32_t>(STATUS::SUCCESS)
+        ? STATUS::SUCCESS
+        : STATUS::FAIL;
+}
+
+auto ModelImpl::loadModel(const std::filesystem::path& modelPath) -> STATUS {
+    const TraceScope trace {"loadModel", name().c_str()};
+
+    const auto path = modelPath.string();
+
+    Message message;
+    message.header.type = MESSAGE::LOAD;
+    message.payload.assign(path.cbegin(), path.cend());
+
+    Message reply;
+    const auto status = request(message, reply);
+
+    /* take ownership of the shared memory first, also on failure */
+    std::vector<SharedBuffer> buffers;
+    buffers.reserve(reply.fileDescriptors.size());
+    for (const auto fileDescriptor : reply.fileDescriptors) {
+        buffers.push_back(SharedBuffer::fromFileDescriptor(fileDescriptor));
+    }
+
+    ModelDescription description;
+    if (status != STATUS::SUCCESS
+        || decodeModelDescription(reply.payload, description)
+            != STATUS::SUCCESS
+        || buffers.size()
+            != description.inputs.size() + description.outputs.size())
+    {
+        return STATUS::FAIL;
+    }
+
+    const auto isMapped = std::all_of(
+        buffers.cbegin(), buffers.cend(), [](const SharedBuffer& buffer) {
+            return buffer.data() != nullptr;
+        });
+    if (!isMapped) {
+        return STATUS::FAIL;
+    }
+
+    auto buffer = buffers.begin();
+
+    auto& inputs = getInputs();
+    inputs.clear();
+    for (auto& input : description.inputs) {
+        inputs.emplace_back(
+            std::make_shared<TensorImpl>(std::move(input), std::move(*buffer++)));
+    }
+
+    auto& outputs = getOutputs();
+    outputs.clear();
+    for (auto& output : description.outputs) {
+        outputs.emplace_back(std::make_shared<TensorImpl>(std::move(output),
+                                                          std::move(*buffer++)));
+    }
+
+    setDelegate(description.delegate);
+    setPrecision(description.precision);
+
+    return STATUS::SUCCESS;
+}
+
+auto ModelImpl::loadModel(const nonstd::span<uint8_t>& /*modelBuffer*/)
+    -> STATUS {
+    return STATUS::FAIL;
+}
+
+auto ModelImpl::applyDelegate(const DELEGATE& delegate) -> STATUS {
+    const TraceScope trace {"applyDelegate", name().c_str()};
+
+    Message message;
+    message.header.type = MESSAGE::APPLY_DELEGATE;
+    message.header.argument = static_cast<uint32_t>(delegate);
+
+    Message reply;
+    const auto status = request(message, reply);
+
+    /* the daemon reports the delegate in use, also on failure */
+    if (reply.header.type == MESSAGE::APPLY_DELEGATE) {
+        setDelegate(static_cast<DELEGATE>(reply.header.argument));
+    }
+
+    return status;
+}
+
+auto ModelImpl::execute() -> STATUS {
+    const auto start = ModelMetrics::now();
+    const TraceScope trace {"execute", name().c_str()};
+
+    Message message;
+    message.header.type = MESSAGE::EXECUTE;
+
+    Message reply;
+    const auto status = request(message, reply);
+
+    getMetrics().recordExecution(start, status);
+
+    return status;
+}
+
+}  // namespace edge::remote
@@ -0,0 +1,281 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "edgerunner/remote/protocol.hpp"
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "edgerunner/model.hpp"
+#include "edgerunner/tensor.hpp"
+
+namespace edge::remote {
+
+namespace {
+
+/* appends fixed size values and strings to a payload */
+class PayloadWriter {
+  public:
+    explicit PayloadWriter(std::vector<uint8_t>& payload)
+        : m_payload(payload) {}
+
+    void write(const uint64_t value) {
+        const auto offset = m_payload.size();
+        m_payload.resize(offset + sizeof(value));
+        std::memcpy(m_payload.data() + offset, &value, sizeof(value));
+    }
+
+    void write(const std::string& value) {
+        write(value.size());
+        m_payload.insert(m_payload.end(), value.cbegin(), value.cend());
+    }
+
+  private:
+    std::vector<uint8_t>& m_payload;
+};
+
+/* reads back values written by PayloadWriter, failing past the end */
+class PayloadReader {
+  public:
+    explicit PayloadReader(const std::vector<uint8_t>& payload)
+        : m_payload(payload) {}
+
+    auto read(uint64_t& value) -> STATUS {
+        if (m_payload.size() - m_offset < sizeof(value)) {
+            return STATUS::FAIL;
+        }
+
+        std::memcpy(&value, m_payload.data() + m_offset, sizeof(value));
+        m_offset += sizeof(value);
+
+        return STATUS::SUCCESS;
+    }
+
+    auto read(std::string& value) -> STATUS {
+        uint64_t size {};
+        if (read(size) != STATUS::SUCCESS || m_payload.size() - m_offset < size)
+        {
+            return STATUS::FAIL;
+        }
+
+        const auto* begin = m_payload.data() + m_offset;
+        value.assign(begin, begin + size);
+        m_offset += size;
+
+        return STATUS::SUCCESS;
+    }
+
+  private:
+    const std::vector<uint8_t>& m_payload;
+    size_t m_offset = 0;
+};
+
+void encodeTensors(PayloadWriter& writer,
+                   const std::vector<TensorDescription>& tensors) {
+    writer.write(tensors.size());
+
+    for (const auto& tensor : tensors) {
+        writer.write(tensor.name);
+        writer.write(static_cast<uint64_t>(tensor.type));
+        writer.write(tensor.dimensions.size());
+        for (const auto dimension : tensor.dimensions) {
+            writer.write(dimension);
+        }
+    }
+}
+
+auto decodeTensors(PayloadReader& reader,
+                   std::vector<TensorDescription>& tensors) -> STATUS {
+    uint64_t numTensors {};
+    if (reader.read(numTensors) != STATUS::SUCCESS
+        || numTensors > Message::MaxFileDescriptors)
+    {
+        return STATUS::FAIL;
+    }
+
+    tensors.resize(numTensors);
+    for (auto& tensor : tensors) {
+        uint64_t type {};
+        uint64_t numDimensions {};
+        if (reader.read(tensor.name) != STATUS::SUCCESS
+            || reader.read(type) != STATUS::SUCCESS
+            || reader.read(numDimensions) != STATUS::SUCCESS
+            || numDimensions > Message::MaxSize)
+        {
+            return STATUS::FAIL;
+        }
+
+        tensor.type = static_cast<TensorType>(type);
+        tensor.dimensions.resize(numDimensions);
+        for (auto& dimension : tensor.dimensions) {
+            uint64_t value {};
+            if (reader.read(value) != STATUS::SUCCESS) {
+                return STATUS::FAIL;
+            }
+            dimension = value;
+        }
+    }
+
+    return STATUS::SUCCESS;
+}
+
+}  // namespace
+
+auto getDefaultSocketPath() -> std::filesystem::path {
+    const auto* runtimeDirectory =
+        std::getenv("XDG_RUNTIME_DIR");  // NOLINT(concurrency-mt-unsafe)
+    if (runtimeDirectory != nullptr && runtimeDirectory[0] != '\0') {
+        return std::filesystem::path {runtimeDirectory} / "edgerunner.sock";
+    }
+
+    std::error_code error;
+    auto directory = std::filesystem::temp_directory_path(error);
+    if (error) {
+        directory = ".";
+    }
+
+    return directory / "edgerunner.sock";
+}
+
+auto sendMessage(const int socket, const Message& message) -> STATUS {
+    if (message.payload.size() > Message::MaxSize - sizeof(MessageHeader)
+        || message.fileDescriptors.size() > Message::MaxFileDescriptors)
+    {
+        return STATUS::FAIL;
+    }
+
+    auto header = message.header;
+    header.payloadSize = static_cast<uint32_t>(message.payload.size());
+
+    std::array<iovec, 2> buffers {};
+    buffers[0] = {&header, sizeof(header)};
+    buffers[1] = {const_cast<uint8_t*>(message.payload.data()),  // NOLINT
+                  message.payload.size()};
+
+    msghdr messageHeader {};
+    messageHeader.msg_iov = buffers.data();
+    messageHeader.msg_iovlen = buffers.size();
+
+    const auto numFileDescriptorBytes =
+        message.fileDescriptors.size() * sizeof(int);
+    std::vector<uint8_t> control(CMSG_SPACE(numFileDescriptorBytes));
+    if (!message.fileDescriptors.empty()) {
+        messageHeader.msg_control = control.data();
+        messageHeader.msg_controllen = control.size();
+
+        auto* controlHeader = CMSG_FIRSTHDR(&messageHeader);
+        controlHeader->cmsg_level = SOL_SOCKET;
+        controlHeader->cmsg_type = SCM_RIGHTS;
+        controlHeader->cmsg_len = CMSG_LEN(numFileDescriptorBytes);
+        std::memcpy(CMSG_DATA(controlHeader),
+                    message.fileDescriptors.data(),
+                    numFileDescriptorBytes);
+    }
+
+    const auto numBytes = sizeof(header) + message.payload.size();
+    const auto sent = sendmsg(socket, &messageHeader, MSG_NOSIGNAL);
+
+    return sent == static_cast<ssize_t>(numBytes) ? STATUS::SUCCESS
+                                                   : STATUS::FAIL;
+}
+
+auto receiveMessage(const int socket, Message& message) -> STATUS {
+    std::vector<uint8_t> buffer(Message::MaxSize);
+    iovec bufferVector {buffer.data(), buffer.size()};
+
+    std::vector<uint8_t> control(
+        CMSG_SPACE(Message::MaxFileDescriptors * sizeof(int)));
+
+    msghdr messageHeader {};
+    messageHeader.msg_iov = &bufferVector;
+    messageHeader.msg_iovlen = 1;
+    messageHeader.msg_control = control.data();
+    messageHeader.msg_controllen = control.size();
+
+    const auto received = recvmsg(socket, &messageHeader, MSG_CMSG_CLOEXEC);
+
+    /* take ownership of received descriptors, also of malformed messages */
+    message.fileDescriptors.clear();
+    for (auto* controlHeader = CMSG_FIRSTHDR(&messageHeader);
+         received > 0 && controlHeader != nullptr;
+         controlHeader = CMSG_NXTHDR(&messageHeader, controlHeader))
+    {
+        if (controlHeader->cmsg_level != SOL_SOCKET
+            || controlHeader->cmsg_type != SCM_RIGHTS)
+        {
+            continue;
+        }
+
+        const auto numFileDescriptors =
+            (controlHeader->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+        const auto offset = message.fileDescriptors.size();
+        message.fileDescriptors.resize(offset + numFileDescriptors);
+        std::memcpy(message.fileDescriptors.data() + offset,
+                    CMSG_DATA(controlHeader),
+                    numFileDescriptors * sizeof(int));
+    }
+
+    const auto isValid = received >= static_cast<ssize_t>(sizeof(MessageHeader))
+        && (messageHeader.msg_flags & (MSG_TRUNC | MSG_CTRUNC)) == 0;
+
+    if (isValid) {
+        std::memcpy(&message.header, buffer.data(), sizeof(MessageHeader));
+    }
+
+    if (!isValid || message.header.magic != MessageHeader::Magic
+        || message.header.payloadSize
+            != static_cast<size_t>(received) - sizeof(MessageHeader))
+    {
+        for (const auto fileDescriptor : message.fileDescriptors) {
+            close(fileDescriptor);
+        }
+        message.fileDescriptors.clear();
+        return STATUS::FAIL;
+    }
+
+    const auto* payload = buffer.data() + sizeof(MessageHeader);
+    message.payload.assign(payload, payload + message.header.payloadSize);
+
+    return STATUS::SUCCESS;
+}
+
+auto encodeModelDescription(const ModelDescription& description)
+    -> std::vector<uint8_t> {
+    std::vector<uint8_t> payload;
+    PayloadWriter writer {payload};
+
+    writer.write(static_cast<uint64_t>(description.delegate));
+    writer.write(static_cast<uint64_t>(description.precision));
+    encodeTensors(writer, description.inputs);
+    encodeTensors(writer, description.outputs);
+
+    return payload;
+}
+
+auto decodeModelDescription(const std::vector<uint8_t>& payload,
+                            ModelDescription& description) -> STATUS {
+    PayloadReader reader {payload};
+
+    uint64_t delegate {};
+    uint64_t precision {};
+    if (reader.read(delegate) != STATUS::SUCCESS
+        || reader.read(precision) != STATUS::SUCCESS
+        || decodeTensors(reader, description.inputs) != STATUS::SUCCESS
+        || decodeTensors(reader, description.outputs) != STATUS::SUCCESS)
+    {
+        return STATUS::FAIL;
+    }
+
+    description.delegate = static_cast<DELEGATE>(delegate);
+    description.precision = static_cast<TensorType>(precision);
+
+    return STATUS::SUCCESS;
+}
+
+}  // namespace edge::remote
@@ -0,0 +1,401 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "edgerunner/remote/server.hpp"
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "edgerunner/edgerunner.hpp"
+#include "edgerunner/model.hpp"
+#include "edgerunner/remote/protocol.hpp"
+#include "edgerunner/remote/sharedBuffer.hpp"
+#include "edgerunner/trace.hpp"
+
+namespace edge::remote {
+
+namespace {
+
+/* copies a tensor unless the shared memory is bound as its data */
+void copyUnlessBound(const nonstd::span<uint8_t> destination,
+                     const nonstd::span<uint8_t> source) {
+    if (destination.data() != source.data()) {
+        std::memcpy(destination.data(),
+                    source.data(),
+                    std::min(destination.size(), source.size()));
+    }
+}
+
+/* whether the peer of a connection runs as the user of this process */
+auto isSameUser(const int socket) -> bool {
+    ucred credentials {};
+    socklen_t length = sizeof(credentials);
+    if (getsockopt(socket, SOL_SOCKET, SO_PEERCRED, &credentials, &length)
+        != 0)
+    {
+        return false;
+    }
+
+    return credentials.uid == getuid();
+}
+
+}  // namespace
+
+Server::Server(std::filesystem::path socketPath,
+               ModelOptions options,
+               std::filesystem::path modelDirectory)
+    : m_socketPath(std::move(socketPath))
+    , m_options(std::move(options))
+    , m_modelDirectory(std::move(modelDirectory)) {
+    /* the server loads models locally */
+    m_options.remoteSocketPath.clear();
+}
+
+Server::~Server() {
+    stop();
+}
+
+auto Server::addModel(const std::string& modelPath,
+                      std::shared_ptr<Model> model) -> STATUS {
+    if (model == nullptr) {
+        return STATUS::FAIL;
+    }
+
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto sharedModel = std::make_shared<SharedModel>();
+    sharedModel->model = std::move(model);
+
+    return m_models.emplace(modelPath, std::move(sharedModel)).second
+        ? STATUS::SUCCESS
+        : STATUS::FAIL;
+}
+
+auto Server::start() -> STATUS {
+    if (m_socket >= 0) {
+        return STATUS::FAIL;
+    }
+
+    sockaddr_un address {};
+    address.sun_family = AF_UNIX;
+
+    const auto path = m_socketPath.string();
+    if (path.size() >= sizeof(address.sun_path)) {
+        return STATUS::FAIL;
+    }
+    std::copy(path.cbegin(), path.cend(), std::begin(address.sun_path));
+
+    m_socket = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (m_socket < 0) {
+        return STATUS::FAIL;
+    }
+
+    /* replace a socket left behind by a previous server */
+    unlink(path.c_str());
+
+    /* connections are refused until listening, restrict access before */
+    if (bind(m_socket,
+             reinterpret_cast<sockaddr*>(&address),  // NOLINT
+             sizeof(address))
+            != 0
+        || chmod(path.c_str(), S_IRUSR | S_IWUSR) != 0
+        || listen(m_socket, SOMAXCONN) != 0)
+    {
+        close(m_socket);
+        m_socket = -1;
+        return STATUS::FAIL;
+    }
+
+    m_acceptThread = std::thread(&Server::acceptClients, this);
+
+    return STATUS::SUCCESS;
+}
+
+void Server::stop() {
+    if (m_socket < 0) {
+        return;
+    }
+
+    /* wakes up the accept thread */
+    shutdown(m_socket, SHUT_RDWR);
+    m_acceptThread.join();
+
+    close(m_socket);
+    m_socket = -1;
+    unlink(m_socketPath.c_str());
+
+    std::list<Connection> connections;
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& connection : m_connections) {
+            shutdown(connection.socket, SHUT_RDWR);
+        }
+        connections.splice(connections.end(), m_connections);
+    }
+
+    for (auto& connection : connections) {
+        connection.thread.join();
+        close(connection.socket);
+    }
+}
+
+void Server::acceptClients() {
+    while (true) {
+        const auto client = accept4(m_socket, nullptr, nullptr, SOCK_CLOEXEC);
+        if (client < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            return;
+        }
+
+        if (!isSameUser(client)) {
+            close(client);
+            continue;
+        }
+
+        const std::lock_guard<std::mutex> lock(m_mutex);
+
+        /* reap disconnected clients */
+        for (auto it = m_connections.begin(); it != m_connections.end();) {
+            if (it->finished) {
+                it->thread.join();
+                close(it->socket);
+                it = m_connections.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        auto& connection = m_connections.emplace_back();
+        connection.socket = client;
+        connection.thread =
+            std::thread(&Server::serveClient, this, std::ref(connection));
+    }
+}
+
+void Server::serveClient(Connection& connection) {
+    std::shared_ptr<SharedModel> sharedModel;
+    auto buffers = std::make_shared<SessionBuffers>();
+
+    Message request;
+    while (receiveMessage(connection.socket, request) == STATUS::SUCCESS) {
+        /* clients do not pass file descriptors */
+        for (const auto fileDescriptor : request.fileDescriptors) {
+            close(fileDescriptor);
+        }
+
+        Message reply;
+        reply.header.type = request.header.type;
+
+        auto status = STATUS::FAIL;
+        switch (request.header.type) {
+            case MESSAGE::LOAD: {
+                if (sharedModel != nullptr) {
+                    break;
+                }
+
+                const std::string modelPath {request.payload.cbegin(),
+                                             request.payload.cend()};
+                sharedModel = getModel(modelPath);
+                if (sharedModel == nullptr) {
+                    break;
+                }
+
+                const std::lock_guard<std::mutex> lock(sharedModel->mutex);
+                auto& model = *sharedModel->model;
+
+                ModelDescription description;
+                description.delegate = model.getDelegate();
+                description.precision = model.getPrecision();
+
+                const auto share = [&reply](auto& tensors,
+                                            auto& descriptions,
+                                            auto& sharedBuffers) {
+                    for (auto& tensor : tensors) {
+                        descriptions.push_back({tensor->getName(),
+                                                tensor->getType(),
+                                                tensor->getDimensions()});
+
+                        auto& buffer = sharedBuffers.emplace_back(
+                            SharedBuffer::create(
+                                tensor->getName(),
+                                tensor->template getTensorAs<uint8_t>().size()));
+                        if (buffer.data() == nullptr) {
+                            return STATUS::FAIL;
+                        }
+                        reply.fileDescriptors.push_back(
+                            buffer.getFileDescriptor());
+                    }
+                    return STATUS::SUCCESS;
+                };
+
+                if (share(model.getInputs(),
+                          description.inputs,
+                          buffers->inputs)
+                        == STATUS::SUCCESS
+                    && share(model.getOutputs(),
+                             description.outputs,
+                             buffers->outputs)
+                        == STATUS::SUCCESS)
+                {
+                    reply.payload = encodeModelDescription(description);
+                    status = STATUS::SUCCESS;
+                } else {
+                    reply.fileDescriptors.clear();
+                    sharedModel = nullptr;
+                    buffers = std::make_shared<SessionBuffers>();
+                }
+                break;
+            }
+            case MESSAGE::EXECUTE:
+                if (sharedModel != nullptr) {
+                    status = execute(*sharedModel, buffers);
+                }
+                break;
+            case MESSAGE::APPLY_DELEGATE:
+                /* the model is shared, clients cannot change its delegate */
+                if (sharedModel != nullptr) {
+                    const std::lock_guard<std::mutex> lock(sharedModel->mutex);
+                    const auto delegate = sharedModel->model->getDelegate();
+                    status = static_cast<DELEGATE>(request.header.argument)
+                            == delegate
+                        ? STATUS::SUCCESS
+                        : STATUS::FAIL;
+                    reply.header.argument = static_cast<uint32_t>(delegate);
+                }
+                break;
+        }
+
+        reply.header.status = static_cast<uint32_t>(status);
+        if (sendMessage(connection.socket, reply) != STATUS::SUCCESS) {
+            break;
+        }
+    }
+
+    connection.finished = true;
+}
+
+auto Server::resolveModelPath(const std::string& modelPath) const
+    -> std::filesystem::path {
+    if (m_modelDirectory.empty()) {
+        return {};
+    }
+
+    /* resolves symbolic links and .., which could leave the directory */
+    std::error_code errorCode;
+    const auto directory = std::filesystem::canonical(m_modelDirectory,
+                                                      errorCode);
+    if (errorCode) {
+        return {};
+    }
+
+    auto resolved = std::filesystem::canonical(directory / modelPath,
+                                               errorCode);
+    if (errorCode || !std::filesystem::is_regular_file(resolved, errorCode)) {
+        return {};
+    }
+
+    const auto contained = std::mismatch(directory.begin(),
+                                         directory.end(),
+                                         resolved.begin(),
+                                         resolved.end())
+                               .first
+        == directory.end();
+
+    return contained ? resolved : std::filesystem::path {};
+}
+
+auto Server::getModel(const std::string& modelPath)
+    -> std::shared_ptr<SharedModel> {
+    /* loading runs code of the backends, only load models from the model
+     * directory */
+    const auto resolvedPath = resolveModelPath(modelPath);
+
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+
+        const auto found = m_models.find(modelPath);
+        if (found != m_models.end()) {
+            return found->second;
+        }
+
+        const auto loaded = m_models.find(resolvedPath.string());
+        if (resolvedPath.empty() || loaded != m_models.end()) {
+            return resolvedPath.empty() ? nullptr : loaded->second;
+        }
+    }
+
+    /* loaded without holding the lock, such that loading a model does not
+     * block clients of other models */
+    std::shared_ptr<Model> model = createModel(resolvedPath, m_options);
+    if (model == nullptr) {
+        return nullptr;
+    }
+
+    auto sharedModel = std::make_shared<SharedModel>();
+    sharedModel->model = std::move(model);
+
+    /* a concurrent request may have loaded the model meanwhile, the first
+     * loaded model is served */
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_models.emplace(resolvedPath.string(), std::move(sharedModel))
+        .first->second;
+}
+
+auto Server::execute(SharedModel& sharedModel,
+                     const std::shared_ptr<SessionBuffers>& buffers)
+    -> STATUS {
+    const std::lock_guard<std::mutex> lock(sharedModel.mutex);
+    auto& model = *sharedModel.model;
+
+    const TraceScope trace {"serve", model.name().c_str()};
+
+    /* bind the shared memory of this client, tensors that cannot be bound
+     * are copied instead */
+    if (sharedModel.boundBuffers != buffers) {
+        for (size_t i = 0; i < buffers->inputs.size(); ++i) {
+            auto& buffer = buffers->inputs[i];
+            model.bindInput(i, buffer.data(), buffer.size());
+        }
+        for (size_t i = 0; i < buffers->outputs.size(); ++i) {
+            auto& buffer = buffers->outputs[i];
+            model.bindOutput(i, buffer.data(), buffer.size());
+        }
+        sharedModel.boundBuffers = buffers;
+    }
+
+    const auto numInputs = std::min(model.getNumInputs(), buffers->inputs.size());
+    for (size_t i = 0; i < numInputs; ++i) {
+        auto& buffer = buffers->inputs[i];
+        copyUnlessBound(model.getInput(i)->getTensorAs<uint8_t>(),
+                        {buffer.data(), buffer.size()});
+    }
+
+    const auto status = model.execute();
+
+    const auto numOutputs =
+        std::min(model.getNumOutputs(), buffers->outputs.size());
+    for (size_t i = 0; i < numOutputs; ++i) {
+        auto& buffer = buffers->outputs[i];
+        copyUnlessBound({buffer.data(), buffer.size()},
+                        model.getOutput(i)->getTensorAs<uint8_t>());
+    }
+
+    return status;
+}
+
+}  // namespace edge::remote
@@ -0,0 +1,93 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "edgerunner/remote/sharedBuffer.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace edge::remote {
+
+namespace {
+
+/* peers must not resize the file, accesses past its end raise SIGBUS */
+constexpr int SizeSeals = F_SEAL_SHRINK | F_SEAL_GROW;
+
+auto mapFile(const int fileDescriptor, const size_t size) -> uint8_t* {
+    /* mmap rejects empty mappings, map a single page for empty tensors */
+    auto* data = mmap(nullptr,
+                      size == 0 ? 1 : size,
+                      PROT_READ | PROT_WRITE,
+                      MAP_SHARED,
+                      fileDescriptor,
+                      0);
+
+    return data == MAP_FAILED ? nullptr : static_cast<uint8_t*>(data);
+}
+
+}  // namespace
+
+auto SharedBuffer::create(const std::string& name, const size_t size)
+    -> SharedBuffer {
+    SharedBuffer buffer;
+
+    buffer.m_fileDescriptor =
+        memfd_create(name.c_str(), MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (buffer.m_fileDescriptor < 0
+        || ftruncate(buffer.m_fileDescriptor, static_cast<off_t>(size)) != 0
+        || fcntl(buffer.m_fileDescriptor,
+                 F_ADD_SEALS,
+                 SizeSeals | F_SEAL_SEAL)
+            != 0)
+    {
+        return buffer;
+    }
+
+    buffer.m_data = mapFile(buffer.m_fileDescriptor, size);
+    if (buffer.m_data != nullptr) {
+        buffer.m_size = size;
+    }
+
+    return buffer;
+}
+
+auto SharedBuffer::fromFileDescriptor(const int fileDescriptor) -> SharedBuffer {
+    SharedBuffer buffer;
+    buffer.m_fileDescriptor = fileDescriptor;
+
+    struct stat fileStatus {};
+    if (fileDescriptor < 0 || fstat(fileDescriptor, &fileStatus) != 0) {
+        return buffer;
+    }
+
+    const auto seals = fcntl(fileDescriptor, F_GET_SEALS);
+    if (seals < 0 || (seals & SizeSeals) != SizeSeals) {
+        return buffer;
+    }
+
+    const auto size = static_cast<size_t>(fileStatus.st_size);
+    buffer.m_data = mapFile(fileDescriptor, size);
+    if (buffer.m_data != nullptr) {
+        buffer.m_size = size;
+    }
+
+    return buffer;
+}
+
+void SharedBuffer::release() {
+    if (m_data != nullptr) {
+        munmap(m_data, m_size == 0 ? 1 : m_size);
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    if (m_fileDescriptor >= 0) {
+        close(m_fileDescriptor);
+        m_fileDescriptor = -1;
+    }
+}
+
+}  // namespace edge::remote
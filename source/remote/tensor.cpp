@@ -0,0 +1,16 @@
+#include <cstddef>
+#include <functional>
+#include <numeric>
+
+#include "edgerunner/remote/tensor.hpp"
+
+namespace edge::remote {
+
+auto TensorImpl::getSize() const -> size_t {
+    return std::accumulate(m_description.dimensions.cbegin(),
+                           m_description.dimensions.cend(),
+                           size_t {1},
+                           std::multiplies<>());
+}
+
+}  // namespace edge::remote
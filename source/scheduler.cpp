@@ -0,0 +1,194 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <mutex>
+#include <utility>
+
+#include "edgerunner/scheduler.hpp"
+
+#include "edgerunner/model.hpp"
+#include "edgerunner/trace.hpp"
+
+namespace edge {
+
+namespace {
+
+auto makeReadyFuture(STATUS status) -> std::future<STATUS> {
+    std::promise<STATUS> promise;
+    promise.set_value(status);
+    return promise.get_future();
+}
+
+}  // namespace
+
+Scheduler::Scheduler(const SchedulerOptions& options)
+    : m_numWorkers {options.cpuWorkers, options.gpuWorkers, options.npuWorkers} {
+    for (size_t queueIndex = 0; queueIndex < NumDelegates; ++queueIndex) {
+        for (size_t i = 0; i < m_numWorkers[queueIndex]; ++i) {
+            m_workers.emplace_back(&Scheduler::runWorker, this, queueIndex);
+        }
+    }
+}
+
+Scheduler::~Scheduler() {
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_condition.notify_all();
+
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+}
+
+auto Scheduler::submit(SchedulerRequest request) -> std::future<STATUS> {
+    if (request.model == nullptr) {
+        return makeReadyFuture(STATUS::FAIL);
+    }
+
+    const auto queueIndex = static_cast<size_t>(request.model->getDelegate());
+    if (queueIndex >= NumDelegates || m_numWorkers[queueIndex] == 0) {
+        return makeReadyFuture(STATUS::FAIL);
+    }
+
+    Pending pending {std::move(request), Clock::now(), {}};
+    auto future = pending.promise.get_future();
+
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_stopping) {
+            return makeReadyFuture(STATUS::FAIL);
+        }
+
+        const Key key {pending.request.deadline,
+                       pending.request.priority,
+                       m_nextSequence++};
+        m_queues[queueIndex].emplace(key, std::move(pending));
+    }
+    m_condition.notify_all();
+
+    return future;
+}
+
+auto Scheduler::submit(Model& model,
+                       PRIORITY priority,
+                       Clock::time_point deadline) -> std::future<STATUS> {
+    SchedulerRequest request;
+    request.model = &model;
+    request.priority = priority;
+    request.deadline = deadline;
+
+    return submit(std::move(request));
+}
+
+auto Scheduler::getNumQueued() -> size_t {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    size_t numQueued = 0;
+    for (const auto& queue : m_queues) {
+        numQueued += queue.size();
+    }
+
+    return numQueued;
+}
+
+auto Scheduler::getStats(PRIORITY priority) const -> SchedulerStats {
+    const auto& stats = m_stats.at(static_cast<size_t>(priority));
+
+    return {stats.queueDelay.snapshot(),
+            stats.executed.load(std::memory_order_relaxed),
+            stats.dropped.load(std::memory_order_relaxed)};
+}
+
+void Scheduler::resetStats() noexcept {
+    for (auto& stats : m_stats) {
+        stats.queueDelay.reset();
+        stats.executed.store(0, std::memory_order_relaxed);
+        stats.dropped.store(0, std::memory_order_relaxed);
+    }
+}
+
+void Scheduler::dropExpired(std::multimap<Key, Pending>& queue) {
+    const auto now = Clock::now();
+
+    /* the queue is ordered by deadline, expired requests are at its front */
+    while (!queue.empty() && std::get<0>(queue.begin()->first) < now) {
+        auto& pending = queue.begin()->second;
+        m_stats.at(static_cast<size_t>(pending.request.priority))
+            .dropped.fetch_add(1, std::memory_order_relaxed);
+        pending.promise.set_value(STATUS::FAIL);
+        queue.erase(queue.begin());
+    }
+}
+
+void Scheduler::runWorker(size_t queueIndex) {
+    auto& queue = m_queues.at(queueIndex);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        dropExpired(queue);
+
+        /* earliest deadline request whose model is not executing */
+        auto next = queue.begin();
+        while (next != queue.end()
+               && m_busyModels.count(next->second.request.model) != 0)
+        {
+            ++next;
+        }
+
+        if (next == queue.end()) {
+            if (m_stopping && queue.empty()) {
+                return;
+            }
+
+            /* wake up at the earliest deadline to drop it promptly */
+            if (queue.empty()
+                || std::get<0>(queue.begin()->first)
+                    == Clock::time_point::max())
+            {
+                m_condition.wait(lock);
+            } else {
+                m_condition.wait_until(lock, std::get<0>(queue.begin()->first));
+            }
+            continue;
+        }
+
+        auto pending = std::move(next->second);
+        queue.erase(next);
+
+        auto& model = *pending.request.model;
+        m_busyModels.insert(&model);
+        lock.unlock();
+
+        auto& stats = m_stats.at(static_cast<size_t>(pending.request.priority));
+        const auto queueDelay =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                Clock::now() - pending.submitted);
+        stats.queueDelay.record(static_cast<uint64_t>(queueDelay.count()));
+        stats.executed.fetch_add(1, std::memory_order_relaxed);
+
+        STATUS status = STATUS::FAIL;
+        {
+            const TraceScope trace {"schedule", model.name().c_str()};
+
+            if (pending.request.prepare) {
+                pending.request.prepare(model);
+            }
+
+            status = model.execute();
+
+            if (pending.request.complete) {
+                pending.request.complete(model, status);
+            }
+        }
+        pending.promise.set_value(status);
+
+        lock.lock();
+        m_busyModels.erase(&model);
+        m_condition.notify_all();
+    }
+}
+
+}  // namespace edge
@@ -1,19 +1,44 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <filesystem>
+#include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "edgerunner/model.hpp"
 
 #include <nonstd/span.hpp>
+#include <tensorflow/lite/allocation.h>
+#include <tensorflow/lite/core/api/profiler.h>
 #include <tensorflow/lite/core/c/c_api_types.h>
+#include <tensorflow/lite/core/subgraph.h>
+#include <tensorflow/lite/delegates/xnnpack/xnnpack_delegate.h>
 #include <tensorflow/lite/interpreter_builder.h>
 #include <tensorflow/lite/kernels/register.h>
 #include <tensorflow/lite/model_builder.h>
+#include <tensorflow/lite/profiling/buffered_profiler.h>
 
+#include "edgerunner/alignedBuffer.hpp"
+#include "edgerunner/arenaGroup.hpp"
+#include "edgerunner/bundle.hpp"
+#include "edgerunner/compression.hpp"
+#include "edgerunner/hash.hpp"
+#include "edgerunner/memoryStats.hpp"
+#include "edgerunner/metrics.hpp"
+#include "edgerunner/options.hpp"
+#include "edgerunner/profiling.hpp"
 #include "edgerunner/tensor.hpp"
 #include "edgerunner/tflite/model.hpp"
 #include "edgerunner/tflite/tensor.hpp"
+#include "edgerunner/trace.hpp"
 
 #ifdef EDGERUNNER_GPU
 #    include <tensorflow/lite/delegates/gpu/delegate.h>
@@ -25,22 +50,107 @@
 
 namespace edge::tflite {
 
-ModelImpl::ModelImpl(const std::filesystem::path& modelPath)
-    : Model(modelPath) {
-    setCreationStatus(loadModel(modelPath));
-    setCreationStatus(createInterpreter());
-    setCreationStatus(allocate());
-    setPrecision(detectPrecision());
+namespace {
+
+auto isExecutionPrecision(const TensorType precision,
+                          const TensorType detectedPrecision) -> bool {
+    if (precision == TensorType::FLOAT32 || precision == TensorType::FLOAT16) {
+        return true;
+    }
+
+    /* integer precisions execute quantized models as they are, float models
+     * are not quantized on the fly */
+    return (precision == TensorType::INT8 || precision == TensorType::UINT8)
+        && detectedPrecision != TensorType::FLOAT16;
+}
+
+/* deletes the delegates of an interpreter, which must be destroyed first */
+void deleteDelegates(const DELEGATE delegate,
+                     TfLiteDelegate*& tfliteDelegate,
+                     TfLiteDelegate*& xnnpackDelegate) {
+    if (tfliteDelegate != nullptr) {
+#ifdef EDGERUNNER_GPU
+        if (delegate == DELEGATE::GPU) {
+            TfLiteGpuDelegateV2Delete(tfliteDelegate);
+        }
+#endif
+
+        if (delegate == DELEGATE::NPU) {
+#ifdef EDGERUNNER_QNN
+            TfLiteQnnDelegateDelete(tfliteDelegate);
+#endif
+        }
+
+        tfliteDelegate = nullptr;
+    }
+
+    if (xnnpackDelegate != nullptr) {
+        TfLiteXNNPackDelegateDelete(xnnpackDelegate);
+        xnnpackDelegate = nullptr;
+    }
+}
+
+}  // namespace
+
+ModelImpl::ModelImpl(const std::filesystem::path& modelPath,
+                     const ModelOptions& options)
+    : Model(modelPath)
+    , m_arenaGroup(options.arenaGroup)
+    , m_selectedPrecision(options.precision) {
+    initialize(options, [this, &modelPath]() { return loadModel(modelPath); });
 }
 
-ModelImpl::ModelImpl(const nonstd::span<uint8_t>& modelBuffer) {
-    setCreationStatus(loadModel(modelBuffer));
-    setCreationStatus(createInterpreter());
+ModelImpl::ModelImpl(const nonstd::span<uint8_t>& modelBuffer,
+                     const ModelOptions& options)
+    : m_arenaGroup(options.arenaGroup)
+    , m_selectedPrecision(options.precision) {
+    initialize(options,
+               [this, &modelBuffer]() { return loadModel(modelBuffer); });
+}
+
+ModelImpl::ModelImpl(const std::shared_ptr<Bundle>& bundle,
+                     const ModelOptions& options)
+    : Model(bundle)
+    , m_arenaGroup(options.arenaGroup)
+    , m_selectedPrecision(options.precision) {
+    const auto modelBuffer = bundle->getSection(SECTION::TFLITE);
+    initialize(options,
+               [this, &modelBuffer]() { return loadModel(modelBuffer); });
+}
+
+void ModelImpl::initialize(const ModelOptions& options,
+                           const std::function<STATUS()>& load) {
+    setCreationStatus(enableProfiling(options.profilingLevel));
+    {
+        const ScopedLatency loadLatency {getMetrics().getLoadLatency()};
+        setCreationStatus(load());
+        setCreationStatus(createInterpreter());
+    }
     setCreationStatus(allocate());
-    setPrecision(detectPrecision());
+    setPrecision(m_selectedPrecision.value_or(detectPrecision()));
+
+    if (m_selectedPrecision.has_value()) {
+        setCreationStatus(
+            isExecutionPrecision(*m_selectedPrecision, detectPrecision())
+                ? applyDelegate(DELEGATE::CPU)
+                : STATUS::FAIL);
+    }
 }
 
 auto ModelImpl::loadModel(const std::filesystem::path& modelPath) -> STATUS {
+    const TraceScope trace {"loadModel", name().c_str()};
+
+    /* the flatbuffer is built in place from the decompressed buffer */
+    if (getCompression(modelPath) != COMPRESSION::NONE) {
+        const auto modelBuffer =
+            decompressModel(modelPath, m_decompressedModel);
+        if (modelBuffer.empty()) {
+            return STATUS::FAIL;
+        }
+
+        return loadModel(modelBuffer);
+    }
+
     m_modelBuffer = ::tflite::FlatBufferModel::BuildFromFile(modelPath.c_str());
 
     if (m_modelBuffer == nullptr) {
@@ -51,6 +161,12 @@ auto ModelImpl::loadModel(const std::filesystem::path& modelPath) -> STATUS {
 }
 
 auto ModelImpl::loadModel(const nonstd::span<uint8_t>& modelBuffer) -> STATUS {
+    const TraceScope trace {"loadModel", name().c_str()};
+
+    if (modelBuffer.empty()) {
+        return STATUS::FAIL;
+    }
+
     m_modelBuffer = ::tflite::FlatBufferModel::BuildFromBuffer(
         reinterpret_cast<char*> /* NOLINT */ (modelBuffer.data()),
         modelBuffer.size());
@@ -62,23 +178,67 @@ auto ModelImpl::loadModel(const nonstd::span<uint8_t>& modelBuffer) -> STATUS {
     return STATUS::SUCCESS;
 }
 
+auto ModelImpl::hashModel() const -> uint64_t {
+    if (m_modelBuffer == nullptr) {
+        return 0;
+    }
+
+    const auto* allocation = m_modelBuffer->allocation();
+    if (allocation == nullptr || allocation->base() == nullptr) {
+        return 0;
+    }
+
+    return hashBytes({static_cast<const uint8_t*>(allocation->base()),
+                      allocation->bytes()});
+}
+
 auto ModelImpl::createInterpreter() -> STATUS {
+    const TraceScope trace {"createInterpreter", name().c_str()};
+
+    if (m_modelBuffer == nullptr) {
+        return STATUS::FAIL;
+    }
+
     const ::tflite::ops::builtin::BuiltinOpResolver opResolver;
-    if (m_modelBuffer == nullptr
-        || ::tflite::InterpreterBuilder(*m_modelBuffer,
-                                        opResolver)(&m_interpreter)
-            != kTfLiteOk)
+    ::tflite::InterpreterBuilder builder(*m_modelBuffer, opResolver);
+
+    if (m_numThreads > 0
+        && builder.SetNumThreads(static_cast<int>(m_numThreads)) != kTfLiteOk)
     {
         return STATUS::FAIL;
     }
 
+    /* the runner belongs to the previous interpreter, see allocate() */
+    m_signatureRunner = nullptr;
+
+    if (builder(&m_interpreter) != kTfLiteOk) {
+        return STATUS::FAIL;
+    }
+
+    /* resized inputs must be resized before delegates are applied */
+    for (const auto& [index, dimensions] : m_inputDimensions) {
+        if (m_interpreter->ResizeInputTensor(
+                m_interpreter->inputs().at(index), dimensions)
+            != kTfLiteOk)
+        {
+            return STATUS::FAIL;
+        }
+    }
+
+    if (m_profiler != nullptr) {
+        m_interpreter->SetProfiler(m_profiler.get());
+    }
+
+    m_interpreter->SetCancellationFunction(this, &ModelImpl::checkCancelled);
+
     return STATUS::SUCCESS;
 }
 
 auto ModelImpl::allocate() -> STATUS {
-    if (m_interpreter == nullptr
-        || m_interpreter->AllocateTensors() != kTfLiteOk)
-    {
+    const ScopedLatency allocateLatency {getMetrics().getAllocateLatency()};
+    const TraceScope trace {"allocate", name().c_str()};
+
+    if (m_interpreter == nullptr || allocateTensors() != STATUS::SUCCESS) {
         return STATUS::FAIL;
     }
 
@@ -104,6 +264,318 @@ auto ModelImpl::allocate() -> STATUS {
             std::make_shared<TensorImpl>(m_interpreter->output_tensor(i)));
     }
 
+    if (!m_signatureKey.empty()) {
+        return setSignatureTensors();
+    }
+
+    return STATUS::SUCCESS;
+}
+
+auto ModelImpl::setSignatureTensors() -> STATUS {
+    m_signatureRunner =
+        m_interpreter->GetSignatureRunner(m_signatureKey.c_str());
+    if (m_signatureRunner == nullptr
+        || m_signatureRunner->AllocateTensors() != kTfLiteOk)
+    {
+        m_signatureRunner = nullptr;
+        return STATUS::FAIL;
+    }
+
+    auto& inputs = getInputs();
+    inputs.clear();
+    for (const auto* inputName : m_signatureRunner->input_names()) {
+        inputs.emplace_back(std::make_shared<TensorImpl>(
+            m_signatureRunner->input_tensor(inputName), inputName));
+    }
+
+    auto& outputs = getOutputs();
+    outputs.clear();
+    for (const auto* outputName : m_signatureRunner->output_names()) {
+        /* the runner only exposes const outputs, which are not modified */
+        auto* output = const_cast<TfLiteTensor*>(  // NOLINT
+            m_signatureRunner->output_tensor(outputName));
+        outputs.emplace_back(std::make_shared<TensorImpl>(output, outputName));
+    }
+
+    return STATUS::SUCCESS;
+}
+
+auto ModelImpl::getGraphNames() const -> std::vector<std::string> {
+    std::vector<std::string> graphNames;
+    if (m_interpreter == nullptr) {
+        return graphNames;
+    }
+
+    for (const auto* signatureKey : m_interpreter->signature_keys()) {
+        graphNames.push_back(*signatureKey);
+    }
+
+    return graphNames;
+}
+
+auto ModelImpl::selectGraph(const std::string& graphName) -> STATUS {
+    const TraceScope trace {"selectGraph", name().c_str()};
+
+    if (m_interpreter == nullptr || m_arenaGroup != nullptr
+        || !m_preparedInterpreters.empty())
+    {
+        return STATUS::FAIL;
+    }
+
+    if (graphName == m_signatureKey && m_signatureRunner != nullptr) {
+        return STATUS::SUCCESS;
+    }
+
+    const auto graphNames = getGraphNames();
+    if (std::find(graphNames.cbegin(), graphNames.cend(), graphName)
+        == graphNames.cend())
+    {
+        return STATUS::FAIL;
+    }
+
+    const auto previousSignatureKey = m_signatureKey;
+    m_signatureKey = graphName;
+
+    if (setSignatureTensors() != STATUS::SUCCESS) {
+        m_signatureKey = previousSignatureKey;
+        allocate();
+        return STATUS::FAIL;
+    }
+
+    return STATUS::SUCCESS;
+}
+
+auto ModelImpl::allocateTensors() -> STATUS {
+    if (setBoundAllocations() != STATUS::SUCCESS) {
+        return STATUS::FAIL;
+    }
+
+    if (m_arenaGroup == nullptr) {
+        return m_interpreter->AllocateTensors() == kTfLiteOk ? STATUS::SUCCESS
+                                                             : STATUS::FAIL;
+    }
+
+    /* the interpreter was recreated, its scratch memory is not held */
+    m_arenaGroup->deactivate(*this);
+
+    if (setIoAllocations() != STATUS::SUCCESS) {
+        return STATUS::FAIL;
+    }
+
+    std::unique_lock<std::mutex> groupLock;
+    return m_arenaGroup->acquire(*this, groupLock);
+}
+
+auto ModelImpl::setIoAllocations() -> STATUS {
+    m_ioBuffers.clear();
+
+    std::vector<int> tensorIndices = m_interpreter->inputs();
+    tensorIndices.insert(tensorIndices.end(),
+                         m_interpreter->outputs().cbegin(),
+                         m_interpreter->outputs().cend());
+
+    m_ioBuffers.reserve(tensorIndices.size());
+
+    for (const auto tensorIndex : tensorIndices) {
+        const auto* tensor = m_interpreter->tensor(tensorIndex);
+        if (tensor == nullptr || tensor->allocation_type != kTfLiteArenaRw
+            || tensor->bytes == 0 || m_boundAllocations.count(tensorIndex) != 0)
+        {
+            continue;
+        }
+
+        const auto& buffer = m_ioBuffers.emplace_back(tensor->bytes);
+        if (buffer.data() == nullptr) {
+            return STATUS::FAIL;
+        }
+
+        const TfLiteCustomAllocation allocation {buffer.data(), buffer.size()};
+        if (m_interpreter->SetCustomAllocationForTensor(tensorIndex, allocation)
+            != kTfLiteOk)
+        {
+            return STATUS::FAIL;
+        }
+    }
+
+    return STATUS::SUCCESS;
+}
+
+auto ModelImpl::setBoundAllocations() -> STATUS {
+    for (const auto& [tensorIndex, allocation] : m_boundAllocations) {
+        if (m_interpreter->SetCustomAllocationForTensor(tensorIndex, allocation)
+            != kTfLiteOk)
+        {
+            return STATUS::FAIL;
+        }
+    }
+
+    return STATUS::SUCCESS;
+}
+
+auto ModelImpl::bindInput(const size_t index, void* data, const size_t numBytes)
+    -> STATUS {
+    if (m_interpreter == nullptr || index >= m_interpreter->inputs().size()) {
+        return STATUS::FAIL;
+    }
+
+    return bindTensor(m_interpreter->inputs()[index], data, numBytes);
+}
+
+auto ModelImpl::bindOutput(const size_t index, void* data, const size_t numBytes)
+    -> STATUS {
+    if (m_interpreter == nullptr || index >= m_interpreter->outputs().size()) {
+        return STATUS::FAIL;
+    }
+
+    return bindTensor(m_interpreter->outputs()[index], data, numBytes);
+}
+
+auto ModelImpl::bindTensor(const int tensorIndex,
+                           void* data,
+                           const size_t numBytes) -> STATUS {
+    const TraceScope trace {"bindTensor", name().c_str()};
+
+    const auto* tensor = m_interpreter->tensor(tensorIndex);
+    if (!m_signatureKey.empty() || data == nullptr || tensor == nullptr
+        || numBytes < tensor->bytes
+        || reinterpret_cast<uintptr_t>(data) /* NOLINT */
+                % AlignedBuffer::DefaultAlignment
+            != 0)
+    {
+        return STATUS::FAIL;
+    }
+
+    /* state tensors are backed by the model */
+    for (const auto& [inputTensor, outputTensor] : m_stateTensors) {
+        if (tensorIndex == inputTensor || tensorIndex == outputTensor) {
+            return STATUS::FAIL;
+        }
+    }
+
+    /* rebinding only repoints the data of the allocated tensor */
+    const auto bound = m_boundAllocations.find(tensorIndex);
+    if (bound != m_boundAllocations.end()) {
+        const TfLiteCustomAllocation allocation {data, numBytes};
+        if (setCustomAllocation(tensorIndex, allocation) != STATUS::SUCCESS) {
+            return STATUS::FAIL;
+        }
+        bound->second = allocation;
+        return STATUS::SUCCESS;
+    }
+
+    const auto previousAllocations = m_boundAllocations;
+    m_boundAllocations[tensorIndex] = {data, numBytes};
+
+    if (allocate() != STATUS::SUCCESS) {
+        /* custom allocations cannot be undone, rebuild the interpreter */
+        m_boundAllocations = previousAllocations;
+        applyDelegate(getDelegate());
+        return STATUS::FAIL;
+    }
+
+    return STATUS::SUCCESS;
+}
+
+auto ModelImpl::addState(const size_t inputIndex, const size_t outputIndex)
+    -> STATUS {
+    const TraceScope trace {"addState", name().c_str()};
+
+    if (m_interpreter == nullptr || !m_signatureKey.empty()
+        || !m_preparedInterpreters.empty()
+        || inputIndex >= m_interpreter->inputs().size()
+        || outputIndex >= m_interpreter->outputs().size())
+    {
+        return STATUS::FAIL;
+    }
+
+    const auto inputTensor = m_interpreter->inputs()[inputIndex];
+    const auto outputTensor = m_interpreter->outputs()[outputIndex];
+
+    const auto* input = m_interpreter->tensor(inputTensor);
+    const auto* output = m_interpreter->tensor(outputTensor);
+    if (input == nullptr || output == nullptr || input->bytes == 0
+        || input->bytes != output->bytes || input->type != output->type
+        || m_boundAllocations.count(inputTensor) != 0
+        || m_boundAllocations.count(outputTensor) != 0)
+    {
+        return STATUS::FAIL;
+    }
+
+    AlignedBuffer inputBuffer {input->bytes};
+    AlignedBuffer outputBuffer {output->bytes};
+    if (inputBuffer.data() == nullptr || outputBuffer.data() == nullptr) {
+        return STATUS::FAIL;
+    }
+
+    const auto previousAllocations = m_boundAllocations;
+    m_boundAllocations[inputTensor] = {inputBuffer.data(), inputBuffer.size()};
+    m_boundAllocations[outputTensor] = {outputBuffer.data(),
+                                        outputBuffer.size()};
+
+    if (allocate() != STATUS::SUCCESS) {
+        /* custom allocations cannot be undone, rebuild the interpreter */
+        m_boundAllocations = previousAllocations;
+        applyDelegate(getDelegate());
+        return STATUS::FAIL;
+    }
+
+    m_stateTensors.emplace_back(inputTensor, outputTensor);
+    m_stateBuffers.push_back(std::move(inputBuffer));
+    m_stateBuffers.push_back(std::move(outputBuffer));
+
+    return STATUS::SUCCESS;
+}
+
+auto ModelImpl::resetState() -> STATUS {
+    for (auto& buffer : m_stateBuffers) {
+        std::fill_n(buffer.data(), buffer.size(), uint8_t {0});
+    }
+
+    if (m_interpreter == nullptr
+        || m_interpreter->ResetVariableTensors() != kTfLiteOk)
+    {
+        return STATUS::FAIL;
+    }
+
+    return STATUS::SUCCESS;
+}
+
+auto ModelImpl::swapState() -> STATUS {
+    for (const auto& [inputTensor, outputTensor] : m_stateTensors) {
+        auto& inputAllocation = m_boundAllocations[inputTensor];
+        auto& outputAllocation = m_boundAllocations[outputTensor];
+        std::swap(inputAllocation, outputAllocation);
+
+        /* only repoints the tensor data, the tensors stay allocated */
+        if (setCustomAllocation(inputTensor, inputAllocation)
+                != STATUS::SUCCESS
+            || setCustomAllocation(outputTensor, outputAllocation)
+                != STATUS::SUCCESS)
+        {
+            return STATUS::FAIL;
+        }
+    }
+
+    return STATUS::SUCCESS;
+}
+
+auto ModelImpl::acquireScratch() -> STATUS {
+    if (m_interpreter == nullptr
+        || m_interpreter->AllocateTensors() != kTfLiteOk)
+    {
+        return STATUS::FAIL;
+    }
+
+    return STATUS::SUCCESS;
+}
+
+auto ModelImpl::releaseScratch() -> STATUS {
+    if (m_interpreter == nullptr
+        || m_interpreter->ReleaseNonPersistentMemory() != kTfLiteOk)
+    {
+        return STATUS::FAIL;
+    }
+
     return STATUS::SUCCESS;
 }
 
@@ -123,6 +595,23 @@ auto ModelImpl::detectPrecision() -> TensorType {
 }
 
 auto ModelImpl::applyDelegate(const DELEGATE& delegate) -> STATUS {
+    const TraceScope trace {"applyDelegate", name().c_str()};
+
+    /* switching to a prepared interpreter keeps the tensors */
+    const auto prepared =
+        std::find_if(m_preparedInterpreters.begin(),
+                     m_preparedInterpreters.end(),
+                     [&delegate](const PreparedInterpreter& interpreter) {
+                         return interpreter.delegate == delegate;
+                     });
+    if (delegate != getDelegate() && prepared != m_preparedInterpreters.end()) {
+        swapInterpreter(*prepared);
+        return STATUS::SUCCESS;
+    }
+
+    /* prepared interpreters would diverge from the rebuilt interpreter */
+    releasePreparedInterpreters();
+
     /* undo any previous delegate */
     if (createInterpreter() != STATUS::SUCCESS) {
         return STATUS::FAIL;
@@ -133,10 +622,22 @@ auto ModelImpl::applyDelegate(const DELEGATE& delegate) -> STATUS {
 
     STATUS status = STATUS::SUCCESS;
     if (delegate == DELEGATE::CPU) {
+        status = applyXnnpackDelegate();
         setDelegate(delegate);
     } else if (delegate == DELEGATE::GPU) {
 #ifdef EDGERUNNER_GPU
-        m_delegate = TfLiteGpuDelegateV2Create(nullptr);
+        auto options = TfLiteGpuDelegateOptionsV2Default();
+
+        /* quantized models execute dequantized on GPU */
+        if (m_selectedPrecision.has_value()
+            && *m_selectedPrecision != TensorType::FLOAT32)
+        {
+            options.is_precision_loss_allowed = 1;
+            options.inference_priority1 =
+                TFLITE_GPU_INFERENCE_PRIORITY_MIN_LATENCY;
+        }
+
+        m_delegate = TfLiteGpuDelegateV2Create(&options);
 
         if (m_interpreter->ModifyGraphWithDelegate(m_delegate) != kTfLiteOk) {
             status = STATUS::FAIL;
@@ -158,9 +659,14 @@ auto ModelImpl::applyDelegate(const DELEGATE& delegate) -> STATUS {
         }
         options.htp_options.performance_mode = kHtpBurst;
 
-        m_delegate = TfLiteQnnDelegateCreate(&options);
+        /* HTP has no fp32 execution */
+        if (getPrecision() != TensorType::FLOAT32) {
+            m_delegate = TfLiteQnnDelegateCreate(&options);
+        }
 
-        if (m_interpreter->ModifyGraphWithDelegate(m_delegate) != kTfLiteOk) {
+        if (m_delegate == nullptr
+            || m_interpreter->ModifyGraphWithDelegate(m_delegate) != kTfLiteOk)
+        {
             status = STATUS::FAIL;
             setDelegate(DELEGATE::CPU);
         } else {
@@ -176,31 +682,447 @@ auto ModelImpl::applyDelegate(const DELEGATE& delegate) -> STATUS {
     return status;
 }
 
-auto ModelImpl::execute() -> STATUS {
-    if (m_interpreter->Invoke() != kTfLiteOk) {
+auto ModelImpl::prepareDelegates(const std::vector<DELEGATE>& delegates)
+    -> STATUS {
+    const TraceScope trace {"prepareDelegates", name().c_str()};
+
+    if (m_interpreter == nullptr || m_arenaGroup != nullptr
+        || !m_signatureKey.empty())
+    {
         return STATUS::FAIL;
     }
 
+    releasePreparedInterpreters();
+
+    /* tensors of all interpreters share stable buffers, such that tensors
+     * remain valid across switches */
+    std::vector<int> tensorIndices = m_interpreter->inputs();
+    tensorIndices.insert(tensorIndices.end(),
+                         m_interpreter->outputs().cbegin(),
+                         m_interpreter->outputs().cend());
+
+    for (const auto tensorIndex : tensorIndices) {
+        const auto* tensor = m_interpreter->tensor(tensorIndex);
+        if (tensor == nullptr || tensor->allocation_type != kTfLiteArenaRw
+            || tensor->bytes == 0 || m_boundAllocations.count(tensorIndex) != 0)
+        {
+            continue;
+        }
+
+        const auto& buffer = m_preparedBuffers.emplace_back(tensor->bytes);
+        if (buffer.data() == nullptr) {
+            return STATUS::FAIL;
+        }
+
+        /* keep the current contents, e.g. filled inputs */
+        std::copy_n(tensor->data.raw, tensor->bytes, buffer.data());
+        m_boundAllocations[tensorIndex] = {buffer.data(), buffer.size()};
+    }
+
+    const auto currentDelegate = getDelegate();
+    if (applyDelegate(currentDelegate) != STATUS::SUCCESS) {
+        return STATUS::FAIL;
+    }
+
+    std::vector<PreparedInterpreter> preparedInterpreters;
+    for (const auto delegate : delegates) {
+        const auto isPrepared = std::any_of(
+            preparedInterpreters.cbegin(),
+            preparedInterpreters.cend(),
+            [delegate](const PreparedInterpreter& interpreter) {
+                return interpreter.delegate == delegate;
+            });
+        if (delegate == currentDelegate || isPrepared) {
+            continue;
+        }
+
+        /* build the interpreter in place of the current interpreter */
+        PreparedInterpreter prepared {currentDelegate};
+        swapInterpreter(prepared);
+
+        const auto status = applyDelegate(delegate) == STATUS::SUCCESS
+                && getDelegate() == delegate
+            ? STATUS::SUCCESS
+            : STATUS::FAIL;
+
+        swapInterpreter(prepared);
+        preparedInterpreters.push_back(std::move(prepared));
+
+        if (status != STATUS::SUCCESS) {
+            m_preparedInterpreters = std::move(preparedInterpreters);
+            releasePreparedInterpreters();
+            return STATUS::FAIL;
+        }
+    }
+
+    m_preparedInterpreters = std::move(preparedInterpreters);
+
     return STATUS::SUCCESS;
 }
 
-void ModelImpl::deleteDelegate() {
-    if (m_delegate != nullptr) {
-#ifdef EDGERUNNER_GPU
-        if (getDelegate() == DELEGATE::GPU) {
-            TfLiteGpuDelegateV2Delete(m_delegate);
+void ModelImpl::swapInterpreter(PreparedInterpreter& prepared) {
+    const auto delegate = getDelegate();
+    setDelegate(prepared.delegate);
+    prepared.delegate = delegate;
+
+    std::swap(m_interpreter, prepared.interpreter);
+    std::swap(m_delegate, prepared.tfliteDelegate);
+    std::swap(m_xnnpackDelegate, prepared.xnnpackDelegate);
+    std::swap(getInputs(), prepared.inputs);
+    std::swap(getOutputs(), prepared.outputs);
+}
+
+void ModelImpl::releasePreparedInterpreters() {
+    for (auto& prepared : m_preparedInterpreters) {
+        prepared.interpreter.reset();
+        deleteDelegates(prepared.delegate,
+                        prepared.tfliteDelegate,
+                        prepared.xnnpackDelegate);
+    }
+
+    m_preparedInterpreters.clear();
+}
+
+auto ModelImpl::setCustomAllocation(const int tensorIndex,
+                                    const TfLiteCustomAllocation& allocation)
+    -> STATUS {
+    if (m_interpreter->SetCustomAllocationForTensor(tensorIndex, allocation)
+        != kTfLiteOk)
+    {
+        return STATUS::FAIL;
+    }
+
+    for (auto& prepared : m_preparedInterpreters) {
+        if (prepared.interpreter->SetCustomAllocationForTensor(tensorIndex,
+                                                               allocation)
+            != kTfLiteOk)
+        {
+            return STATUS::FAIL;
         }
-#endif
+    }
 
-        if (getDelegate() == DELEGATE::NPU) {
-#ifdef EDGERUNNER_QNN
-            TfLiteQnnDelegateDelete(m_delegate);
-#endif
+    return STATUS::SUCCESS;
+}
+
+auto ModelImpl::applyXnnpackDelegate() -> STATUS {
+    if (!m_selectedPrecision.has_value()
+        || *m_selectedPrecision == TensorType::FLOAT32)
+    {
+        return STATUS::SUCCESS;
+    }
+
+    auto options = TfLiteXNNPackDelegateOptionsDefault();
+    if (m_numThreads > 0) {
+        options.num_threads = static_cast<int32_t>(m_numThreads);
+    }
+
+    if (*m_selectedPrecision == TensorType::FLOAT16) {
+        options.flags |= TFLITE_XNNPACK_DELEGATE_FLAG_FORCE_FP16;
+        m_interpreter->SetAllowFp16PrecisionForFp32(true);
+    } else {
+        options.flags |= TFLITE_XNNPACK_DELEGATE_FLAG_QS8
+            | TFLITE_XNNPACK_DELEGATE_FLAG_QU8;
+    }
+
+    m_xnnpackDelegate = TfLiteXNNPackDelegateCreate(&options);
+
+    if (m_xnnpackDelegate == nullptr
+        || m_interpreter->ModifyGraphWithDelegate(m_xnnpackDelegate)
+            != kTfLiteOk)
+    {
+        return STATUS::FAIL;
+    }
+
+    return STATUS::SUCCESS;
+}
+
+auto ModelImpl::applyPrecision(const TensorType& precision) -> STATUS {
+    const TraceScope trace {"applyPrecision", name().c_str()};
+
+    const auto delegate = getDelegate();
+
+    if (!isExecutionPrecision(precision, detectPrecision())
+        || (delegate == DELEGATE::NPU && precision == TensorType::FLOAT32))
+    {
+        return STATUS::FAIL;
+    }
+
+    const auto previousSelectedPrecision = m_selectedPrecision;
+    const auto previousPrecision = getPrecision();
+
+    m_selectedPrecision = precision;
+    setPrecision(precision);
+
+    if (applyDelegate(delegate) != STATUS::SUCCESS) {
+        m_selectedPrecision = previousSelectedPrecision;
+        setPrecision(previousPrecision);
+        applyDelegate(delegate);
+        return STATUS::FAIL;
+    }
+
+    return STATUS::SUCCESS;
+}
+
+auto ModelImpl::setNumThreads(const size_t numThreads) -> STATUS {
+    const auto previousNumThreads = m_numThreads;
+    m_numThreads = numThreads;
+
+    if (applyDelegate(getDelegate()) != STATUS::SUCCESS) {
+        m_numThreads = previousNumThreads;
+        applyDelegate(getDelegate());
+        return STATUS::FAIL;
+    }
+
+    return STATUS::SUCCESS;
+}
+
+auto ModelImpl::resizeInput(const size_t index,
+                            const std::vector<size_t>& dimensions) -> STATUS {
+    const TraceScope trace {"resizeInput", name().c_str()};
+
+    if (m_interpreter == nullptr || !m_signatureKey.empty()
+        || !m_preparedInterpreters.empty()
+        || index >= m_interpreter->inputs().size())
+    {
+        return STATUS::FAIL;
+    }
+
+    const std::vector<int> inputDimensions {dimensions.cbegin(),
+                                            dimensions.cend()};
+
+    const auto previousDimensions = m_inputDimensions;
+    m_inputDimensions[index] = inputDimensions;
+
+    auto status = STATUS::FAIL;
+    if (m_arenaGroup == nullptr) {
+        if (m_interpreter->ResizeInputTensor(m_interpreter->inputs()[index],
+                                             inputDimensions)
+            == kTfLiteOk)
+        {
+            status = allocate();
         }
+    } else {
+        status = applyDelegate(getDelegate());
     }
+
+    if (status != STATUS::SUCCESS) {
+        /* restore the previous dimensions */
+        m_inputDimensions = previousDimensions;
+        applyDelegate(getDelegate());
+    }
+
+    return status;
+}
+
+auto ModelImpl::execute() -> STATUS {
+    /* cancel() applies to this execution from here on, a cancellation of a
+     * previous execution has no effect */
+    m_generation.fetch_add(1, std::memory_order_relaxed);
+
+    const auto start = ModelMetrics::now();
+    const TraceScope trace {"execute", name().c_str()};
+
+    STATUS status = STATUS::FAIL;
+
+    /* group members hold the group for the duration of the execution */
+    std::unique_lock<std::mutex> groupLock;
+    if (m_arenaGroup == nullptr
+        || m_arenaGroup->acquire(*this, groupLock) == STATUS::SUCCESS)
+    {
+        if (m_signatureRunner != nullptr) {
+            status = m_signatureRunner->Invoke() == kTfLiteOk ? STATUS::SUCCESS
+                                                              : STATUS::FAIL;
+        } else {
+            status = m_interpreter->Invoke() == kTfLiteOk ? STATUS::SUCCESS
+                                                          : STATUS::FAIL;
+        }
+    }
+
+    /* state belongs to the primary subgraph */
+    if (status == STATUS::SUCCESS && m_signatureRunner == nullptr) {
+        status = swapState();
+    }
+
+    getMetrics().recordExecution(start, status);
+
+    return status;
+}
+
+auto ModelImpl::execute(const std::chrono::microseconds timeout) -> STATUS {
+    m_deadline = std::chrono::steady_clock::now() + timeout;
+
+    const auto status = execute();
+
+    m_deadline = std::chrono::steady_clock::time_point::max();
+
+    return status;
+}
+
+auto ModelImpl::cancel() -> STATUS {
+    m_cancelledGeneration.store(m_generation.load(std::memory_order_relaxed),
+                                std::memory_order_relaxed);
+    return STATUS::SUCCESS;
+}
+
+auto ModelImpl::checkCancelled(void* data) -> bool {
+    const auto* model = static_cast<const ModelImpl*>(data);
+
+    if (model->m_cancelledGeneration.load(std::memory_order_relaxed)
+        == model->m_generation.load(std::memory_order_relaxed))
+    {
+        return true;
+    }
+
+    return model->m_deadline != std::chrono::steady_clock::time_point::max()
+        && std::chrono::steady_clock::now() >= model->m_deadline;
+}
+
+auto ModelImpl::enableProfiling(const PROFILING_LEVEL& level) -> STATUS {
+    if (level == PROFILING_LEVEL::OFF) {
+        if (m_interpreter != nullptr) {
+            m_interpreter->SetProfiler(nullptr);
+        }
+        for (auto& prepared : m_preparedInterpreters) {
+            prepared.interpreter->SetProfiler(nullptr);
+        }
+        m_profiler.reset();
+        setProfilingLevel(level);
+        return STATUS::SUCCESS;
+    }
+
+    if (m_profiler == nullptr) {
+        static constexpr uint32_t ProfilerBufferSize = 1024;
+        m_profiler = std::make_unique<::tflite::profiling::BufferedProfiler>(
+            ProfilerBufferSize, /*allow_dynamic_buffer_increase=*/true);
+    }
+
+    m_profiler->Reset();
+    m_profiler->StartProfiling();
+
+    if (m_interpreter != nullptr) {
+        m_interpreter->SetProfiler(m_profiler.get());
+    }
+    for (auto& prepared : m_preparedInterpreters) {
+        prepared.interpreter->SetProfiler(m_profiler.get());
+    }
+
+    setProfilingLevel(level);
+
+    return STATUS::SUCCESS;
+}
+
+auto ModelImpl::getProfilingEvents() -> std::vector<ProfilingEvent> {
+    if (m_profiler == nullptr) {
+        return {};
+    }
+
+    using EventType = ::tflite::Profiler::EventType;
+
+    const auto profileEvents = m_profiler->GetProfileEvents();
+
+    std::vector<ProfilingEvent> events;
+    events.reserve(profileEvents.size());
+
+    for (const auto* profileEvent : profileEvents) {
+        const std::string name {profileEvent->tag};
+
+        PROFILING_EVENT type = PROFILING_EVENT::OTHER;
+        switch (profileEvent->event_type) {
+            case EventType::OPERATOR_INVOKE_EVENT:
+            case EventType::DELEGATE_OPERATOR_INVOKE_EVENT:
+            case EventType::DELEGATE_PROFILED_OPERATOR_INVOKE_EVENT:
+                type = PROFILING_EVENT::NODE;
+                break;
+            default:
+                if (name == "Invoke") {
+                    type = PROFILING_EVENT::EXECUTE;
+                } else if (name == "AllocateTensors") {
+                    type = PROFILING_EVENT::INIT;
+                } else if (name == "ModifyGraphWithDelegate") {
+                    type = PROFILING_EVENT::FINALIZE;
+                }
+                break;
+        }
+
+        /* per-operator events are only reported at the detailed level */
+        if (type == PROFILING_EVENT::NODE
+            && getProfilingLevel() != PROFILING_LEVEL::DETAILED)
+        {
+            continue;
+        }
+
+        events.push_back({name,
+                          type,
+                          profileEvent->elapsed_time,
+                          PROFILING_UNIT::MICROSECONDS});
+    }
+
+    /* Reset() also stops recording, keep collecting further executions */
+    m_profiler->Reset();
+    m_profiler->StartProfiling();
+
+    return events;
+}
+
+auto ModelImpl::getMemoryStats() -> MemoryStats {
+    MemoryStats stats;
+
+    if (m_modelBuffer != nullptr && m_modelBuffer->allocation() != nullptr) {
+        stats.modelBytes = m_modelBuffer->allocation()->bytes();
+    }
+
+    for (const auto& buffer : m_ioBuffers) {
+        stats.ioBytes += buffer.size();
+    }
+
+    for (const auto& buffer : m_stateBuffers) {
+        stats.ioBytes += buffer.size();
+    }
+
+    for (const auto& buffer : m_preparedBuffers) {
+        stats.ioBytes += buffer.size();
+    }
+
+    if (m_interpreter == nullptr) {
+        return stats;
+    }
+
+    for (size_t i = 0; i < m_interpreter->subgraphs_size(); ++i) {
+        auto* subgraph = m_interpreter->subgraph(static_cast<int>(i));
+
+        ::tflite::SubgraphAllocInfo allocInfo {};
+        subgraph->GetMemoryAllocInfo(&allocInfo);
+
+        stats.persistentArenaBytes += allocInfo.arena_persist_size;
+        stats.nonPersistentArenaBytes += allocInfo.arena_size;
+        stats.dynamicBytes += allocInfo.dynamic_size;
+
+        /* tensors backed by a buffer handle live in delegate memory */
+        for (size_t j = 0; j < subgraph->tensors_size(); ++j) {
+            const auto* tensor = subgraph->tensor(static_cast<int>(j));
+            if (tensor != nullptr
+                && tensor->buffer_handle != kTfLiteNullBufferHandle)
+            {
+                stats.delegateBytes += tensor->bytes;
+            }
+        }
+    }
+
+    return stats;
+}
+
+void ModelImpl::deleteDelegate() {
+    deleteDelegates(getDelegate(), m_delegate, m_xnnpackDelegate);
 }
 
 ModelImpl::~ModelImpl() {
+    if (m_arenaGroup != nullptr) {
+        m_arenaGroup->deactivate(*this);
+    }
+
+    releasePreparedInterpreters();
+
+    m_interpreter.reset();
     deleteDelegate();
 }
 
@@ -13,6 +13,9 @@
 namespace edge::tflite {
 
 auto TensorImpl::getName() const -> std::string {
+    if (!m_name.empty()) {
+        return m_name;
+    }
     if (m_tensor == nullptr) {
         return "";
     }
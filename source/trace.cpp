@@ -0,0 +1,235 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "edgerunner/trace.hpp"
+
+#include <fmt/core.h>
+#include <fmt/format.h>
+
+#include "edgerunner/model.hpp"
+
+namespace edge {
+
+namespace {
+
+template<size_t N>
+void copyTruncated(std::array<char, N>& destination, const char* source) {
+    size_t length = 0;
+    if (source != nullptr) {
+        while (length < N - 1 && source[length] /* NOLINT */ != '\0') {
+            destination[length] = source[length]; /* NOLINT */
+            ++length;
+        }
+    }
+    destination[length] = '\0';
+}
+
+auto escapeJson(const std::string& value) -> std::string {
+    std::string escaped;
+    escaped.reserve(value.size());
+    for (const auto character : value) {
+        switch (character) {
+            case '"':
+                escaped += "\\\"";
+                break;
+            case '\\':
+                escaped += "\\\\";
+                break;
+            case '\n':
+                escaped += "\\n";
+                break;
+            case '\t':
+                escaped += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(character) < 0x20) {
+                    escaped += fmt::format(
+                        "\\u{:04x}", static_cast<unsigned>(character));
+                } else {
+                    escaped += character;
+                }
+                break;
+        }
+    }
+    return escaped;
+}
+
+}  // namespace
+
+Tracer::Tracer()
+    : m_epoch(std::chrono::steady_clock::now()) {}
+
+Tracer::~Tracer() = default;
+
+auto Tracer::get() -> Tracer& {
+    static Tracer tracer;
+    return tracer;
+}
+
+void Tracer::enable(const size_t capacity) {
+    if (m_slots.load(std::memory_order_acquire) == nullptr) {
+        const std::lock_guard<std::mutex> lock(m_allocationMutex);
+        if (m_slots.load(std::memory_order_relaxed) == nullptr) {
+            const auto slotCount = std::max<size_t>(capacity, 1);
+            m_slotStorage = std::make_unique<Slot[]>(slotCount); /* NOLINT */
+            m_capacity.store(slotCount, std::memory_order_relaxed);
+            m_slots.store(m_slotStorage.get(), std::memory_order_release);
+        }
+    }
+
+    m_enabled.store(true, std::memory_order_relaxed);
+}
+
+void Tracer::disable() {
+    m_enabled.store(false, std::memory_order_relaxed);
+}
+
+auto Tracer::getThreadId() -> uint32_t {
+    static std::atomic<uint32_t> nextThreadId {1};
+    thread_local const uint32_t threadId =
+        nextThreadId.fetch_add(1, std::memory_order_relaxed);
+    return threadId;
+}
+
+void Tracer::record(const char* name,
+                    const char* detail,
+                    const TimePoint start,
+                    const TimePoint end) {
+    auto* slots = m_slots.load(std::memory_order_acquire);
+    if (slots == nullptr) {
+        return;
+    }
+
+    const auto capacity = m_capacity.load(std::memory_order_relaxed);
+    const auto ticket = m_nextTicket.fetch_add(1, std::memory_order_relaxed);
+
+    auto& slot = slots[ticket % capacity]; /* NOLINT */
+
+    /* seqlock: an odd sequence marks the slot as being written */
+    slot.sequence.store(2 * ticket + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    copyTruncated(slot.name, name);
+    copyTruncated(slot.detail, detail);
+    slot.startNs = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(start - m_epoch)
+            .count());
+    slot.durationNs = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+            .count());
+    slot.threadId = getThreadId();
+
+    slot.sequence.store(2 * ticket + 2, std::memory_order_release);
+}
+
+auto Tracer::getEvents() const -> std::vector<TraceEvent> {
+    const auto* slots = m_slots.load(std::memory_order_acquire);
+    if (slots == nullptr) {
+        return {};
+    }
+
+    const auto capacity = m_capacity.load(std::memory_order_relaxed);
+    const auto firstTicket = m_firstTicket.load(std::memory_order_relaxed);
+
+    std::vector<TraceEvent> events;
+    events.reserve(capacity);
+
+    for (size_t i = 0; i < capacity; ++i) {
+        const auto& slot = slots[i]; /* NOLINT */
+
+        const auto sequenceBefore =
+            slot.sequence.load(std::memory_order_acquire);
+        if (sequenceBefore == 0 || sequenceBefore % 2 != 0
+            || (sequenceBefore - 2) / 2 < firstTicket)
+        {
+            continue;
+        }
+
+        TraceEvent event {slot.name.data(),
+                          slot.detail.data(),
+                          slot.startNs,
+                          slot.durationNs,
+                          slot.threadId};
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != sequenceBefore) {
+            continue;
+        }
+
+        events.push_back(std::move(event));
+    }
+
+    std::sort(events.begin(),
+              events.end(),
+              [](const TraceEvent& event1, const TraceEvent& event2) {
+                  return event1.startNs < event2.startNs;
+              });
+
+    return events;
+}
+
+void Tracer::clear() {
+    m_firstTicket.store(m_nextTicket.load(std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+}
+
+auto Tracer::toChromeTrace() const -> std::string {
+    static constexpr double NsPerUs = 1000.0;
+
+    std::string trace {R"({"displayTimeUnit":"ms","traceEvents":[)"};
+    auto traceIt = std::back_inserter(trace);
+
+    bool first = true;
+    for (const auto& event : getEvents()) {
+        if (!first) {
+            trace += ',';
+        }
+        first = false;
+
+        fmt::format_to(
+            traceIt,
+            R"({{"name":"{}","cat":"edgerunner","ph":"X","ts":{:.3f},)"
+            R"("dur":{:.3f},"pid":0,"tid":{})",
+            escapeJson(event.name),
+            static_cast<double>(event.startNs) / NsPerUs,
+            static_cast<double>(event.durationNs) / NsPerUs,
+            event.threadId);
+
+        if (!event.detail.empty()) {
+            fmt::format_to(
+                traceIt, R"(,"args":{{"detail":"{}"}})", escapeJson(event.detail));
+        }
+
+        trace += '}';
+    }
+
+    trace += "]}";
+
+    return trace;
+}
+
+auto Tracer::dumpChromeTrace(const std::filesystem::path& tracePath) const
+    -> STATUS {
+    std::ofstream file(tracePath, std::ios::binary);
+    if (!file) {
+        return STATUS::FAIL;
+    }
+
+    const auto trace = toChromeTrace();
+    file.write(trace.data(), static_cast<std::streamsize>(trace.size()));
+
+    return file ? STATUS::SUCCESS : STATUS::FAIL;
+}
+
+}  // namespace edge
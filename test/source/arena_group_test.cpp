@@ -0,0 +1,64 @@
+#include <cstddef>
+#include <mutex>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "edgerunner/arenaGroup.hpp"
+#include "edgerunner/model.hpp"
+
+namespace {
+
+/* counts the allocations and releases of its scratch memory */
+class CountingMember : public edge::ArenaGroup::Member {
+  public:
+    auto acquireScratch() -> edge::STATUS override {
+        ++numAcquired;
+        return edge::STATUS::SUCCESS;
+    }
+
+    auto releaseScratch() -> edge::STATUS override {
+        ++numReleased;
+        return edge::STATUS::SUCCESS;
+    }
+
+    size_t numAcquired = 0;
+    size_t numReleased = 0;
+};
+
+}  // namespace
+
+TEST_CASE("Arena group switches", "[memory]") {
+    edge::ArenaGroup group;
+    CountingMember first;
+    CountingMember second;
+
+    const auto execute = [&group](CountingMember& member) {
+        std::unique_lock<std::mutex> lock;
+        REQUIRE(group.acquire(member, lock) == edge::STATUS::SUCCESS);
+        REQUIRE(lock.owns_lock());
+    };
+
+    /* executing the active member again does not allocate again */
+    execute(first);
+    execute(first);
+    REQUIRE(first.numAcquired == 1);
+    REQUIRE(first.numReleased == 0);
+    REQUIRE(group.isActive(first));
+
+    /* every switch releases the active member and allocates the next */
+    execute(second);
+    execute(second);
+    REQUIRE(first.numReleased == 1);
+    REQUIRE(second.numAcquired == 1);
+
+    execute(first);
+    REQUIRE(first.numAcquired == 2);
+    REQUIRE(second.numReleased == 1);
+
+    /* a deactivated member allocates again, without releasing */
+    group.deactivate(first);
+    REQUIRE(!group.isActive(first));
+    execute(first);
+    REQUIRE(first.numAcquired == 3);
+    REQUIRE(first.numReleased == 1);
+}
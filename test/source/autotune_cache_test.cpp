@@ -0,0 +1,66 @@
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "edgerunner/autotune.hpp"
+#include "edgerunner/hash.hpp"
+#include "edgerunner/model.hpp"
+
+TEST_CASE("Model hashing", "[autotune][hash]") {
+    const std::string contents = "edgerunner";
+    const std::vector<uint8_t> bytes {contents.cbegin(), contents.cend()};
+
+    const auto hash = edge::hashBytes(bytes);
+    REQUIRE(hash != edge::HashOffsetBasis);
+    REQUIRE(hash == edge::hashBytes(bytes));
+
+    /* hashing in parts matches hashing at once */
+    const nonstd::span<const uint8_t> head {bytes.data(), 4};
+    const nonstd::span<const uint8_t> tail {bytes.data() + 4,
+                                            bytes.size() - 4};
+    REQUIRE(edge::hashBytes(tail, edge::hashBytes(head)) == hash);
+
+    REQUIRE(edge::hashFile("not_a_file.tflite") == 0);
+    REQUIRE(edge::getMachineFingerprint() == edge::getMachineFingerprint());
+}
+
+TEST_CASE("Autotune cache", "[autotune][cache]") {
+    const auto cachePath = std::filesystem::temp_directory_path()
+        / "edgerunner_autotune_test" / "autotune.txt";
+    std::filesystem::remove_all(cachePath.parent_path());
+
+    edge::AutotuneCache cache {cachePath};
+    static constexpr uint64_t ModelHash = 0x1234;
+    static constexpr uint64_t OtherModelHash = 0x5678;
+    const auto fingerprint = edge::getMachineFingerprint();
+
+    REQUIRE(!cache.find(ModelHash, fingerprint).has_value());
+
+    REQUIRE(cache.store(ModelHash, fingerprint, {edge::DELEGATE::CPU, 4, 1.5})
+            == edge::STATUS::SUCCESS);
+    REQUIRE(cache.store(OtherModelHash, fingerprint, {edge::DELEGATE::NPU, 0, 0.5})
+            == edge::STATUS::SUCCESS);
+
+    /* storing again replaces the decision of the same key */
+    REQUIRE(cache.store(ModelHash, fingerprint, {edge::DELEGATE::GPU, 2, 1.0})
+            == edge::STATUS::SUCCESS);
+
+    const edge::AutotuneCache reopenedCache {cachePath};
+    const auto decision = reopenedCache.find(ModelHash, fingerprint);
+    REQUIRE(decision.has_value());
+    REQUIRE(decision->delegate == edge::DELEGATE::GPU);
+    REQUIRE(decision->numThreads == 2);
+    REQUIRE(decision->latencyMs == 1.0);
+
+    const auto otherDecision = reopenedCache.find(OtherModelHash, fingerprint);
+    REQUIRE(otherDecision.has_value());
+    REQUIRE(otherDecision->delegate == edge::DELEGATE::NPU);
+
+    /* decisions are not shared between machines */
+    REQUIRE(!reopenedCache.find(ModelHash, fingerprint + 1).has_value());
+
+    std::filesystem::remove_all(cachePath.parent_path());
+}
@@ -0,0 +1,149 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "edgerunner/batcher.hpp"
+#include "edgerunner/model.hpp"
+#include "edgerunner/tensor.hpp"
+#include "fakes.hpp"
+
+namespace {
+
+/* sums pairs of values, [batch, 2] -> [batch, 1] */
+class SumModel : public StubModel {
+  public:
+    explicit SumModel(const bool resizable)
+        : StubModel("sum")
+        , m_resizable(resizable) {
+        allocate(1);
+    }
+
+    auto resizeInput(size_t index, const std::vector<size_t>& dimensions)
+        -> edge::STATUS override {
+        if (!m_resizable || index != 0 || dimensions.size() != 2) {
+            return edge::STATUS::FAIL;
+        }
+
+        allocate(dimensions.front());
+        ++resizes;
+        return edge::STATUS::SUCCESS;
+    }
+
+    auto execute() -> edge::STATUS override {
+        auto& input = static_cast<VectorTensor&>(*getInput(0)).getData();
+        auto& output = static_cast<VectorTensor&>(*getOutput(0)).getData();
+
+        for (size_t i = 0; i < output.size(); ++i) {
+            output[i] = input[2 * i] + input[2 * i + 1];
+        }
+
+        batchSizes.push_back(output.size());
+        return edge::STATUS::SUCCESS;
+    }
+
+    std::vector<size_t> batchSizes;
+    size_t resizes {};
+
+  private:
+    void allocate(const size_t batchSize) {
+        getInputs() = {std::make_shared<VectorTensor>(
+            std::vector<size_t> {batchSize, 2})};
+        getOutputs() = {std::make_shared<VectorTensor>(
+            std::vector<size_t> {batchSize, 1})};
+    }
+
+    bool m_resizable;
+};
+
+auto makeSample(const float first, const float second)
+    -> std::vector<std::vector<uint8_t>> {
+    std::vector<uint8_t> bytes(2 * sizeof(float));
+    std::memcpy(bytes.data(), &first, sizeof(float));
+    std::memcpy(bytes.data() + sizeof(float), &second, sizeof(float));
+    return {bytes};
+}
+
+auto getSum(const edge::BatchResult& result) -> float {
+    float sum {};
+    std::memcpy(&sum, result.outputs.at(0).data(), sizeof(float));
+    return sum;
+}
+
+}  // namespace
+
+TEST_CASE("Batcher packs concurrent requests", "[batcher]") {
+    static constexpr size_t NumRequests = 8;
+    static constexpr size_t MaxBatchSize = 4;
+
+    SumModel model {true};
+
+    edge::BatcherOptions options;
+    options.maxBatchSize = MaxBatchSize;
+    options.maxWait = std::chrono::milliseconds {500};
+
+    {
+        edge::Batcher batcher {model, options};
+        REQUIRE(batcher.getInputSampleSize(0) == 2 * sizeof(float));
+        REQUIRE(batcher.getInputSampleSize(1) == 0);
+
+        std::vector<std::future<edge::BatchResult>> futures;
+        for (size_t i = 0; i < NumRequests; ++i) {
+            futures.push_back(batcher.submit(
+                makeSample(static_cast<float>(i), static_cast<float>(i))));
+        }
+
+        for (size_t i = 0; i < NumRequests; ++i) {
+            const auto result = futures[i].get();
+            REQUIRE(result.status == edge::STATUS::SUCCESS);
+            REQUIRE(result.outputs.size() == 1);
+            REQUIRE(getSum(result) == static_cast<float>(2 * i));
+        }
+
+        const auto stats = batcher.getStats();
+        REQUIRE(stats.requests == NumRequests);
+        REQUIRE(stats.batches == NumRequests / MaxBatchSize);
+        REQUIRE(stats.latency.count == NumRequests);
+
+        /* partial batches are executed once the oldest request waited */
+        REQUIRE(getSum(batcher.submit(makeSample(1, 2)).get()) == 3);
+
+        /* malformed requests are rejected */
+        REQUIRE(batcher.submit({}).get().status == edge::STATUS::FAIL);
+        REQUIRE(batcher.submit({{1, 2, 3}}).get().status
+                == edge::STATUS::FAIL);
+    }
+
+    /* the model is resized once, the partial batch is zero-filled */
+    REQUIRE(model.batchSizes == std::vector<size_t>(3, MaxBatchSize));
+    REQUIRE(model.resizes == 1);
+}
+
+TEST_CASE("Batcher with a fixed batch size", "[batcher]") {
+    static constexpr size_t NumRequests = 3;
+
+    SumModel model {false};
+
+    edge::BatcherOptions options;
+    options.maxBatchSize = NumRequests;
+    options.maxWait = std::chrono::milliseconds {500};
+
+    edge::Batcher batcher {model, options};
+
+    std::vector<std::future<edge::BatchResult>> futures;
+    for (size_t i = 0; i < NumRequests; ++i) {
+        futures.push_back(batcher.submit(makeSample(static_cast<float>(i), 1)));
+    }
+
+    /* the batch is split into executions of the batch size of the model */
+    for (size_t i = 0; i < NumRequests; ++i) {
+        REQUIRE(getSum(futures[i].get()) == static_cast<float>(i + 1));
+    }
+    REQUIRE(model.batchSizes == std::vector<size_t>(NumRequests, 1));
+}
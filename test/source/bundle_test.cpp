@@ -0,0 +1,121 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#ifndef _WIN32
+#    include <unistd.h>
+#endif
+
+#include "edgerunner/bundle.hpp"
+#include "edgerunner/model.hpp"
+
+namespace {
+
+auto toBytes(const std::string& text) -> std::vector<uint8_t> {
+    return {text.cbegin(), text.cend()};
+}
+
+/* sections are page aligned, mappings are not aligned beyond the page size
+ * on systems with pages smaller than SectionAlignment */
+auto isAligned(const void* data) -> bool {
+#ifndef _WIN32
+    const auto alignment = std::min(edge::Bundle::SectionAlignment,
+                                    static_cast<size_t>(sysconf(_SC_PAGESIZE)));
+#else
+    const auto alignment = edge::Bundle::SectionAlignment;
+#endif
+
+    return reinterpret_cast<uintptr_t> /* NOLINT */ (data) % alignment == 0;
+}
+
+}  // namespace
+
+TEST_CASE("Bundle sections", "[bundle]") {
+    const auto bundlePath =
+        std::filesystem::temp_directory_path() / "sections.edgerunner";
+
+    const std::vector<uint8_t> model(3 * edge::Bundle::SectionAlignment + 7,
+                                     0xAB);
+    const std::vector<uint8_t> cache(100, 0xCD);
+
+    edge::BundleWriter writer;
+    REQUIRE(writer.addSection(edge::SECTION::TFLITE, model)
+            == edge::STATUS::SUCCESS);
+    REQUIRE(writer.addSection(edge::SECTION::QNN_CONTEXT,
+                              cache,
+                              "htp",
+                              edge::DELEGATE::NPU)
+            == edge::STATUS::SUCCESS);
+    REQUIRE(writer.addSection(edge::SECTION::LABELS,
+                              toBytes("background\r\ntench\ngoldfish\n"))
+            == edge::STATUS::SUCCESS);
+    REQUIRE(writer.addSection(
+                edge::SECTION::METADATA, toBytes("1.2.0"), "version")
+            == edge::STATUS::SUCCESS);
+    REQUIRE(writer.addSection(edge::SECTION::METADATA,
+                              {},
+                              std::string(40, 'x'))
+            == edge::STATUS::FAIL);
+    REQUIRE(writer.write(bundlePath) == edge::STATUS::SUCCESS);
+
+    const auto bundle = edge::Bundle::open(bundlePath);
+    REQUIRE(bundle != nullptr);
+    REQUIRE(bundle->name() == "sections");
+    REQUIRE(bundle->getSections().size() == 4);
+
+    /* sections are page aligned views of the mapping */
+    const auto modelSection = bundle->getSection(edge::SECTION::TFLITE);
+    REQUIRE(isAligned(modelSection.data()));
+    REQUIRE(std::vector<uint8_t>(modelSection.begin(), modelSection.end())
+            == model);
+
+    const auto cacheSection = bundle->getDelegateCache(edge::DELEGATE::NPU);
+    REQUIRE(isAligned(cacheSection.data()));
+    REQUIRE(std::vector<uint8_t>(cacheSection.begin(), cacheSection.end())
+            == cache);
+    REQUIRE(bundle->getDelegateCache(edge::DELEGATE::GPU).empty());
+
+    const auto labels = bundle->getLabels();
+    REQUIRE(labels.size() == 3);
+    REQUIRE(labels[0] == "background");
+    REQUIRE(labels[2] == "goldfish");
+
+    REQUIRE(bundle->getMetadata("version") == "1.2.0");
+    REQUIRE(bundle->getMetadata("author").empty());
+
+    std::filesystem::remove(bundlePath);
+}
+
+TEST_CASE("Bundle rejects malformed files", "[bundle]") {
+    const auto bundlePath =
+        std::filesystem::temp_directory_path() / "malformed.edgerunner";
+
+    REQUIRE(edge::Bundle::open(bundlePath) == nullptr);
+
+    {
+        std::ofstream file(bundlePath, std::ios::binary);
+        file << "not a bundle at all";
+    }
+    REQUIRE(edge::Bundle::open(bundlePath) == nullptr);
+
+    /* sections beyond the end of the file */
+    edge::BundleWriter writer;
+    REQUIRE(writer.addSection(edge::SECTION::TFLITE,
+                              std::vector<uint8_t>(
+                                  2 * edge::Bundle::SectionAlignment))
+            == edge::STATUS::SUCCESS);
+    REQUIRE(writer.write(bundlePath) == edge::STATUS::SUCCESS);
+    REQUIRE(edge::Bundle::open(bundlePath) != nullptr);
+
+    std::filesystem::resize_file(bundlePath,
+                                 2 * edge::Bundle::SectionAlignment);
+    REQUIRE(edge::Bundle::open(bundlePath) == nullptr);
+
+    std::filesystem::remove(bundlePath);
+}
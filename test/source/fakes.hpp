@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <nonstd/span.hpp>
+
+#include "edgerunner/model.hpp"
+#include "edgerunner/tensor.hpp"
+
+/* a float tensor owning its data */
+class VectorTensor : public edge::Tensor {
+  public:
+    explicit VectorTensor(std::vector<size_t> dimensions,
+                          std::string name = "tensor")
+        : m_name(std::move(name))
+        , m_dimensions(std::move(dimensions)) {
+        m_data.resize(getSize());
+    }
+
+    auto getName() const -> std::string override { return m_name; }
+
+    auto getType() const -> edge::TensorType override {
+        return edge::TensorType::FLOAT32;
+    }
+
+    auto getDimensions() const -> std::vector<size_t> override {
+        return m_dimensions;
+    }
+
+    auto getSize() const -> size_t override {
+        size_t size = 1;
+        for (const auto dimension : m_dimensions) {
+            size *= dimension;
+        }
+        return size;
+    }
+
+    auto getDataPtr() -> void* override { return m_data.data(); }
+
+    auto getNumBytes() -> size_t override {
+        return m_data.size() * sizeof(float);
+    }
+
+    auto getData() -> std::vector<float>& { return m_data; }
+
+  private:
+    std::string m_name;
+    std::vector<size_t> m_dimensions;
+    std::vector<float> m_data;
+};
+
+/* a model without a backend, derivatives implement execute() */
+class StubModel : public edge::Model {
+  public:
+    explicit StubModel(const std::filesystem::path& modelPath)
+        : edge::Model(modelPath) {}
+
+    auto loadModel(const std::filesystem::path& /*modelPath*/)
+        -> edge::STATUS override {
+        return edge::STATUS::SUCCESS;
+    }
+
+    auto loadModel(const nonstd::span<uint8_t>& /*modelBuffer*/)
+        -> edge::STATUS override {
+        return edge::STATUS::SUCCESS;
+    }
+
+    auto applyDelegate(const edge::DELEGATE& delegate)
+        -> edge::STATUS override {
+        setDelegate(delegate);
+        return edge::STATUS::SUCCESS;
+    }
+};
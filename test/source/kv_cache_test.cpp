@@ -0,0 +1,284 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "edgerunner/alignedBuffer.hpp"
+#include "edgerunner/kvCache.hpp"
+#include "edgerunner/model.hpp"
+#include "fakes.hpp"
+
+namespace {
+
+constexpr size_t TokenFloats = 16;
+constexpr size_t BytesPerToken = TokenFloats * sizeof(float);
+
+/* reads the bound caches and appends a token filled with the step number */
+class DecoderModel : public StubModel {
+  public:
+    DecoderModel()
+        : StubModel("decoder") {}
+
+    auto bindInput(size_t index, void* data, size_t numBytes)
+        -> edge::STATUS override {
+        m_inputs.resize(std::max(m_inputs.size(), index + 1));
+        m_inputs[index] = {static_cast<float*>(data), numBytes};
+        return edge::STATUS::SUCCESS;
+    }
+
+    auto bindOutput(size_t index, void* data, size_t numBytes)
+        -> edge::STATUS override {
+        m_outputs.resize(std::max(m_outputs.size(), index + 1));
+        m_outputs[index] = {static_cast<float*>(data), numBytes};
+        return edge::STATUS::SUCCESS;
+    }
+
+    auto execute() -> edge::STATUS override {
+        ++m_step;
+
+        m_inputSum = 0.0F;
+        for (const auto& input : m_inputs) {
+            for (size_t i = 0; i < input.numBytes / sizeof(float); ++i) {
+                m_inputSum += input.data[i];  // NOLINT
+            }
+        }
+
+        for (const auto& output : m_outputs) {
+            std::fill_n(output.data,
+                        output.numBytes / sizeof(float),
+                        static_cast<float>(m_step));
+        }
+
+        return edge::STATUS::SUCCESS;
+    }
+
+    struct Binding {
+        float* data = nullptr;
+        size_t numBytes {};
+    };
+
+    std::vector<Binding> m_inputs;
+    std::vector<Binding> m_outputs;
+    size_t m_step {};
+    float m_inputSum {};
+};
+
+auto getToken(edge::KVCache& cache, size_t sequence, size_t position)
+    -> float {
+    float value {};
+    std::memcpy(&value,
+                cache.getCache(sequence, 0).data() + position * BytesPerToken,
+                sizeof(value));
+    return value;
+}
+
+void setToken(edge::KVCache& cache,
+              size_t sequence,
+              size_t position,
+              float value) {
+    std::vector<float> token(TokenFloats, value);
+    std::memcpy(cache.getCache(sequence, 0).data() + position * BytesPerToken,
+                token.data(),
+                BytesPerToken);
+}
+
+}  // namespace
+
+TEST_CASE("KVCache appends model outputs in place", "[kvcache]") {
+    edge::KVCacheOptions options;
+    options.bytesPerToken = BytesPerToken;
+    options.maxTokens = 256;
+    options.numBlocks = 6;
+
+    edge::KVCache cache {options};
+    REQUIRE(cache.getCreationStatus() == edge::STATUS::SUCCESS);
+
+    /* blocks are whole pages */
+    REQUIRE(cache.getBlockTokens() * BytesPerToken % 4096 == 0);
+
+    size_t sequence {};
+    REQUIRE(cache.createSequence(sequence) == edge::STATUS::SUCCESS);
+    REQUIRE(cache.getLength(sequence) == 0);
+
+    DecoderModel model;
+    const std::vector<edge::KVCacheBinding> bindings {{0, 0, 0}, {1, 1, 1}};
+
+    const size_t numTokens = 100;
+    float expectedSum = 0.0F;
+    for (size_t step = 1; step <= numTokens; ++step) {
+        REQUIRE(cache.bind(model, sequence, bindings) == edge::STATUS::SUCCESS);
+
+        /* the inputs are the windows, the outputs the next slots */
+        auto window = cache.getCache(sequence, 0);
+        REQUIRE(reinterpret_cast<uint8_t*>(model.m_inputs[0].data)  // NOLINT
+                == window.data());
+        REQUIRE(reinterpret_cast<uint8_t*>(model.m_outputs[0].data)  // NOLINT
+                == window.data() + (step - 1) * BytesPerToken);
+        REQUIRE(model.m_outputs[0].numBytes == BytesPerToken);
+
+        REQUIRE(model.execute() == edge::STATUS::SUCCESS);
+        REQUIRE(model.m_inputSum == expectedSum);
+        expectedSum += 2.0F * TokenFloats * static_cast<float>(step);
+
+        REQUIRE(cache.append(sequence) == edge::STATUS::SUCCESS);
+    }
+
+    REQUIRE(cache.getLength(sequence) == numTokens);
+    for (size_t position = 0; position < numTokens; ++position) {
+        REQUIRE(getToken(cache, sequence, position)
+                == static_cast<float>(position + 1));
+    }
+
+    /* positions without a block read as zeros */
+    REQUIRE(getToken(cache, sequence, options.maxTokens - 1) == 0.0F);
+
+    const auto numBlocks =
+        (numTokens + cache.getBlockTokens() - 1) / cache.getBlockTokens();
+    REQUIRE(cache.getNumFreeBlocks() == options.numBlocks - numBlocks);
+
+    REQUIRE(cache.removeSequence(sequence) == edge::STATUS::SUCCESS);
+    REQUIRE(cache.removeSequence(sequence) == edge::STATUS::FAIL);
+    REQUIRE(cache.getNumFreeBlocks() == options.numBlocks);
+}
+
+TEST_CASE("KVCache token sizes", "[kvcache]") {
+    static constexpr size_t PageSize = 4096;
+
+    edge::KVCacheOptions options;
+    options.numCaches = 1;
+    options.maxTokens = 256;
+    options.numBlocks = 4;
+
+    /* tokens must be aligned, such that output slots are aligned */
+    options.bytesPerToken = BytesPerToken + sizeof(float);
+    REQUIRE(edge::KVCache {options}.getCreationStatus() == edge::STATUS::FAIL);
+
+    /* aligned sizes which are not a power of two */
+    options.bytesPerToken = 3 * edge::AlignedBuffer::DefaultAlignment;
+    edge::KVCache cache {options};
+    REQUIRE(cache.getCreationStatus() == edge::STATUS::SUCCESS);
+
+    const auto blockTokens = cache.getBlockTokens();
+    REQUIRE(blockTokens >= options.blockTokens);
+    REQUIRE(blockTokens <= PageSize / edge::AlignedBuffer::DefaultAlignment);
+    REQUIRE(blockTokens * options.bytesPerToken % PageSize == 0);
+
+    size_t sequence {};
+    REQUIRE(cache.createSequence(sequence) == edge::STATUS::SUCCESS);
+
+    DecoderModel model;
+    for (size_t step = 0; step < blockTokens + 1; ++step) {
+        REQUIRE(cache.bind(model, sequence, {{0, 0, 0}})
+                == edge::STATUS::SUCCESS);
+        REQUIRE(reinterpret_cast<uintptr_t>(model.m_outputs[0].data)  // NOLINT
+                    % edge::AlignedBuffer::DefaultAlignment
+                == 0);
+        REQUIRE(model.execute() == edge::STATUS::SUCCESS);
+        REQUIRE(cache.append(sequence) == edge::STATUS::SUCCESS);
+    }
+
+    REQUIRE(cache.getNumFreeBlocks() == options.numBlocks - 2);
+}
+
+TEST_CASE("KVCache sliding window", "[kvcache]") {
+    edge::KVCacheOptions options;
+    options.numCaches = 1;
+    options.bytesPerToken = BytesPerToken;
+    options.blockTokens = 1;
+    options.maxTokens = 1;
+    options.numBlocks = 4;
+
+    /* a window of two blocks */
+    {
+        edge::KVCache probe {options};
+        options.maxTokens = 2 * probe.getBlockTokens();
+    }
+    options.slidingWindow = true;
+
+    edge::KVCache cache {options};
+    REQUIRE(cache.getCreationStatus() == edge::STATUS::SUCCESS);
+    const auto blockTokens = cache.getBlockTokens();
+
+    size_t sequence {};
+    REQUIRE(cache.createSequence(sequence) == edge::STATUS::SUCCESS);
+
+    const auto numTokens = 3 * blockTokens + 5;
+    for (size_t token = 0; token < numTokens; ++token) {
+        REQUIRE(cache.reserve(sequence) == edge::STATUS::SUCCESS);
+        setToken(cache,
+                 sequence,
+                 cache.getLength(sequence),
+                 static_cast<float>(token));
+        REQUIRE(cache.append(sequence) == edge::STATUS::SUCCESS);
+    }
+
+    /* the oldest blocks were evicted, the remaining tokens moved down */
+    REQUIRE(cache.getLength(sequence) <= options.maxTokens);
+    REQUIRE(cache.getLength(sequence) + cache.getNumEvicted(sequence)
+            == numTokens);
+    REQUIRE(cache.getNumEvicted(sequence) % blockTokens == 0);
+    for (size_t position = 0; position < cache.getLength(sequence); ++position)
+    {
+        REQUIRE(getToken(cache, sequence, position)
+                == static_cast<float>(cache.getNumEvicted(sequence) + position));
+    }
+
+    REQUIRE(cache.getNumFreeBlocks() == options.numBlocks - 2);
+}
+
+TEST_CASE("KVCache block accounting", "[kvcache]") {
+    edge::KVCacheOptions options;
+    options.numCaches = 1;
+    options.bytesPerToken = BytesPerToken;
+    options.blockTokens = 1;
+    options.maxTokens = 1024;
+    options.numBlocks = 2;
+
+    edge::KVCache cache {options};
+    REQUIRE(cache.getCreationStatus() == edge::STATUS::SUCCESS);
+    const auto blockTokens = cache.getBlockTokens();
+
+    size_t first {};
+    size_t second {};
+    REQUIRE(cache.createSequence(first) == edge::STATUS::SUCCESS);
+    REQUIRE(cache.createSequence(second) == edge::STATUS::SUCCESS);
+    REQUIRE(first != second);
+
+    /* without a sliding window, sequences cannot outgrow maxTokens */
+    REQUIRE(cache.reserve(first, options.maxTokens + 1) == edge::STATUS::FAIL);
+
+    REQUIRE(cache.reserve(first, 2 * blockTokens) == edge::STATUS::SUCCESS);
+    REQUIRE(cache.append(first, 2 * blockTokens) == edge::STATUS::SUCCESS);
+    REQUIRE(cache.getNumFreeBlocks() == 0);
+
+    /* out of blocks */
+    REQUIRE(cache.reserve(second) == edge::STATUS::FAIL);
+    REQUIRE(cache.append(second) == edge::STATUS::FAIL);
+
+    /* rolling back tokens frees their blocks */
+    REQUIRE(cache.truncate(first, blockTokens / 2) == edge::STATUS::SUCCESS);
+    REQUIRE(cache.getLength(first) == blockTokens / 2);
+    REQUIRE(cache.getNumFreeBlocks() == 1);
+
+    REQUIRE(cache.reserve(second) == edge::STATUS::SUCCESS);
+    setToken(cache, second, 0, 7.0F);
+    REQUIRE(cache.append(second) == edge::STATUS::SUCCESS);
+
+    /* evicting the only block of a sequence empties it */
+    REQUIRE(cache.evict(first) == edge::STATUS::SUCCESS);
+    REQUIRE(cache.getLength(first) == 0);
+    REQUIRE(cache.getNumEvicted(first) == blockTokens / 2);
+    REQUIRE(getToken(cache, first, 0) == 0.0F);
+    REQUIRE(cache.getNumFreeBlocks() == 1);
+
+    /* reused blocks are zeroed */
+    REQUIRE(cache.reserve(first) == edge::STATUS::SUCCESS);
+    REQUIRE(getToken(cache, first, 0) == 0.0F);
+    REQUIRE(getToken(cache, second, 0) == 7.0F);
+
+    REQUIRE(cache.getCache(first, 1).empty());
+}
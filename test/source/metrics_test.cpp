@@ -0,0 +1,134 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "edgerunner/metrics.hpp"
+#include "edgerunner/model.hpp"
+
+TEST_CASE("Latency histogram buckets", "[metrics]") {
+    using edge::LatencyHistogram;
+
+    /* small values are recorded exactly */
+    for (uint64_t value = 0; value < LatencyHistogram::SubBucketCount; ++value)
+    {
+        const auto index = LatencyHistogram::getBucketIndex(value);
+        REQUIRE(LatencyHistogram::getBucketUpperBound(index) == value);
+    }
+
+    /* larger values are bounded by the sub-bucket relative error */
+    for (uint64_t value = LatencyHistogram::SubBucketCount;
+         value < LatencyHistogram::MaxValue;
+         value = value * 3 + 1)
+    {
+        const auto index = LatencyHistogram::getBucketIndex(value);
+        REQUIRE(index < LatencyHistogram::NumBuckets);
+
+        const auto upperBound = LatencyHistogram::getBucketUpperBound(index);
+        REQUIRE(upperBound >= value);
+        REQUIRE(upperBound - value
+                <= value / LatencyHistogram::SubBucketCount + 1);
+    }
+
+    const auto lastIndex =
+        LatencyHistogram::getBucketIndex(LatencyHistogram::MaxValue * 2);
+    REQUIRE(lastIndex == LatencyHistogram::NumBuckets - 1);
+}
+
+TEST_CASE("Latency histogram percentiles", "[metrics]") {
+    edge::LatencyHistogram histogram;
+
+    auto snapshot = histogram.snapshot();
+    REQUIRE(snapshot.count == 0);
+    REQUIRE(snapshot.getPercentile(99.0) == 0);
+
+    constexpr uint64_t NumValues = 1000;
+    for (uint64_t value = 1; value <= NumValues; ++value) {
+        histogram.record(value);
+    }
+
+    snapshot = histogram.snapshot();
+    REQUIRE(snapshot.count == NumValues);
+    REQUIRE(snapshot.min == 1);
+    REQUIRE(snapshot.max == NumValues);
+    REQUIRE(snapshot.sum == NumValues * (NumValues + 1) / 2);
+
+    const auto p50 = snapshot.getPercentile(50.0);
+    REQUIRE(p50 >= 500);
+    REQUIRE(p50 <= 500 + 500 / edge::LatencyHistogram::SubBucketCount);
+
+    const auto p99 = snapshot.getPercentile(99.0);
+    REQUIRE(p99 >= 990);
+    REQUIRE(p99 <= NumValues);
+
+    REQUIRE(snapshot.getPercentile(100.0) == NumValues);
+
+    histogram.reset();
+    snapshot = histogram.snapshot();
+    REQUIRE(snapshot.count == 0);
+    REQUIRE(snapshot.sum == 0);
+}
+
+TEST_CASE("Latency histogram concurrent recording", "[metrics]") {
+    edge::LatencyHistogram histogram;
+
+    constexpr size_t NumThreads = 4;
+    constexpr uint64_t NumValuesPerThread = 10000;
+
+    std::vector<std::thread> threads;
+    threads.reserve(NumThreads);
+    for (size_t i = 0; i < NumThreads; ++i) {
+        threads.emplace_back([&histogram]() {
+            for (uint64_t value = 0; value < NumValuesPerThread; ++value) {
+                histogram.record(value);
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const auto snapshot = histogram.snapshot();
+    REQUIRE(snapshot.count == NumThreads * NumValuesPerThread);
+    REQUIRE(snapshot.min == 0);
+    REQUIRE(snapshot.max == NumValuesPerThread - 1);
+}
+
+TEST_CASE("Model metrics export", "[metrics]") {
+    edge::ModelMetrics metrics;
+
+    metrics.getLoadLatency().record(1000);
+    metrics.recordExecution(edge::ModelMetrics::now(), edge::STATUS::SUCCESS);
+    metrics.recordExecution(edge::ModelMetrics::now(), edge::STATUS::FAIL);
+
+    const auto snapshot = metrics.snapshot();
+    REQUIRE(snapshot.executions == 2);
+    REQUIRE(snapshot.failures == 1);
+    REQUIRE(snapshot.execute.count == 2);
+    REQUIRE(snapshot.load.count == 1);
+    REQUIRE(snapshot.allocate.count == 0);
+
+    const auto json = edge::toJson(snapshot, "my\"model");
+    REQUIRE(json.find(R"("model":"my\"model")") != std::string::npos);
+    REQUIRE(json.find(R"("executions":2)") != std::string::npos);
+    REQUIRE(json.find(R"("failures":1)") != std::string::npos);
+
+    const auto prometheus = edge::toPrometheus(snapshot, "model");
+    REQUIRE(prometheus.find("edgerunner_executions_total{model=\"model\"} 2")
+            != std::string::npos);
+    REQUIRE(prometheus.find("edgerunner_execution_failures_total{model="
+                            "\"model\"} 1")
+            != std::string::npos);
+    REQUIRE(prometheus.find("edgerunner_load_latency_microseconds{model="
+                            "\"model\",quantile=\"0.99\"} 1000")
+            != std::string::npos);
+
+    metrics.reset();
+    const auto resetSnapshot = metrics.snapshot();
+    REQUIRE(resetSnapshot.executions == 0);
+    REQUIRE(resetSnapshot.execute.count == 0);
+}
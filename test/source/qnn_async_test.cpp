@@ -0,0 +1,67 @@
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "edgerunner/edgerunner.hpp"
+#include "edgerunner/model.hpp"
+#include "edgerunner/options.hpp"
+#include "edgerunner/tensor.hpp"
+#include "utils.hpp"
+
+TEST_CASE("QNN asynchronous execution", "[qnn][async][npu]") {
+    const std::string modelPath = "models/qnn/mobilenet_v3_small.bin";
+
+    edge::ModelOptions options;
+    options.asyncQueueDepth = 3;
+
+    auto model = edge::createModel(modelPath, options);
+    REQUIRE(model != nullptr);
+
+    /* submit more executions than the queue depth */
+    static constexpr size_t NumExecutions = 8;
+
+    /* distinct inputs, such that reused tensors would show in the results */
+    const auto fillInput = [&model](const size_t execution) {
+        auto input = model->getInput(0)->getTensorAs<float>();
+        std::fill(input.begin(),
+                  input.end(),
+                  static_cast<float>(execution + 1) / NumExecutions);
+    };
+
+    std::vector<std::vector<float>> expected;
+    expected.reserve(NumExecutions);
+    for (size_t i = 0; i < NumExecutions; ++i) {
+        fillInput(i);
+        REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+
+        const auto output = model->getOutput(0)->getTensorAs<float>();
+        expected.emplace_back(output.cbegin(), output.cend());
+    }
+
+    std::vector<std::future<edge::AsyncResult>> futures;
+    futures.reserve(NumExecutions);
+    for (size_t i = 0; i < NumExecutions; ++i) {
+        fillInput(i);
+        futures.emplace_back(model->executeAsync());
+    }
+
+    /* retrieved once all executions completed, after slots were reused */
+    for (size_t i = 0; i < NumExecutions; ++i) {
+        const auto result = futures[i].get();
+        REQUIRE(result.status == edge::STATUS::SUCCESS);
+        REQUIRE(result.outputs.size() == model->getNumOutputs());
+
+        /* results are copies owned by the caller */
+        REQUIRE(result.outputs[0] != model->getOutput(0));
+
+        const auto output = result.outputs[0]->getTensorAs<float>();
+        REQUIRE(meanSquaredError(expected[i], output) < MseThreshold);
+    }
+
+    const auto metrics = model->getMetrics().snapshot();
+    REQUIRE(metrics.executions == 2 * NumExecutions);
+}
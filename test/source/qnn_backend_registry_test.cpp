@@ -0,0 +1,65 @@
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "edgerunner/edgerunner.hpp"
+#include "edgerunner/model.hpp"
+#include "edgerunner/tensor.hpp"
+
+TEST_CASE("QNN concurrent model loading", "[qnn][backend][npu]") {
+    const std::string modelPath = "models/qnn/mobilenet_v3_small.bin";
+
+    static constexpr size_t NumThreads = 4;
+
+    std::vector<std::unique_ptr<edge::Model>> models(NumThreads);
+    std::vector<std::thread> threads;
+    threads.reserve(NumThreads);
+    for (size_t i = 0; i < NumThreads; ++i) {
+        threads.emplace_back([&models, &modelPath, i]() {
+            models[i] = edge::createModel(modelPath);
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (auto& model : models) {
+        REQUIRE(model != nullptr);
+        REQUIRE(model->getCreationStatus() == edge::STATUS::SUCCESS);
+        REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+    }
+
+    /* context binaries are bound to the HTP backend */
+    REQUIRE(models.front()->applyDelegate(edge::DELEGATE::CPU)
+            == edge::STATUS::FAIL);
+    REQUIRE(models.front()->applyDelegate(edge::DELEGATE::NPU)
+            == edge::STATUS::SUCCESS);
+}
+
+TEST_CASE("QNN CPU backend", "[qnn][backend][cpu]") {
+    const std::string modelPath = "models/qnn/mobilenet_v3_small.so";
+
+    auto model = edge::createModel(modelPath);
+    REQUIRE(model != nullptr);
+    REQUIRE(model->getCreationStatus() == edge::STATUS::SUCCESS);
+
+    REQUIRE(model->applyDelegate(edge::DELEGATE::CPU) == edge::STATUS::SUCCESS);
+    REQUIRE(model->getDelegate() == edge::DELEGATE::CPU);
+
+    auto inputData = model->getInput(0)->getTensorAs<float>();
+    std::fill(inputData.begin(), inputData.end(), 0);
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+
+    REQUIRE(model->applyDelegate(edge::DELEGATE::NPU) == edge::STATUS::SUCCESS);
+    REQUIRE(model->getDelegate() == edge::DELEGATE::NPU);
+
+    inputData = model->getInput(0)->getTensorAs<float>();
+    std::fill(inputData.begin(), inputData.end(), 0);
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+}
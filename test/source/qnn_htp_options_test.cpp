@@ -0,0 +1,45 @@
+#include <algorithm>
+#include <cstdint>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "edgerunner/edgerunner.hpp"
+#include "edgerunner/model.hpp"
+#include "edgerunner/options.hpp"
+#include "edgerunner/tensor.hpp"
+
+TEST_CASE("QNN HTP tuning options", "[qnn][options][npu]") {
+    const std::string modelPath = "models/qnn/mobilenet_v3_small.so";
+
+    edge::ModelOptions options;
+    options.htp.optimizationLevel = 2.0F;
+    options.htp.precision = edge::TensorType::FLOAT16;
+    options.htp.vtcmSizeMb = 8;
+    options.htp.hvxThreads = 4;
+
+    auto model = edge::createModel(modelPath, options);
+    REQUIRE(model != nullptr);
+    REQUIRE(model->getCreationStatus() == edge::STATUS::SUCCESS);
+    REQUIRE(model->getPrecision() == edge::TensorType::FLOAT16);
+
+    auto inputData = model->getInput(0)->getTensorAs<float>();
+    std::fill(inputData.begin(), inputData.end(), 0);
+
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+    REQUIRE(model->getOutput(0)->getSize() > 0);
+}
+
+TEST_CASE("QNN HTP context options", "[qnn][options][npu]") {
+    const std::string modelPath = "models/qnn/mobilenet_v3_small.bin";
+
+    static constexpr uint64_t SpillFillBufferSize = 1U << 20U;
+
+    edge::ModelOptions options;
+    options.htp.spillFillBufferSize = SpillFillBufferSize;
+
+    auto model = edge::createModel(modelPath, options);
+    REQUIRE(model != nullptr);
+    REQUIRE(model->getCreationStatus() == edge::STATUS::SUCCESS);
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+}
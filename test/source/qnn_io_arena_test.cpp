@@ -0,0 +1,45 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "edgerunner/alignedBuffer.hpp"
+#include "edgerunner/edgerunner.hpp"
+#include "edgerunner/model.hpp"
+#include "edgerunner/tensor.hpp"
+
+TEST_CASE("QNN I/O arena", "[qnn][memory][npu]") {
+    const std::string modelPath = "models/qnn/mobilenet_v3_small.bin";
+
+    auto model = edge::createModel(modelPath);
+    REQUIRE(model != nullptr);
+
+    auto input = model->getInput(0)->getTensorAs<float>();
+    auto output = model->getOutput(0)->getTensorAs<float>();
+    REQUIRE(input.data() != nullptr);
+    REQUIRE(output.data() != nullptr);
+
+    /* every tensor starts on a cache line */
+    const auto inputAddress = reinterpret_cast<uintptr_t>(input.data());
+    const auto outputAddress = reinterpret_cast<uintptr_t>(output.data());
+    REQUIRE(inputAddress % edge::AlignedBuffer::DefaultAlignment == 0);
+    REQUIRE(outputAddress % edge::AlignedBuffer::DefaultAlignment == 0);
+
+    /* inputs then outputs, packed in a single arena */
+    const auto inputBytes = input.size() * sizeof(float);
+    REQUIRE(outputAddress
+            == inputAddress
+                + edge::AlignedBuffer::alignUp(
+                    inputBytes, edge::AlignedBuffer::DefaultAlignment));
+
+    const auto stats = model->getMemoryStats();
+    REQUIRE(stats.ioBytes >= inputBytes + output.size() * sizeof(float));
+
+    /* addresses are stable across executions and delegate changes */
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+    REQUIRE(model->applyDelegate(edge::DELEGATE::NPU)
+            == edge::STATUS::SUCCESS);
+    REQUIRE(model->getInput(0)->getTensorAs<float>().data() == input.data());
+    REQUIRE(model->getOutput(0)->getTensorAs<float>().data() == output.data());
+}
@@ -0,0 +1,36 @@
+#include <algorithm>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "edgerunner/edgerunner.hpp"
+#include "edgerunner/model.hpp"
+#include "edgerunner/tensor.hpp"
+
+TEST_CASE("QNN graph selection", "[qnn][graph][npu]") {
+    const std::string modelPath = "models/qnn/mobilenet_v3_small.bin";
+
+    auto model = edge::createModel(modelPath);
+    REQUIRE(model != nullptr);
+
+    const auto graphNames = model->getGraphNames();
+    REQUIRE(!graphNames.empty());
+    REQUIRE(std::none_of(
+        graphNames.cbegin(), graphNames.cend(), [](const auto& graphName) {
+            return graphName.empty();
+        }));
+
+    REQUIRE(model->selectGraph("not_a_graph") == edge::STATUS::FAIL);
+    REQUIRE(model->execute("not_a_graph") == edge::STATUS::FAIL);
+
+    /* every graph has its own, persistent I/O tensors */
+    for (const auto& graphName : graphNames) {
+        REQUIRE(model->selectGraph(graphName) == edge::STATUS::SUCCESS);
+        REQUIRE(model->getNumInputs() > 0);
+        REQUIRE(model->getNumOutputs() > 0);
+
+        const auto input = model->getInput(0);
+        REQUIRE(model->execute(graphName) == edge::STATUS::SUCCESS);
+        REQUIRE(model->getInput(0) == input);
+    }
+}
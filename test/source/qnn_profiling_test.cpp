@@ -0,0 +1,55 @@
+#include <algorithm>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "edgerunner/edgerunner.hpp"
+#include "edgerunner/model.hpp"
+#include "edgerunner/options.hpp"
+#include "edgerunner/profiling.hpp"
+
+TEST_CASE("QNN context binary profiling", "[qnn][profiling]") {
+    const std::string modelPath = "models/qnn/mobilenet_v3_small.bin";
+
+    edge::ModelOptions options;
+    options.profilingLevel = edge::PROFILING_LEVEL::DETAILED;
+
+    auto model = edge::createModel(modelPath, options);
+    REQUIRE(model != nullptr);
+    REQUIRE(model->getProfilingLevel() == edge::PROFILING_LEVEL::DETAILED);
+
+    const auto loadEvents = model->getProfilingEvents();
+    REQUIRE(std::any_of(
+        loadEvents.cbegin(), loadEvents.cend(), [](const auto& event) {
+            return event.type == edge::PROFILING_EVENT::DESERIALIZE;
+        }));
+
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+
+    const auto executeEvents = model->getProfilingEvents();
+    REQUIRE(std::any_of(
+        executeEvents.cbegin(), executeEvents.cend(), [](const auto& event) {
+            return event.type == edge::PROFILING_EVENT::EXECUTE;
+        }));
+}
+
+TEST_CASE("QNN shared library profiling", "[qnn][profiling]") {
+    const std::string modelPath = "models/qnn/mobilenet_v3_small.so";
+
+    edge::ModelOptions options;
+    options.profilingLevel = edge::PROFILING_LEVEL::BASIC;
+
+    auto model = edge::createModel(modelPath, options);
+    REQUIRE(model != nullptr);
+
+    const auto loadEvents = model->getProfilingEvents();
+    REQUIRE(std::any_of(
+        loadEvents.cbegin(), loadEvents.cend(), [](const auto& event) {
+            return event.type == edge::PROFILING_EVENT::FINALIZE;
+        }));
+
+    REQUIRE(model->enableProfiling(edge::PROFILING_LEVEL::OFF)
+            == edge::STATUS::SUCCESS);
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+    REQUIRE(model->getProfilingEvents().empty());
+}
@@ -0,0 +1,179 @@
+#include <atomic>
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "edgerunner/model.hpp"
+#include "edgerunner/reloadableModel.hpp"
+#include "edgerunner/tensor.hpp"
+#include "fakes.hpp"
+
+namespace {
+
+/* writes its version to the output, counts its live instances */
+class VersionModel : public StubModel {
+  public:
+    VersionModel(const float version,
+                 const size_t outputSize,
+                 std::atomic<int>& instances)
+        : StubModel("version")
+        , m_version(version)
+        , m_instances(instances) {
+        getInputs() = {std::make_shared<VectorTensor>(std::vector<size_t> {1})};
+        getOutputs() = {std::make_shared<VectorTensor>(
+            std::vector<size_t> {outputSize})};
+        ++m_instances;
+    }
+
+    VersionModel(const VersionModel&) = delete;
+    VersionModel(VersionModel&&) = delete;
+    auto operator=(const VersionModel&) -> VersionModel& = delete;
+    auto operator=(VersionModel&&) -> VersionModel& = delete;
+
+    ~VersionModel() override { --m_instances; }
+
+    auto execute() -> edge::STATUS override {
+        getOutput(0)->getTensorAs<float>()[0] = m_version;
+        ++executions;
+        return edge::STATUS::SUCCESS;
+    }
+
+    auto getVersion() const -> float { return m_version; }
+
+    size_t executions = 0;
+
+  private:
+    float m_version;
+    std::atomic<int>& m_instances;
+};
+
+auto executeVersion(edge::Model& model) -> float {
+    REQUIRE(model.execute() == edge::STATUS::SUCCESS);
+    return model.getOutput(0)->getTensorAs<float>()[0];
+}
+
+}  // namespace
+
+TEST_CASE("ReloadableModel swaps versions", "[reload]") {
+    std::atomic<int> instances {};
+
+    edge::ReloadableModel reloadable {
+        std::make_unique<VersionModel>(1.0F, 1, instances)};
+    REQUIRE(reloadable.getCreationStatus() == edge::STATUS::SUCCESS);
+    REQUIRE(reloadable.getVersion() == 1);
+
+    /* a request in flight keeps the version it acquired */
+    auto inFlight = reloadable.acquire();
+    REQUIRE(executeVersion(*inFlight) == 1.0F);
+
+    auto status = reloadable.reload(
+        [&instances]() -> std::unique_ptr<edge::Model> {
+            return std::make_unique<VersionModel>(2.0F, 1, instances);
+        });
+    REQUIRE(status.get() == edge::STATUS::SUCCESS);
+    REQUIRE(reloadable.getVersion() == 2);
+
+    /* new versions are warmed up before they are swapped in */
+    auto current = reloadable.acquire();
+    REQUIRE(static_cast<VersionModel&>(*current).executions == 1);
+    REQUIRE(executeVersion(*current) == 2.0F);
+    REQUIRE(executeVersion(*inFlight) == 1.0F);
+
+    /* the previous version is reclaimed once released */
+    REQUIRE(instances == 2);
+    inFlight.reset();
+    while (instances != 1) {
+        std::this_thread::yield();
+    }
+
+    SECTION("Failed reloads keep the current version") {
+        REQUIRE(reloadable.reload([]() { return nullptr; }).get()
+                == edge::STATUS::FAIL);
+
+        /* incompatible tensors */
+        REQUIRE(reloadable
+                    .reload([&instances]() -> std::unique_ptr<edge::Model> {
+                        return std::make_unique<VersionModel>(
+                            3.0F, 2, instances);
+                    })
+                    .get()
+                == edge::STATUS::FAIL);
+
+        REQUIRE(reloadable.reload(nullptr).get() == edge::STATUS::FAIL);
+
+        REQUIRE(reloadable.getVersion() == 2);
+        REQUIRE(executeVersion(*reloadable.acquire()) == 2.0F);
+    }
+}
+
+TEST_CASE("ReloadableModel without a model", "[reload]") {
+    std::atomic<int> instances {};
+
+    edge::ReloadableModel reloadable {nullptr};
+    REQUIRE(reloadable.getCreationStatus() == edge::STATUS::FAIL);
+    REQUIRE(reloadable.acquire() == nullptr);
+
+    REQUIRE(reloadable
+                .reload([&instances]() -> std::unique_ptr<edge::Model> {
+                    return std::make_unique<VersionModel>(1.0F, 1, instances);
+                })
+                .get()
+            == edge::STATUS::FAIL);
+    REQUIRE(instances == 0);
+}
+
+TEST_CASE("ReloadableModel under concurrent requests", "[reload]") {
+    static constexpr size_t NumReloads = 16;
+    static constexpr size_t NumThreads = 4;
+
+    std::atomic<int> instances {};
+
+    {
+        edge::ReloadableModel reloadable {
+            std::make_unique<VersionModel>(0.0F, 1, instances)};
+
+        std::atomic<bool> done {false};
+        std::vector<std::thread> requests;
+        for (size_t i = 0; i < NumThreads; ++i) {
+            requests.emplace_back([&]() {
+                float previous = 0;
+                while (!done) {
+                    const auto model = reloadable.acquire();
+                    const auto version =
+                        static_cast<const VersionModel&>(*model).getVersion();
+
+                    /* versions never go backwards */
+                    CHECK(version >= previous);
+                    previous = version;
+                }
+            });
+        }
+
+        for (size_t i = 1; i <= NumReloads; ++i) {
+            const auto version = static_cast<float>(i);
+            REQUIRE(reloadable
+                        .reload([&instances, version]()
+                                    -> std::unique_ptr<edge::Model> {
+                            return std::make_unique<VersionModel>(
+                                version, 1, instances);
+                        })
+                        .get()
+                    == edge::STATUS::SUCCESS);
+        }
+
+        done = true;
+        for (auto& request : requests) {
+            request.join();
+        }
+
+        REQUIRE(reloadable.getVersion() == NumReloads + 1);
+    }
+
+    REQUIRE(instances == 0);
+}
@@ -0,0 +1,268 @@
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "edgerunner/edgerunner.hpp"
+#include "edgerunner/model.hpp"
+#include "edgerunner/options.hpp"
+#include "edgerunner/remote/protocol.hpp"
+#include "edgerunner/remote/server.hpp"
+#include "edgerunner/remote/sharedBuffer.hpp"
+#include "edgerunner/tensor.hpp"
+#include "fakes.hpp"
+
+namespace {
+
+/* a tensor whose data can be repointed to caller-owned memory */
+class BindableTensor : public VectorTensor {
+  public:
+    using VectorTensor::VectorTensor;
+
+    auto getDataPtr() -> void* override {
+        return m_bound != nullptr ? m_bound : VectorTensor::getDataPtr();
+    }
+
+    void bind(void* data) { m_bound = data; }
+
+  private:
+    void* m_bound = nullptr;
+};
+
+/* doubles its input, executions are counted */
+class DoubleModel : public StubModel {
+  public:
+    static constexpr size_t Size = 16;
+
+    explicit DoubleModel(const bool supportsBinding = false)
+        : StubModel("double")
+        , m_supportsBinding(supportsBinding) {
+        getInputs() = {std::make_shared<BindableTensor>(
+            std::vector<size_t> {1, Size}, "input")};
+        getOutputs() = {std::make_shared<BindableTensor>(
+            std::vector<size_t> {1, Size}, "output")};
+    }
+
+    auto bindInput(const size_t index, void* data, const size_t numBytes)
+        -> edge::STATUS override {
+        return bind(getInputs(), index, data, numBytes);
+    }
+
+    auto bindOutput(const size_t index, void* data, const size_t numBytes)
+        -> edge::STATUS override {
+        return bind(getOutputs(), index, data, numBytes);
+    }
+
+    auto execute() -> edge::STATUS override {
+        const auto input = getInput(0)->getTensorAs<float>();
+        auto output = getOutput(0)->getTensorAs<float>();
+        for (size_t i = 0; i < input.size(); ++i) {
+            output[i] = 2 * input[i];
+        }
+        ++numExecutions;
+        return edge::STATUS::SUCCESS;
+    }
+
+    size_t numExecutions = 0;
+    size_t numBinds = 0;
+
+  private:
+    auto bind(std::vector<std::shared_ptr<edge::Tensor>>& tensors,
+              const size_t index,
+              void* data,
+              const size_t numBytes) -> edge::STATUS {
+        if (!m_supportsBinding || index >= tensors.size()
+            || numBytes < tensors[index]->getTensorAs<uint8_t>().size())
+        {
+            return edge::STATUS::FAIL;
+        }
+
+        static_cast<BindableTensor&>(*tensors[index]).bind(data);
+        ++numBinds;
+        return edge::STATUS::SUCCESS;
+    }
+
+    bool m_supportsBinding;
+};
+
+}  // namespace
+
+TEST_CASE("Remote shared buffer", "[remote]") {
+    static constexpr size_t Size = 4096;
+
+    auto buffer = edge::remote::SharedBuffer::create("test", Size);
+    REQUIRE(buffer.data() != nullptr);
+    REQUIRE(buffer.size() == Size);
+    buffer.data()[0] = 42;
+
+    /* a second mapping of the same file sees the same memory */
+    auto mapped = edge::remote::SharedBuffer::fromFileDescriptor(
+        dup(buffer.getFileDescriptor()));
+    REQUIRE(mapped.size() == Size);
+    REQUIRE(mapped.data() != buffer.data());
+    REQUIRE(mapped.data()[0] == 42);
+
+    mapped.data()[1] = 7;
+    REQUIRE(buffer.data()[1] == 7);
+
+    REQUIRE(edge::remote::SharedBuffer::fromFileDescriptor(-1).data()
+            == nullptr);
+
+    /* the size is sealed, resizing would fault accesses of other processes */
+    REQUIRE(ftruncate(buffer.getFileDescriptor(), Size / 2) != 0);
+    REQUIRE(ftruncate(buffer.getFileDescriptor(), 2 * Size) != 0);
+
+    /* files which are not sealed are rejected */
+    const auto unsealed = memfd_create("unsealed", MFD_CLOEXEC);
+    REQUIRE(ftruncate(unsealed, Size) == 0);
+    REQUIRE(edge::remote::SharedBuffer::fromFileDescriptor(unsealed).data()
+            == nullptr);
+}
+
+TEST_CASE("Remote model description", "[remote]") {
+    edge::remote::ModelDescription description;
+    description.delegate = edge::DELEGATE::GPU;
+    description.precision = edge::TensorType::FLOAT16;
+    description.inputs = {{"input", edge::TensorType::UINT8, {1, 224, 224, 3}}};
+    description.outputs = {{"output", edge::TensorType::FLOAT32, {1, 1000}},
+                           {"", edge::TensorType::INT32, {}}};
+
+    const auto payload = edge::remote::encodeModelDescription(description);
+
+    edge::remote::ModelDescription decoded;
+    REQUIRE(edge::remote::decodeModelDescription(payload, decoded)
+            == edge::STATUS::SUCCESS);
+    REQUIRE(decoded.delegate == edge::DELEGATE::GPU);
+    REQUIRE(decoded.precision == edge::TensorType::FLOAT16);
+    REQUIRE(decoded.inputs.size() == 1);
+    REQUIRE(decoded.inputs[0].name == "input");
+    REQUIRE(decoded.inputs[0].dimensions
+            == std::vector<size_t> {1, 224, 224, 3});
+    REQUIRE(decoded.outputs.size() == 2);
+    REQUIRE(decoded.outputs[1].type == edge::TensorType::INT32);
+
+    const std::vector<uint8_t> truncated {payload.cbegin(), payload.cend() - 1};
+    REQUIRE(edge::remote::decodeModelDescription(truncated, decoded)
+            == edge::STATUS::FAIL);
+}
+
+TEST_CASE("Remote model", "[remote]") {
+    const auto socketPath = std::filesystem::temp_directory_path()
+        / ("edgerunner_test_" + std::to_string(getpid()) + ".sock");
+
+    auto served = std::make_shared<DoubleModel>();
+
+    edge::remote::Server server {socketPath};
+    REQUIRE(server.addModel("double.model", served) == edge::STATUS::SUCCESS);
+    REQUIRE(server.addModel("double.model", served) == edge::STATUS::FAIL);
+    REQUIRE(server.start() == edge::STATUS::SUCCESS);
+
+    edge::ModelOptions options;
+    options.remoteSocketPath = socketPath;
+
+    /* two clients share the served model with their own tensors */
+    auto first = edge::createModel("double.model", options);
+    auto second = edge::createModel("double.model", options);
+    REQUIRE(first != nullptr);
+    REQUIRE(second != nullptr);
+
+    REQUIRE(first->name() == "double");
+    REQUIRE(first->getNumInputs() == 1);
+    REQUIRE(first->getNumOutputs() == 1);
+    REQUIRE(first->getInput(0)->getName() == "input");
+    REQUIRE(first->getInput(0)->getDimensions()
+            == std::vector<size_t> {1, DoubleModel::Size});
+
+    auto firstInput = first->getInput(0)->getTensorAs<float>();
+    auto secondInput = second->getInput(0)->getTensorAs<float>();
+    REQUIRE(firstInput.size() == DoubleModel::Size);
+    for (size_t i = 0; i < DoubleModel::Size; ++i) {
+        firstInput[i] = static_cast<float>(i);
+        secondInput[i] = -static_cast<float>(i);
+    }
+
+    REQUIRE(first->execute() == edge::STATUS::SUCCESS);
+    REQUIRE(second->execute() == edge::STATUS::SUCCESS);
+
+    const auto firstOutput = first->getOutput(0)->getTensorAs<float>();
+    const auto secondOutput = second->getOutput(0)->getTensorAs<float>();
+    for (size_t i = 0; i < DoubleModel::Size; ++i) {
+        REQUIRE(firstOutput[i] == 2 * static_cast<float>(i));
+        REQUIRE(secondOutput[i] == -2 * static_cast<float>(i));
+    }
+    REQUIRE(served->numExecutions == 2);
+    REQUIRE(first->getMetrics().snapshot().executions == 1);
+
+    /* the backend cannot bind memory, tensors are copied */
+    REQUIRE(served->numBinds == 0);
+
+    /* clients cannot change the delegate of the shared model */
+    REQUIRE(first->applyDelegate(edge::DELEGATE::CPU) == edge::STATUS::SUCCESS);
+    REQUIRE(first->applyDelegate(edge::DELEGATE::NPU) == edge::STATUS::FAIL);
+    REQUIRE(first->getDelegate() == edge::DELEGATE::CPU);
+    REQUIRE(served->getDelegate() == edge::DELEGATE::CPU);
+
+    /* unknown models and servers fail to load, without a model directory
+     * only registered models are served */
+    REQUIRE(edge::createModel("missing.model", options) == nullptr);
+    REQUIRE(edge::createModel("models/tflite/mobilenet_v3_small.tflite",
+                              options)
+            == nullptr);
+
+    server.stop();
+    REQUIRE(first->execute() == edge::STATUS::FAIL);
+    REQUIRE(edge::createModel("double.model", options) == nullptr);
+}
+
+TEST_CASE("Remote model bound to shared memory", "[remote]") {
+    const auto socketPath = std::filesystem::temp_directory_path()
+        / ("edgerunner_test_" + std::to_string(getpid()) + "_bound.sock");
+
+    auto served = std::make_shared<DoubleModel>(true);
+
+    edge::remote::Server server {socketPath};
+    REQUIRE(server.addModel("double.model", served) == edge::STATUS::SUCCESS);
+    REQUIRE(server.start() == edge::STATUS::SUCCESS);
+
+    edge::ModelOptions options;
+    options.remoteSocketPath = socketPath;
+
+    auto first = edge::createModel("double.model", options);
+    auto second = edge::createModel("double.model", options);
+    REQUIRE(first != nullptr);
+    REQUIRE(second != nullptr);
+
+    const auto execute = [](edge::Model& model, const float scale) {
+        auto input = model.getInput(0)->getTensorAs<float>();
+        for (size_t i = 0; i < input.size(); ++i) {
+            input[i] = scale * static_cast<float>(i);
+        }
+
+        REQUIRE(model.execute() == edge::STATUS::SUCCESS);
+
+        const auto output = model.getOutput(0)->getTensorAs<float>();
+        for (size_t i = 0; i < output.size(); ++i) {
+            REQUIRE(output[i] == 2 * scale * static_cast<float>(i));
+        }
+    };
+
+    /* the memory of a client is bound once, until another client executes */
+    execute(*first, 1.0F);
+    execute(*first, 2.0F);
+    REQUIRE(served->numBinds == 2);
+
+    execute(*second, -1.0F);
+    REQUIRE(served->numBinds == 4);
+
+    execute(*first, 3.0F);
+    REQUIRE(served->numBinds == 6);
+    REQUIRE(served->numExecutions == 4);
+
+    server.stop();
+}
@@ -0,0 +1,138 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "edgerunner/model.hpp"
+#include "edgerunner/scheduler.hpp"
+#include "fakes.hpp"
+
+namespace {
+
+/* a model that takes a fixed time to execute and logs its executions */
+class SleepModel : public StubModel {
+  public:
+    SleepModel(const std::string& name,
+               std::chrono::milliseconds duration,
+               std::vector<std::string>& log,
+               std::mutex& logMutex)
+        : StubModel(name)
+        , m_duration(duration)
+        , m_log(log)
+        , m_logMutex(logMutex) {}
+
+    auto execute() -> edge::STATUS override {
+        {
+            const std::lock_guard<std::mutex> lock(m_logMutex);
+            m_log.push_back(name());
+        }
+        std::this_thread::sleep_for(m_duration);
+        return edge::STATUS::SUCCESS;
+    }
+
+  private:
+    std::chrono::milliseconds m_duration;
+    std::vector<std::string>& m_log;
+    std::mutex& m_logMutex;
+};
+
+}  // namespace
+
+TEST_CASE("Scheduler earliest deadline first", "[scheduler]") {
+    using Clock = edge::Scheduler::Clock;
+    static constexpr std::chrono::milliseconds Duration {20};
+
+    std::vector<std::string> log;
+    std::mutex logMutex;
+    SleepModel blocker {"blocker", Duration, log, logMutex};
+    SleepModel bulk {"bulk", Duration, log, logMutex};
+    SleepModel urgent {"urgent", Duration, log, logMutex};
+    SleepModel expired {"expired", Duration, log, logMutex};
+
+    edge::Scheduler scheduler;
+
+    /* occupy the single CPU worker while the other requests queue up */
+    auto blockerFuture = scheduler.submit(blocker, edge::PRIORITY::LOW);
+    while (scheduler.getNumQueued() != 0) {
+        std::this_thread::yield();
+    }
+
+    const auto now = Clock::now();
+    auto bulkFuture = scheduler.submit(bulk, edge::PRIORITY::LOW);
+    auto expiredFuture = scheduler.submit(
+        expired, edge::PRIORITY::HIGH, now + std::chrono::milliseconds {1});
+    auto urgentFuture = scheduler.submit(
+        urgent, edge::PRIORITY::HIGH, now + std::chrono::seconds {10});
+
+    REQUIRE(blockerFuture.get() == edge::STATUS::SUCCESS);
+    REQUIRE(bulkFuture.get() == edge::STATUS::SUCCESS);
+    REQUIRE(urgentFuture.get() == edge::STATUS::SUCCESS);
+    REQUIRE(expiredFuture.get() == edge::STATUS::FAIL);
+
+    /* the urgent request overtakes the bulk one, the expired one is dropped */
+    const std::vector<std::string> expected {"blocker", "urgent", "bulk"};
+    REQUIRE(log == expected);
+
+    const auto highStats = scheduler.getStats(edge::PRIORITY::HIGH);
+    REQUIRE(highStats.executed == 1);
+    REQUIRE(highStats.dropped == 1);
+    REQUIRE(highStats.queueDelay.count == 1);
+
+    const auto lowStats = scheduler.getStats(edge::PRIORITY::LOW);
+    REQUIRE(lowStats.executed == 2);
+    REQUIRE(lowStats.dropped == 0);
+    REQUIRE(lowStats.queueDelay.max >= lowStats.queueDelay.min);
+
+    scheduler.resetStats();
+    REQUIRE(scheduler.getStats(edge::PRIORITY::LOW).executed == 0);
+}
+
+TEST_CASE("Scheduler serializes requests of a model", "[scheduler]") {
+    static constexpr size_t NumRequests = 8;
+    static constexpr std::chrono::milliseconds Duration {2};
+
+    std::vector<std::string> log;
+    std::mutex logMutex;
+    SleepModel model {"model", Duration, log, logMutex};
+
+    edge::SchedulerOptions options;
+    options.cpuWorkers = 4;
+    edge::Scheduler scheduler {options};
+
+    size_t numActive = 0;
+    size_t maxActive = 0;
+    std::vector<std::future<edge::STATUS>> futures;
+    for (size_t i = 0; i < NumRequests; ++i) {
+        edge::SchedulerRequest request;
+        request.model = &model;
+        request.prepare = [&](edge::Model& /*model*/) {
+            maxActive = std::max(maxActive, ++numActive);
+        };
+        request.complete = [&](edge::Model& /*model*/, edge::STATUS status) {
+            REQUIRE(status == edge::STATUS::SUCCESS);
+            --numActive;
+        };
+        futures.push_back(scheduler.submit(std::move(request)));
+    }
+
+    for (auto& future : futures) {
+        REQUIRE(future.get() == edge::STATUS::SUCCESS);
+    }
+    REQUIRE(log.size() == NumRequests);
+    REQUIRE(maxActive == 1);
+
+    REQUIRE(scheduler.submit({}).get() == edge::STATUS::FAIL);
+
+    edge::SchedulerOptions noCpuOptions;
+    noCpuOptions.cpuWorkers = 0;
+    edge::Scheduler noCpuScheduler {noCpuOptions};
+    REQUIRE(noCpuScheduler.submit(model, edge::PRIORITY::NORMAL).get()
+            == edge::STATUS::FAIL);
+}
@@ -0,0 +1,62 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "edgerunner/arenaGroup.hpp"
+#include "edgerunner/edgerunner.hpp"
+#include "edgerunner/model.hpp"
+#include "edgerunner/options.hpp"
+#include "utils.hpp"
+
+TEST_CASE("Tflite arena group", "[tflite][memory]") {
+    const std::string modelPath = "models/tflite/mobilenet_v3_small.tflite";
+
+    auto referenceModel = edge::createModel(modelPath);
+    REQUIRE(referenceModel != nullptr);
+
+    edge::ModelOptions options;
+    options.arenaGroup = std::make_shared<edge::ArenaGroup>();
+
+    auto model1 = edge::createModel(modelPath, options);
+    REQUIRE(model1 != nullptr);
+
+    auto model2 = edge::createModel(modelPath, options);
+    REQUIRE(model2 != nullptr);
+
+    /* the last allocated member holds the scratch memory */
+    REQUIRE(model1->getMemoryStats().nonPersistentArenaBytes == 0);
+    REQUIRE(model2->getMemoryStats().nonPersistentArenaBytes > 0);
+    REQUIRE(model1->getMemoryStats().ioBytes > 0);
+
+    auto referenceInput = referenceModel->getInput(0)->getTensorAs<float>();
+    auto input1 = model1->getInput(0)->getTensorAs<float>();
+    auto input2 = model2->getInput(0)->getTensorAs<float>();
+    std::fill(referenceInput.begin(), referenceInput.end(), 0.5F);
+    std::fill(input1.begin(), input1.end(), 0.5F);
+    std::fill(input2.begin(), input2.end(), 0.25F);
+
+    REQUIRE(referenceModel->execute() == edge::STATUS::SUCCESS);
+
+    /* inputs survive the scratch memory switching between members */
+    REQUIRE(model1->execute() == edge::STATUS::SUCCESS);
+    REQUIRE(model2->execute() == edge::STATUS::SUCCESS);
+    REQUIRE(model1->execute() == edge::STATUS::SUCCESS);
+
+    REQUIRE(model1->getMemoryStats().nonPersistentArenaBytes > 0);
+    REQUIRE(model2->getMemoryStats().nonPersistentArenaBytes == 0);
+
+    const auto referenceOutput =
+        referenceModel->getOutput(0)->getTensorAs<float>();
+    const auto output1 = model1->getOutput(0)->getTensorAs<float>();
+    REQUIRE(meanSquaredError(referenceOutput, output1) == 0.0F);
+
+    /* outputs survive as well */
+    const auto output2 = model2->getOutput(0)->getTensorAs<float>();
+    REQUIRE(meanSquaredError(referenceOutput, output2) > 0.0F);
+
+    /* members can leave the group at any time */
+    model1.reset();
+    REQUIRE(model2->execute() == edge::STATUS::SUCCESS);
+}
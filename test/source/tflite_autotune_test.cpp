@@ -0,0 +1,49 @@
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "edgerunner/autotune.hpp"
+#include "edgerunner/edgerunner.hpp"
+#include "edgerunner/model.hpp"
+
+TEST_CASE("Tflite autotune", "[tflite][autotune]") {
+    const std::string modelPath = "models/tflite/mobilenet_v3_small.tflite";
+    const auto cachePath =
+        std::filesystem::temp_directory_path() / "edgerunner_tflite_autotune.txt";
+    std::filesystem::remove(cachePath);
+
+    auto model = edge::createModel(modelPath);
+    REQUIRE(model != nullptr);
+    REQUIRE(model->getModelHash() != 0);
+
+    REQUIRE(model->setNumThreads(2) == edge::STATUS::SUCCESS);
+    REQUIRE(model->getNumThreads() == 2);
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+
+    edge::AutotuneOptions options;
+    options.cachePath = cachePath;
+    options.threadCounts = {1, 2};
+    options.warmupRuns = 1;
+    options.numRuns = 3;
+
+    REQUIRE(model->autotune(options) == edge::STATUS::SUCCESS);
+    REQUIRE(std::filesystem::exists(cachePath));
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+
+    const auto delegate = model->getDelegate();
+    const auto numThreads = model->getNumThreads();
+
+    /* a second model of the same file reuses the cached decision */
+    auto cachedModel = edge::createModel(modelPath);
+    REQUIRE(cachedModel != nullptr);
+    REQUIRE(cachedModel->getModelHash() == model->getModelHash());
+    REQUIRE(cachedModel->autotune(options) == edge::STATUS::SUCCESS);
+    REQUIRE(cachedModel->getDelegate() == delegate);
+    REQUIRE(cachedModel->getNumThreads() == numThreads);
+    REQUIRE(cachedModel->execute() == edge::STATUS::SUCCESS);
+
+    std::filesystem::remove(cachePath);
+}
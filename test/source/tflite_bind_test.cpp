@@ -0,0 +1,64 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "edgerunner/alignedBuffer.hpp"
+#include "edgerunner/edgerunner.hpp"
+#include "edgerunner/model.hpp"
+
+TEST_CASE("Tflite bind input and output", "[tflite][bind]") {
+    const std::string modelPath = "models/tflite/mobilenet_v3_small.tflite";
+
+    auto reference = edge::createModel(modelPath);
+    auto model = edge::createModel(modelPath);
+    REQUIRE(reference != nullptr);
+    REQUIRE(model != nullptr);
+
+    auto referenceInput = reference->getInput(0)->getTensorAs<float>();
+    for (size_t i = 0; i < referenceInput.size(); ++i) {
+        referenceInput[i] = static_cast<float>(i % 255) / 255.0F;
+    }
+    REQUIRE(reference->execute() == edge::STATUS::SUCCESS);
+
+    edge::AlignedBuffer input {referenceInput.size() * sizeof(float)};
+    edge::AlignedBuffer output {
+        reference->getOutput(0)->getTensorAs<float>().size() * sizeof(float)};
+
+    REQUIRE(model->bindInput(0, input.data(), input.size())
+            == edge::STATUS::SUCCESS);
+    REQUIRE(model->bindOutput(0, output.data(), output.size())
+            == edge::STATUS::SUCCESS);
+
+    /* the model tensors are the bound memory */
+    REQUIRE(model->getInput(0)->getTensorAs<uint8_t>().data() == input.data());
+    REQUIRE(model->getOutput(0)->getTensorAs<uint8_t>().data()
+            == output.data());
+
+    auto* inputData = reinterpret_cast<float*>(input.data());  // NOLINT
+    for (size_t i = 0; i < referenceInput.size(); ++i) {
+        inputData[i] = referenceInput[i];  // NOLINT
+    }
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+
+    const auto referenceOutput = reference->getOutput(0)->getTensorAs<float>();
+    const auto* outputData = reinterpret_cast<float*>(output.data());  // NOLINT
+    for (size_t i = 0; i < referenceOutput.size(); ++i) {
+        REQUIRE(outputData[i] == referenceOutput[i]);  // NOLINT
+    }
+
+    /* bindings are kept when the interpreter is rebuilt */
+    REQUIRE(model->applyDelegate(edge::DELEGATE::CPU) == edge::STATUS::SUCCESS);
+    REQUIRE(model->getInput(0)->getTensorAs<uint8_t>().data() == input.data());
+
+    /* too small or misaligned memory is rejected */
+    REQUIRE(model->bindInput(0, input.data(), input.size() - 1)
+            == edge::STATUS::FAIL);
+    REQUIRE(model->bindInput(0, input.data() + 1, input.size() - 1)
+            == edge::STATUS::FAIL);
+    REQUIRE(model->bindOutput(1, output.data(), output.size())
+            == edge::STATUS::FAIL);
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+}
@@ -0,0 +1,59 @@
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "edgerunner/bundle.hpp"
+#include "edgerunner/edgerunner.hpp"
+#include "edgerunner/model.hpp"
+#include "edgerunner/tensor.hpp"
+#include "tflite_utils.hpp"
+
+TEST_CASE("Tflite bundle", "[tflite][bundle]") {
+    const std::string modelPath = "models/tflite/mobilenet_v3_small.tflite";
+    const auto bundlePath =
+        std::filesystem::temp_directory_path() / "mobilenet_v3_small.edgerunner";
+
+    edge::BundleWriter writer;
+    REQUIRE(writer.addFile(edge::SECTION::TFLITE, modelPath)
+            == edge::STATUS::SUCCESS);
+    REQUIRE(writer.addFile(edge::SECTION::LABELS,
+                           "models/common/imagenet_labels.txt")
+            == edge::STATUS::SUCCESS);
+    REQUIRE(writer.write(bundlePath) == edge::STATUS::SUCCESS);
+
+    auto model = edge::createModel(modelPath);
+    REQUIRE(model != nullptr);
+    REQUIRE(model->getBundle() == nullptr);
+    const auto reference = executeModel(*model);
+
+    auto bundled = edge::createModel(bundlePath);
+    REQUIRE(bundled != nullptr);
+    REQUIRE(bundled->name() == "mobilenet_v3_small");
+    REQUIRE(bundled->getModelHash() == model->getModelHash());
+    REQUIRE(executeModel(*bundled) == reference);
+
+    /* labels are read from the mapping of the model */
+    const auto& bundle = bundled->getBundle();
+    REQUIRE(bundle != nullptr);
+    /* background and the 1000 imagenet classes */
+    static constexpr size_t NumLabels = 1001;
+    const auto labels = bundle->getLabels();
+    REQUIRE(labels.size() == NumLabels);
+    REQUIRE(labels.front() == "background");
+
+    /* bundles without a supported model */
+    edge::BundleWriter labelsOnly;
+    REQUIRE(labelsOnly.addFile(edge::SECTION::LABELS,
+                               "models/common/imagenet_labels.txt")
+            == edge::STATUS::SUCCESS);
+    REQUIRE(labelsOnly.write(bundlePath) == edge::STATUS::SUCCESS);
+    REQUIRE(edge::createModel(bundlePath) == nullptr);
+
+    /* the model keeps the mapping of the replaced bundle */
+    REQUIRE(executeModel(*bundled) == reference);
+
+    std::filesystem::remove(bundlePath);
+}
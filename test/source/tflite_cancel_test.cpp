@@ -0,0 +1,57 @@
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "edgerunner/edgerunner.hpp"
+#include "edgerunner/model.hpp"
+
+TEST_CASE("Tflite execution cancellation", "[tflite][cancel]") {
+    const std::string modelPath = "models/tflite/mobilenet_v3_small.tflite";
+
+    auto model = edge::createModel(modelPath);
+    REQUIRE(model != nullptr);
+
+    auto input = model->getInput(0)->getTensorAs<float>();
+    for (size_t i = 0; i < input.size(); ++i) {
+        input[i] = static_cast<float>(i % 255) / 255.0F;
+    }
+
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+    const auto output = model->getOutput(0)->getTensorAs<float>();
+    const std::vector<float> reference(output.cbegin(), output.cend());
+
+    /* cancel() has no effect outside of an execution */
+    REQUIRE(model->cancel() == edge::STATUS::SUCCESS);
+
+    SECTION("Timeout") {
+        REQUIRE(model->execute(std::chrono::microseconds {1})
+                == edge::STATUS::FAIL);
+        REQUIRE(model->execute(std::chrono::seconds {60})
+                == edge::STATUS::SUCCESS);
+    }
+
+    SECTION("Cancel from another thread") {
+        std::atomic<bool> done {false};
+        std::thread canceller {[&]() {
+            while (!done) {
+                model->cancel();
+            }
+        }};
+
+        const auto status = model->execute();
+        done = true;
+        canceller.join();
+
+        REQUIRE(status == edge::STATUS::FAIL);
+    }
+
+    /* the model remains usable after a cancelled execution */
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+    const auto retried = model->getOutput(0)->getTensorAs<float>();
+    REQUIRE(std::vector<float>(retried.cbegin(), retried.cend()) == reference);
+}
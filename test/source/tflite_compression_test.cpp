@@ -0,0 +1,180 @@
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <lz4frame.h>
+#include <zstd.h>
+
+#ifdef __linux__
+#    include <fcntl.h>
+#    include <unistd.h>
+#endif
+
+#include "edgerunner/edgerunner.hpp"
+#include "edgerunner/model.hpp"
+#include "edgerunner/tensor.hpp"
+#include "tflite_utils.hpp"
+
+namespace {
+
+auto readFile(const std::filesystem::path& path) -> std::vector<char> {
+    std::ifstream file(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file),
+            std::istreambuf_iterator<char>()};
+}
+
+void writeFile(const std::filesystem::path& path,
+               const std::vector<char>& bytes) {
+    std::ofstream file(path, std::ios::binary);
+    file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+auto compressZstd(const std::vector<char>& bytes) -> std::vector<char> {
+    std::vector<char> compressed(ZSTD_compressBound(bytes.size()));
+    const auto size = ZSTD_compress(compressed.data(),
+                                    compressed.size(),
+                                    bytes.data(),
+                                    bytes.size(),
+                                    ZSTD_CLEVEL_DEFAULT);
+    REQUIRE(ZSTD_isError(size) == 0U);
+    compressed.resize(size);
+    return compressed;
+}
+
+auto compressLz4(const std::vector<char>& bytes) -> std::vector<char> {
+    LZ4F_preferences_t preferences {};
+    preferences.frameInfo.contentSize = bytes.size();
+
+    std::vector<char> compressed(
+        LZ4F_compressFrameBound(bytes.size(), &preferences));
+    const auto size = LZ4F_compressFrame(compressed.data(),
+                                         compressed.size(),
+                                         bytes.data(),
+                                         bytes.size(),
+                                         &preferences);
+    REQUIRE(LZ4F_isError(size) == 0U);
+    compressed.resize(size);
+    return compressed;
+}
+
+/* drops the file from the page cache, such that loads read from storage */
+void evict(const std::filesystem::path& path) {
+#ifdef __linux__
+    const auto fd = open(path.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        close(fd);
+    }
+#else
+    static_cast<void>(path);
+#endif
+}
+
+/* unique per test run, such that concurrent runs do not share files */
+auto createTemporaryDirectory() -> std::filesystem::path {
+#ifdef __linux__
+    const auto id = std::to_string(getpid());
+#else
+    const auto id = std::to_string(std::random_device {}());
+#endif
+
+    auto directory = std::filesystem::temp_directory_path()
+        / ("edgerunner_compression_" + id);
+    std::filesystem::create_directories(directory);
+    return directory;
+}
+
+/* the model compressed with zstd and with lz4, in a temporary directory */
+struct CompressedModels {
+    std::filesystem::path directory = createTemporaryDirectory();
+    std::filesystem::path zstdPath =
+        directory / "mobilenet_v3_small.tflite.zst";
+    std::filesystem::path lz4Path = directory / "mobilenet_v3_small.tflite.lz4";
+
+    explicit CompressedModels(const std::filesystem::path& modelPath) {
+        const auto bytes = readFile(modelPath);
+        REQUIRE(!bytes.empty());
+        writeFile(zstdPath, compressZstd(bytes));
+        writeFile(lz4Path, compressLz4(bytes));
+    }
+
+    CompressedModels(const CompressedModels&) = delete;
+    CompressedModels(CompressedModels&&) = delete;
+    auto operator=(const CompressedModels&) -> CompressedModels& = delete;
+    auto operator=(CompressedModels&&) -> CompressedModels& = delete;
+
+    ~CompressedModels() {
+        std::error_code errorCode;
+        std::filesystem::remove_all(directory, errorCode);
+    }
+};
+
+}  // namespace
+
+TEST_CASE("Tflite compressed models", "[tflite][compression]") {
+    const std::filesystem::path modelPath =
+        "models/tflite/mobilenet_v3_small.tflite";
+    const CompressedModels compressedModels {modelPath};
+
+    auto model = edge::createModel(modelPath);
+    REQUIRE(model != nullptr);
+    const auto reference = executeModel(*model);
+
+    for (const auto& path :
+         {compressedModels.zstdPath, compressedModels.lz4Path})
+    {
+        auto compressed = edge::createModel(path);
+        REQUIRE(compressed != nullptr);
+        REQUIRE(compressed->name() == "mobilenet_v3_small");
+        REQUIRE(compressed->getModelHash() == model->getModelHash());
+        REQUIRE(executeModel(*compressed) == reference);
+    }
+
+    /* truncated files fail to load */
+    const auto compressed = readFile(compressedModels.zstdPath);
+    const auto truncatedPath =
+        compressedModels.directory / "truncated.tflite.zst";
+    writeFile(truncatedPath,
+              {compressed.cbegin(),
+               std::next(compressed.cbegin(),
+                         static_cast<ptrdiff_t>(compressed.size() / 2))});
+    REQUIRE(edge::createModel(truncatedPath) == nullptr);
+}
+
+TEST_CASE("Tflite compressed model cold start",
+          "[.][benchmark][tflite][compression]") {
+    const std::filesystem::path modelPath =
+        "models/tflite/mobilenet_v3_small.tflite";
+    const CompressedModels compressedModels {modelPath};
+
+    /* uncompressed models are mapped and paged in lazily, the first
+     * execution reads all weights, such that every variant reads the whole
+     * model from storage */
+    const auto coldStart = [](const std::filesystem::path& path) {
+        evict(path);
+        auto model = edge::createModel(path);
+        REQUIRE(model != nullptr);
+        REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+        return model;
+    };
+
+    BENCHMARK("cold start uncompressed") {
+        return coldStart(modelPath);
+    };
+
+    BENCHMARK("cold start zstd") {
+        return coldStart(compressedModels.zstdPath);
+    };
+
+    BENCHMARK("cold start lz4") {
+        return coldStart(compressedModels.lz4Path);
+    };
+}
@@ -77,3 +77,46 @@ TEST_CASE("Tflite GPU runtime", "[tflite][gpu]") {
     CAPTURE(mse);
     REQUIRE(mse < MseThreshold);
 }
+
+TEST_CASE("Tflite GPU prepared delegate", "[tflite][gpu][prepare]") {
+    const std::string modelPath = "models/tflite/mobilenet_v3_small.tflite";
+
+    auto model = edge::createModel(modelPath);
+    REQUIRE(model != nullptr);
+
+    auto input = model->getInput(0);
+    auto inputData = input->getTensorAs<float>();
+    std::fill(inputData.begin(), inputData.end(), 0);
+
+    REQUIRE(model->prepareDelegates({edge::DELEGATE::GPU})
+            == edge::STATUS::SUCCESS);
+    REQUIRE(model->getDelegate() == edge::DELEGATE::CPU);
+
+    /* tensors obtained after preparing remain valid across switches */
+    input = model->getInput(0);
+    const auto* preparedData = input->getTensorAs<float>().data();
+
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+    const auto cpuOutput = model->getOutput(0)->getTensorAs<float>();
+    const std::vector<float> cpuResult(cpuOutput.cbegin(), cpuOutput.cend());
+
+    REQUIRE(model->applyDelegate(edge::DELEGATE::GPU) == edge::STATUS::SUCCESS);
+    REQUIRE(model->getDelegate() == edge::DELEGATE::GPU);
+    REQUIRE(model->getInput(0)->getTensorAs<float>().data() == preparedData);
+
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+
+    const auto mse = meanSquaredError(
+        cpuResult, model->getOutput(0)->getTensorAs<float>());
+    CAPTURE(mse);
+    REQUIRE(mse < MseThreshold);
+
+    BENCHMARK("switch") {
+        model->applyDelegate(edge::DELEGATE::CPU);
+        return model->applyDelegate(edge::DELEGATE::GPU);
+    };
+
+    REQUIRE(model->applyDelegate(edge::DELEGATE::CPU) == edge::STATUS::SUCCESS);
+    REQUIRE(model->getDelegate() == edge::DELEGATE::CPU);
+    REQUIRE(input->getTensorAs<float>().data() == preparedData);
+}
@@ -0,0 +1,76 @@
+#include <cstddef>
+#include <fstream>
+#include <string>
+
+#include <catch2/catch_message.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "edgerunner/edgerunner.hpp"
+#include "edgerunner/memoryStats.hpp"
+#include "edgerunner/model.hpp"
+
+#ifdef __linux__
+#    include <unistd.h>
+#endif
+
+namespace {
+
+/* resident set size of the current process, 0 if unavailable */
+auto getResidentBytes() -> size_t {
+#ifdef __linux__
+    std::ifstream statm("/proc/self/statm");
+
+    size_t totalPages = 0;
+    size_t residentPages = 0;
+    if (!(statm >> totalPages >> residentPages)) {
+        return 0;
+    }
+
+    return residentPages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#else
+    return 0;
+#endif
+}
+
+}  // namespace
+
+TEST_CASE("Tflite memory stats", "[tflite][memory]") {
+    const std::string modelPath = "models/tflite/mobilenet_v3_small.tflite";
+
+    const auto residentBefore = getResidentBytes();
+
+    auto model = edge::createModel(modelPath);
+    REQUIRE(model != nullptr);
+
+    /* touch the whole model and arenas so they are resident */
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+
+    const auto residentAfter = getResidentBytes();
+
+    const auto stats = model->getMemoryStats();
+    REQUIRE(stats.modelBytes > 0);
+    REQUIRE(stats.persistentArenaBytes > 0);
+    REQUIRE(stats.nonPersistentArenaBytes > 0);
+    REQUIRE(stats.delegateBytes == 0);
+    REQUIRE(stats.ioBytes == 0);
+    REQUIRE(stats.getTotalBytes()
+            == stats.modelBytes + stats.persistentArenaBytes
+                + stats.nonPersistentArenaBytes + stats.dynamicBytes);
+
+    /* the resident set size is only available on Linux */
+    if (residentBefore == 0) {
+        return;
+    }
+
+    /* the model and arenas are resident once executed */
+    REQUIRE(residentAfter > residentBefore);
+
+    const auto residentDelta = residentAfter - residentBefore;
+    INFO("resident delta: " << residentDelta
+                            << ", reported: " << stats.getTotalBytes());
+
+    /* allow for allocator slack and interpreter bookkeeping */
+    static constexpr size_t OverheadBytes = size_t {32} << 20U;
+    REQUIRE(residentDelta >= stats.getTotalBytes() / 2);
+    REQUIRE(residentDelta <= stats.getTotalBytes() * 2 + OverheadBytes);
+}
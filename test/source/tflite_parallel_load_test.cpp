@@ -0,0 +1,43 @@
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "edgerunner/edgerunner.hpp"
+#include "edgerunner/model.hpp"
+
+TEST_CASE("Tflite asynchronous model creation", "[tflite][load]") {
+    const std::string modelPath = "models/tflite/mobilenet_v3_small.tflite";
+
+    auto future = edge::createModelAsync(modelPath);
+    auto model = future.get();
+    REQUIRE(model != nullptr);
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+
+    auto badFuture = edge::createModelAsync("test.tflite");
+    REQUIRE(badFuture.get() == nullptr);
+}
+
+TEST_CASE("Tflite parallel model creation", "[tflite][load]") {
+    static constexpr size_t NumModels = 6;
+    static constexpr size_t MaxThreads = 3;
+
+    std::vector<std::filesystem::path> modelPaths(
+        NumModels, "models/tflite/mobilenet_v3_small.tflite");
+    modelPaths.emplace_back("test.tflite");
+
+    const auto models = edge::createModels(modelPaths, {}, MaxThreads);
+    REQUIRE(models.size() == modelPaths.size());
+
+    /* models keep the order of their paths, failures are nullptr */
+    for (size_t i = 0; i < NumModels; ++i) {
+        REQUIRE(models[i] != nullptr);
+        REQUIRE(models[i]->name() == "mobilenet_v3_small");
+        REQUIRE(models[i]->execute() == edge::STATUS::SUCCESS);
+    }
+    REQUIRE(models.back() == nullptr);
+
+    REQUIRE(edge::createModels({}).empty());
+}
@@ -0,0 +1,76 @@
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "edgerunner/edgerunner.hpp"
+#include "edgerunner/model.hpp"
+#include "edgerunner/options.hpp"
+#include "edgerunner/tensor.hpp"
+#include "tflite_utils.hpp"
+
+TEST_CASE("Tflite precision selection", "[tflite][precision]") {
+    const std::string modelPath = "models/tflite/mobilenet_v3_small.tflite";
+
+    auto model = edge::createModel(modelPath);
+    REQUIRE(model != nullptr);
+
+    /* detected from the float inputs */
+    REQUIRE(model->getPrecision() == edge::TensorType::FLOAT16);
+    const auto reference = executeModel(*model);
+
+    /* fp32 keeps the default kernels */
+    REQUIRE(model->applyPrecision(edge::TensorType::FLOAT32)
+            == edge::STATUS::SUCCESS);
+    REQUIRE(model->getPrecision() == edge::TensorType::FLOAT32);
+    REQUIRE(executeModel(*model) == reference);
+
+    REQUIRE(model->applyPrecision(edge::TensorType::INT32)
+            == edge::STATUS::FAIL);
+    REQUIRE(model->getPrecision() == edge::TensorType::FLOAT32);
+
+    /* integer precisions require a quantized model */
+    REQUIRE(model->applyPrecision(edge::TensorType::INT8)
+            == edge::STATUS::FAIL);
+    REQUIRE(model->applyPrecision(edge::TensorType::UINT8)
+            == edge::STATUS::FAIL);
+    REQUIRE(model->getPrecision() == edge::TensorType::FLOAT32);
+    REQUIRE(executeModel(*model) == reference);
+
+    /* fp16 inference depends on hardware support */
+    if (model->applyPrecision(edge::TensorType::FLOAT16)
+        == edge::STATUS::SUCCESS)
+    {
+        REQUIRE(model->getPrecision() == edge::TensorType::FLOAT16);
+
+        const auto relaxed = executeModel(*model);
+        REQUIRE(relaxed.size() == reference.size());
+        for (size_t i = 0; i < relaxed.size(); ++i) {
+            static constexpr float Tolerance = 1e-2F;
+            REQUIRE(std::abs(relaxed[i] - reference[i]) < Tolerance);
+        }
+    } else {
+        REQUIRE(model->getPrecision() == edge::TensorType::FLOAT32);
+        REQUIRE(executeModel(*model) == reference);
+    }
+}
+
+TEST_CASE("Tflite precision creation option", "[tflite][precision]") {
+    const std::string modelPath = "models/tflite/mobilenet_v3_small.tflite";
+
+    edge::ModelOptions options;
+    options.precision = edge::TensorType::FLOAT32;
+
+    auto model = edge::createModel(modelPath, options);
+    REQUIRE(model != nullptr);
+    REQUIRE(model->getPrecision() == edge::TensorType::FLOAT32);
+
+    options.precision = edge::TensorType::INT32;
+    REQUIRE(edge::createModel(modelPath, options) == nullptr);
+
+    /* the model is not quantized */
+    options.precision = edge::TensorType::UINT8;
+    REQUIRE(edge::createModel(modelPath, options) == nullptr);
+}
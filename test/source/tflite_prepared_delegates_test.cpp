@@ -0,0 +1,73 @@
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "edgerunner/edgerunner.hpp"
+#include "edgerunner/model.hpp"
+#include "edgerunner/tensor.hpp"
+
+TEST_CASE("Tflite prepared delegates", "[tflite][prepare]") {
+    const std::string modelPath = "models/tflite/mobilenet_v3_small.tflite";
+
+    auto model = edge::createModel(modelPath);
+    REQUIRE(model != nullptr);
+
+    auto input = model->getInput(0)->getTensorAs<float>();
+    for (size_t i = 0; i < input.size(); ++i) {
+        input[i] = static_cast<float>(i % 255) / 255.0F;
+    }
+
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+    const auto output = model->getOutput(0)->getTensorAs<float>();
+    const std::vector<float> reference(output.cbegin(), output.cend());
+
+    REQUIRE(model->prepareDelegates({edge::DELEGATE::CPU})
+            == edge::STATUS::SUCCESS);
+    REQUIRE(model->getDelegate() == edge::DELEGATE::CPU);
+
+    /* inputs are kept in the stable buffers */
+    auto preparedInput = model->getInput(0)->getTensorAs<float>();
+    for (size_t i = 0; i < preparedInput.size(); ++i) {
+        REQUIRE(preparedInput[i] == static_cast<float>(i % 255) / 255.0F);
+    }
+
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+    const auto preparedOutput = model->getOutput(0)->getTensorAs<float>();
+    REQUIRE(std::vector<float>(preparedOutput.cbegin(), preparedOutput.cend())
+            == reference);
+
+    /* preparing again keeps the stable buffers */
+    const auto* inputData = preparedInput.data();
+    REQUIRE(model->prepareDelegates({edge::DELEGATE::CPU})
+            == edge::STATUS::SUCCESS);
+    REQUIRE(model->getInput(0)->getTensorAs<float>().data() == inputData);
+
+    /* tensors of prepared interpreters cannot be resized */
+    REQUIRE(model->resizeInput(0, {1, 224, 224, 3}) == edge::STATUS::FAIL);
+
+    /* rebuilding the interpreter releases the prepared interpreters */
+    REQUIRE(model->applyDelegate(edge::DELEGATE::CPU) == edge::STATUS::SUCCESS);
+    REQUIRE(model->getInput(0)->getTensorAs<float>().data() == inputData);
+    REQUIRE(model->resizeInput(0, {1, 224, 224, 3}) == edge::STATUS::SUCCESS);
+}
+
+TEST_CASE("Tflite prepared delegates failure", "[tflite][prepare]") {
+    const std::string modelPath = "models/tflite/mobilenet_v3_small.tflite";
+
+    auto model = edge::createModel(modelPath);
+    REQUIRE(model != nullptr);
+
+    const auto status = model->prepareDelegates(
+        {edge::DELEGATE::CPU, edge::DELEGATE::GPU, edge::DELEGATE::NPU});
+
+    /* the current interpreter is unaffected whether delegates are available */
+    REQUIRE(model->getDelegate() == edge::DELEGATE::CPU);
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+
+    if (status == edge::STATUS::FAIL) {
+        REQUIRE(model->resizeInput(0, {1, 224, 224, 3})
+                == edge::STATUS::SUCCESS);
+    }
+}
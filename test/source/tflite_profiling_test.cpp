@@ -0,0 +1,86 @@
+#include <algorithm>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "edgerunner/edgerunner.hpp"
+#include "edgerunner/model.hpp"
+#include "edgerunner/options.hpp"
+#include "edgerunner/profiling.hpp"
+
+TEST_CASE("Tflite profiling", "[tflite][profiling]") {
+    const std::string modelPath = "models/tflite/mobilenet_v3_small.tflite";
+
+    auto model = edge::createModel(modelPath);
+    REQUIRE(model != nullptr);
+    REQUIRE(model->getProfilingLevel() == edge::PROFILING_LEVEL::OFF);
+
+    /* no events are collected unless profiling is enabled */
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+    REQUIRE(model->getProfilingEvents().empty());
+
+    REQUIRE(model->enableProfiling(edge::PROFILING_LEVEL::BASIC)
+            == edge::STATUS::SUCCESS);
+    REQUIRE(model->getProfilingLevel() == edge::PROFILING_LEVEL::BASIC);
+
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+
+    const auto basicEvents = model->getProfilingEvents();
+    REQUIRE(std::any_of(
+        basicEvents.cbegin(), basicEvents.cend(), [](const auto& event) {
+            return event.type == edge::PROFILING_EVENT::EXECUTE;
+        }));
+    REQUIRE(std::none_of(
+        basicEvents.cbegin(), basicEvents.cend(), [](const auto& event) {
+            return event.type == edge::PROFILING_EVENT::NODE;
+        }));
+
+    /* events are cleared once retrieved */
+    REQUIRE(model->getProfilingEvents().empty());
+
+    /* recording continues after retrieval without enabling profiling again */
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+    const auto laterEvents = model->getProfilingEvents();
+    REQUIRE(std::any_of(
+        laterEvents.cbegin(), laterEvents.cend(), [](const auto& event) {
+            return event.type == edge::PROFILING_EVENT::EXECUTE;
+        }));
+
+    REQUIRE(model->enableProfiling(edge::PROFILING_LEVEL::DETAILED)
+            == edge::STATUS::SUCCESS);
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+
+    const auto detailedEvents = model->getProfilingEvents();
+    REQUIRE(std::any_of(
+        detailedEvents.cbegin(), detailedEvents.cend(), [](const auto& event) {
+            return event.type == edge::PROFILING_EVENT::NODE
+                && event.unit == edge::PROFILING_UNIT::MICROSECONDS;
+        }));
+
+    /* profiling survives delegate changes, which recreate the interpreter */
+    REQUIRE(model->applyDelegate(edge::DELEGATE::CPU)
+            == edge::STATUS::SUCCESS);
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+    REQUIRE_FALSE(model->getProfilingEvents().empty());
+
+    REQUIRE(model->enableProfiling(edge::PROFILING_LEVEL::OFF)
+            == edge::STATUS::SUCCESS);
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+    REQUIRE(model->getProfilingEvents().empty());
+}
+
+TEST_CASE("Tflite profiling at creation", "[tflite][profiling]") {
+    const std::string modelPath = "models/tflite/mobilenet_v3_small.tflite";
+
+    edge::ModelOptions options;
+    options.profilingLevel = edge::PROFILING_LEVEL::BASIC;
+
+    auto model = edge::createModel(modelPath, options);
+    REQUIRE(model != nullptr);
+    REQUIRE(model->getProfilingLevel() == edge::PROFILING_LEVEL::BASIC);
+
+    const auto events = model->getProfilingEvents();
+    REQUIRE(std::any_of(events.cbegin(), events.cend(), [](const auto& event) {
+        return event.type == edge::PROFILING_EVENT::INIT;
+    }));
+}
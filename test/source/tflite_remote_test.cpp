@@ -0,0 +1,90 @@
+#include <cstddef>
+#include <filesystem>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+#include <unistd.h>
+
+#include "edgerunner/edgerunner.hpp"
+#include "edgerunner/model.hpp"
+#include "edgerunner/options.hpp"
+#include "edgerunner/remote/server.hpp"
+
+TEST_CASE("Tflite remote model", "[tflite][remote]") {
+    const std::string modelPath = "models/tflite/mobilenet_v3_small.tflite";
+    const auto socketPath = std::filesystem::temp_directory_path()
+        / ("edgerunner_tflite_" + std::to_string(getpid()) + ".sock");
+
+    edge::remote::Server server {socketPath};
+    REQUIRE(server.start() == edge::STATUS::SUCCESS);
+
+    edge::ModelOptions options;
+    options.remoteSocketPath = socketPath;
+
+    auto local = edge::createModel(modelPath);
+    auto first = edge::createModel(modelPath, options);
+    auto second = edge::createModel(modelPath, options);
+    REQUIRE(local != nullptr);
+    REQUIRE(first != nullptr);
+    REQUIRE(second != nullptr);
+
+    REQUIRE(first->name() == local->name());
+    REQUIRE(first->getInput(0)->getDimensions()
+            == local->getInput(0)->getDimensions());
+
+    auto localInput = local->getInput(0)->getTensorAs<float>();
+    auto firstInput = first->getInput(0)->getTensorAs<float>();
+    auto secondInput = second->getInput(0)->getTensorAs<float>();
+    REQUIRE(firstInput.size() == localInput.size());
+    for (size_t i = 0; i < localInput.size(); ++i) {
+        localInput[i] = static_cast<float>(i % 255) / 255.0F;
+        firstInput[i] = localInput[i];
+        secondInput[i] = 0.0F;
+    }
+
+    REQUIRE(local->execute() == edge::STATUS::SUCCESS);
+
+    /* alternate clients, such that the served model is rebound */
+    for (size_t run = 0; run < 2; ++run) {
+        REQUIRE(first->execute() == edge::STATUS::SUCCESS);
+        REQUIRE(second->execute() == edge::STATUS::SUCCESS);
+
+        const auto localOutput = local->getOutput(0)->getTensorAs<float>();
+        const auto firstOutput = first->getOutput(0)->getTensorAs<float>();
+        REQUIRE(firstOutput.size() == localOutput.size());
+        for (size_t i = 0; i < localOutput.size(); ++i) {
+            REQUIRE(firstOutput[i] == localOutput[i]);
+        }
+    }
+}
+
+TEST_CASE("Tflite remote model directory", "[tflite][remote]") {
+    const auto socketPath = std::filesystem::temp_directory_path()
+        / ("edgerunner_tflite_" + std::to_string(getpid()) + "_dir.sock");
+
+    edge::remote::Server server {socketPath, {}, "models/tflite"};
+    REQUIRE(server.start() == edge::STATUS::SUCCESS);
+
+    /* only the owner may connect */
+    const auto permissions = std::filesystem::status(socketPath).permissions();
+    REQUIRE((permissions & std::filesystem::perms::all)
+            == (std::filesystem::perms::owner_read
+                | std::filesystem::perms::owner_write));
+
+    edge::ModelOptions options;
+    options.remoteSocketPath = socketPath;
+
+    /* models are loaded from within the model directory */
+    auto model = edge::createModel("mobilenet_v3_small.tflite", options);
+    REQUIRE(model != nullptr);
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+
+    /* paths leaving the model directory are rejected */
+    REQUIRE(edge::createModel("../qnn/mobilenet_v3_small.bin", options)
+            == nullptr);
+    REQUIRE(edge::createModel(
+                std::filesystem::absolute(
+                    "models/qnn/mobilenet_v3_small.bin"),
+                options)
+            == nullptr);
+}
@@ -0,0 +1,68 @@
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "edgerunner/batcher.hpp"
+#include "edgerunner/edgerunner.hpp"
+#include "edgerunner/model.hpp"
+
+TEST_CASE("Tflite resize input", "[tflite][resize]") {
+    const std::string modelPath = "models/tflite/mobilenet_v3_small.tflite";
+
+    auto model = edge::createModel(modelPath);
+    REQUIRE(model != nullptr);
+
+    static constexpr size_t BatchSize = 2;
+    REQUIRE(model->resizeInput(0, {BatchSize, 224, 224, 3})
+            == edge::STATUS::SUCCESS);
+    REQUIRE(model->getInput(0)->getDimensions()
+            == std::vector<size_t> {BatchSize, 224, 224, 3});
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+    REQUIRE(model->getOutput(0)->getDimensions()
+            == std::vector<size_t> {BatchSize, 1000});
+
+    /* resized dimensions are kept across interpreter rebuilds */
+    REQUIRE(model->applyDelegate(edge::DELEGATE::CPU) == edge::STATUS::SUCCESS);
+    REQUIRE(model->getInput(0)->getDimensions()
+            == std::vector<size_t> {BatchSize, 224, 224, 3});
+
+    REQUIRE(model->resizeInput(1, {1}) == edge::STATUS::FAIL);
+    REQUIRE(model->resizeInput(0, {BatchSize, 224, 224, 3, 1})
+            == edge::STATUS::FAIL);
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+}
+
+TEST_CASE("Tflite batcher", "[tflite][batcher]") {
+    const std::string modelPath = "models/tflite/mobilenet_v3_small.tflite";
+
+    auto model = edge::createModel(modelPath);
+    REQUIRE(model != nullptr);
+
+    static constexpr size_t NumRequests = 4;
+
+    edge::BatcherOptions options;
+    options.maxBatchSize = NumRequests;
+    edge::Batcher batcher {*model, options};
+
+    const auto sampleSize = batcher.getInputSampleSize(0);
+    REQUIRE(sampleSize == 224 * 224 * 3 * sizeof(float));
+
+    std::vector<std::future<edge::BatchResult>> futures;
+    for (size_t i = 0; i < NumRequests; ++i) {
+        futures.push_back(
+            batcher.submit({std::vector<uint8_t>(sampleSize, 0)}));
+    }
+
+    for (auto& future : futures) {
+        const auto result = future.get();
+        REQUIRE(result.status == edge::STATUS::SUCCESS);
+        REQUIRE(result.outputs.size() == 1);
+        REQUIRE(result.outputs[0].size() == 1000 * sizeof(float));
+    }
+
+    REQUIRE(batcher.getStats().requests == NumRequests);
+}
@@ -0,0 +1,71 @@
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "edgerunner/edgerunner.hpp"
+#include "edgerunner/model.hpp"
+#include "edgerunner/tensor.hpp"
+#include "tflite_utils.hpp"
+
+TEST_CASE("Tflite signatures", "[tflite][signature]") {
+    /* tensor names differ from the signature input and output names */
+    auto modelBuffer = createBinaryModel(
+        {{tflite::BuiltinOperator_ADD, {"a", "b", "sum"}, "add"},
+         {tflite::BuiltinOperator_MUL, {"a", "b", "product"}, "mul"}});
+
+    auto model = edge::createModel(modelBuffer, "tflite");
+    REQUIRE(model != nullptr);
+
+    REQUIRE(model->getGraphNames() == std::vector<std::string> {"add", "mul"});
+
+    REQUIRE(model->selectGraph("not_a_signature") == edge::STATUS::FAIL);
+    REQUIRE(model->execute("not_a_signature") == edge::STATUS::FAIL);
+
+    REQUIRE(model->selectGraph("add") == edge::STATUS::SUCCESS);
+    REQUIRE(model->getNumInputs() == 2);
+    REQUIRE(model->getNumOutputs() == 1);
+    REQUIRE(model->getInput("b") != nullptr);
+    REQUIRE(model->getInput("product") == nullptr);
+    REQUIRE(model->getOutput("sum") != nullptr);
+
+    for (auto& value : model->getInput("a")->getTensorAs<float>()) {
+        value = 2.0F;
+    }
+    for (auto& value : model->getInput("b")->getTensorAs<float>()) {
+        value = 3.0F;
+    }
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+
+    const auto sum = model->getOutput("sum");
+    for (const auto value : sum->getTensorAs<float>()) {
+        REQUIRE(value == 5.0F);
+    }
+
+    /* primary subgraph operations are unavailable for signatures */
+    REQUIRE(model->resizeInput(0, {2, 4}) == edge::STATUS::FAIL);
+    REQUIRE(model->addState(0, 0) == edge::STATUS::FAIL);
+
+    REQUIRE(model->selectGraph("mul") == edge::STATUS::SUCCESS);
+    REQUIRE(model->getOutput("sum") == nullptr);
+
+    for (auto& value : model->getInput("a")->getTensorAs<float>()) {
+        value = 2.0F;
+    }
+    for (auto& value : model->getInput("b")->getTensorAs<float>()) {
+        value = 4.0F;
+    }
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+    for (const auto value : model->getOutput("product")->getTensorAs<float>()) {
+        REQUIRE(value == 8.0F);
+    }
+
+    /* each signature keeps its own allocation */
+    for (const auto value : sum->getTensorAs<float>()) {
+        REQUIRE(value == 5.0F);
+    }
+
+    /* the selected signature is kept when the interpreter is rebuilt */
+    REQUIRE(model->applyDelegate(edge::DELEGATE::CPU) == edge::STATUS::SUCCESS);
+    REQUIRE(model->getOutput("product") != nullptr);
+}
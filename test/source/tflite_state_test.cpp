@@ -0,0 +1,82 @@
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "edgerunner/alignedBuffer.hpp"
+#include "edgerunner/edgerunner.hpp"
+#include "edgerunner/model.hpp"
+#include "edgerunner/tensor.hpp"
+#include "tflite_utils.hpp"
+
+TEST_CASE("Tflite state ping-pong", "[tflite][state]") {
+    /* state_out = x + state_in */
+    auto modelBuffer = createBinaryModel(
+        {{tflite::BuiltinOperator_ADD, {"x", "state_in", "state_out"}, ""}});
+
+    auto model = edge::createModel(modelBuffer, "tflite");
+    REQUIRE(model != nullptr);
+    REQUIRE(model->getNumInputs() == 2);
+    REQUIRE(model->getNumOutputs() == 1);
+
+    /* mismatched and out of range pairs */
+    REQUIRE(model->addState(2, 0) == edge::STATUS::FAIL);
+    REQUIRE(model->addState(1, 1) == edge::STATUS::FAIL);
+
+    REQUIRE(model->addState(1, 0) == edge::STATUS::SUCCESS);
+    REQUIRE(model->addState(1, 0) == edge::STATUS::FAIL);
+
+    auto stateInput = model->getInput(1);
+    auto stateOutput = model->getOutput(0);
+
+    /* state tensors are backed by the model */
+    edge::AlignedBuffer memory {stateInput->getTensorAs<uint8_t>().size()};
+    REQUIRE(model->bindInput(1, memory.data(), memory.size())
+            == edge::STATUS::FAIL);
+
+    for (const auto value : stateInput->getTensorAs<float>()) {
+        REQUIRE(value == 0.0F);
+    }
+
+    auto x = model->getInput(0)->getTensorAs<float>();
+    for (auto& value : x) {
+        value = 1.0F;
+    }
+
+    for (size_t step = 1; step <= 3; ++step) {
+        const auto* previousInput = stateInput->getTensorAs<float>().data();
+        const auto* previousOutput = stateOutput->getTensorAs<float>().data();
+
+        REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+
+        /* the output of this step is the input of the next, without a copy */
+        REQUIRE(stateInput->getTensorAs<float>().data() == previousOutput);
+        REQUIRE(stateOutput->getTensorAs<float>().data() == previousInput);
+
+        for (const auto value : stateInput->getTensorAs<float>()) {
+            REQUIRE(value == static_cast<float>(step));
+        }
+    }
+
+    /* state is kept when the interpreter is rebuilt */
+    REQUIRE(model->applyDelegate(edge::DELEGATE::CPU) == edge::STATUS::SUCCESS);
+    x = model->getInput(0)->getTensorAs<float>();
+    for (auto& value : x) {
+        value = 1.0F;
+    }
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+    for (const auto value : model->getInput(1)->getTensorAs<float>()) {
+        REQUIRE(value == 4.0F);
+    }
+
+    REQUIRE(model->resetState() == edge::STATUS::SUCCESS);
+    for (const auto value : model->getInput(1)->getTensorAs<float>()) {
+        REQUIRE(value == 0.0F);
+    }
+
+    REQUIRE(model->execute() == edge::STATUS::SUCCESS);
+    for (const auto value : model->getInput(1)->getTensorAs<float>()) {
+        REQUIRE(value == 1.0F);
+    }
+}
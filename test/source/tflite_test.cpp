@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cstddef>
 #include <string>
 #include <vector>
@@ -67,4 +68,16 @@ TEST_CASE("Tflite default runtime (CPU)", "[tflite][cpu]") {
     const auto newOutputBuffer = model->getOutput(0)->getTensorAs<float>();
     REQUIRE(outputBuffer.data() == newOutputBuffer.data());
     REQUIRE(outputBuffer.size() == newOutputBuffer.size());
+
+    /* without an asynchronous queue, execution completes synchronously */
+    const auto asyncResult = model->executeAsync().get();
+    REQUIRE(asyncResult.status == edge::STATUS::SUCCESS);
+    REQUIRE(asyncResult.outputs.size() == 1);
+
+    /* results are copies, not overwritten by further executions */
+    REQUIRE(asyncResult.outputs[0] != model->getOutput(0));
+    const auto asyncOutput = asyncResult.outputs[0]->getTensorAs<float>();
+    const auto output = model->getOutput(0)->getTensorAs<float>();
+    REQUIRE(std::equal(
+        asyncOutput.cbegin(), asyncOutput.cend(), output.cbegin(), output.cend()));
 }
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <flatbuffers/flatbuffers.h>
+#include <tensorflow/lite/schema/schema_generated.h>
+
+#include "edgerunner/model.hpp"
+#include "edgerunner/tensor.hpp"
+
+/* a subgraph computing names[2] = names[0] <op> names[1], on float tensors of
+ * shape {1, 4}, exported as a signature unless signatureKey is empty */
+struct BinarySubgraph {
+    tflite::BuiltinOperator op;
+    std::vector<std::string> names;
+    std::string signatureKey;
+};
+
+/* builds a TFLite model with one subgraph per BinarySubgraph, ADD or MUL */
+inline auto createBinaryModel(const std::vector<BinarySubgraph>& binarySubgraphs)
+    -> std::vector<uint8_t> {
+    flatbuffers::FlatBufferBuilder builder;
+
+    const std::vector<int32_t> shape {1, 4};
+    const std::vector<int32_t> inputs {0, 1};
+    const std::vector<int32_t> outputs {2};
+
+    std::vector<flatbuffers::Offset<tflite::OperatorCode>> operatorCodes;
+    std::vector<flatbuffers::Offset<tflite::SubGraph>> subgraphs;
+    std::vector<flatbuffers::Offset<tflite::SignatureDef>> signatureDefs;
+
+    for (size_t i = 0; i < binarySubgraphs.size(); ++i) {
+        const auto& binarySubgraph = binarySubgraphs[i];
+
+        std::vector<flatbuffers::Offset<tflite::Tensor>> tensors;
+        for (const auto& name : binarySubgraph.names) {
+            tensors.push_back(tflite::CreateTensor(builder,
+                                                   builder.CreateVector(shape),
+                                                   tflite::TensorType_FLOAT32,
+                                                   0,
+                                                   builder.CreateString(name)));
+        }
+
+        const auto isMul = binarySubgraph.op == tflite::BuiltinOperator_MUL;
+        const std::vector<flatbuffers::Offset<tflite::Operator>> operators {
+            tflite::CreateOperator(
+                builder,
+                static_cast<uint32_t>(i),
+                builder.CreateVector(inputs),
+                builder.CreateVector(outputs),
+                isMul ? tflite::BuiltinOptions_MulOptions
+                      : tflite::BuiltinOptions_AddOptions,
+                isMul ? tflite::CreateMulOptions(builder).Union()
+                      : tflite::CreateAddOptions(builder).Union()),
+        };
+
+        operatorCodes.push_back(tflite::CreateOperatorCode(
+            builder,
+            static_cast<int8_t>(binarySubgraph.op),
+            0,
+            1,
+            binarySubgraph.op));
+
+        subgraphs.push_back(
+            tflite::CreateSubGraph(builder,
+                                   builder.CreateVector(tensors),
+                                   builder.CreateVector(inputs),
+                                   builder.CreateVector(outputs),
+                                   builder.CreateVector(operators)));
+
+        if (binarySubgraph.signatureKey.empty()) {
+            continue;
+        }
+
+        const auto createTensorMaps = [&](const std::vector<int32_t>& indices) {
+            std::vector<flatbuffers::Offset<tflite::TensorMap>> tensorMaps;
+            for (const auto index : indices) {
+                tensorMaps.push_back(tflite::CreateTensorMap(
+                    builder,
+                    builder.CreateString(
+                        binarySubgraph.names[static_cast<size_t>(index)]),
+                    static_cast<uint32_t>(index)));
+            }
+            return builder.CreateVector(tensorMaps);
+        };
+
+        const auto signatureInputs = createTensorMaps(inputs);
+        const auto signatureOutputs = createTensorMaps(outputs);
+        signatureDefs.push_back(tflite::CreateSignatureDef(
+            builder,
+            signatureInputs,
+            signatureOutputs,
+            builder.CreateString(binarySubgraph.signatureKey),
+            static_cast<uint32_t>(i)));
+    }
+
+    /* buffer 0 is the empty sentinel buffer */
+    const std::vector<flatbuffers::Offset<tflite::Buffer>> buffers {
+        tflite::CreateBuffer(builder),
+    };
+
+    builder.Finish(tflite::CreateModel(builder,
+                                       TFLITE_SCHEMA_VERSION,
+                                       builder.CreateVector(operatorCodes),
+                                       builder.CreateVector(subgraphs),
+                                       builder.CreateString("binary"),
+                                       builder.CreateVector(buffers),
+                                       0,
+                                       0,
+                                       builder.CreateVector(signatureDefs)),
+                   tflite::ModelIdentifier());
+
+    return {builder.GetBufferPointer(),
+            builder.GetBufferPointer() + builder.GetSize()};
+}
+
+/* executes a model on a fixed ramp input, returning its first output */
+inline auto executeModel(edge::Model& model) -> std::vector<float> {
+    auto input = model.getInput(0)->getTensorAs<float>();
+    for (size_t i = 0; i < input.size(); ++i) {
+        input[i] = static_cast<float>(i % 255) / 255.0F;
+    }
+
+    REQUIRE(model.execute() == edge::STATUS::SUCCESS);
+
+    const auto output = model.getOutput(0)->getTensorAs<float>();
+    return {output.cbegin(), output.cend()};
+}
@@ -0,0 +1,103 @@
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "edgerunner/model.hpp"
+#include "edgerunner/trace.hpp"
+
+TEST_CASE("Tracer records scoped events", "[trace]") {
+    auto& tracer = edge::Tracer::get();
+
+    tracer.disable();
+    tracer.clear();
+
+    /* nothing is recorded while disabled */
+    { const edge::TraceScope trace {"disabled"}; }
+    REQUIRE(tracer.getEvents().empty());
+
+    tracer.enable();
+    REQUIRE(tracer.isEnabled());
+
+    {
+        const edge::TraceScope outer {"outer", "model\"name"};
+        const edge::TraceScope inner {
+            "a-very-long-event-name-that-does-not-fit-in-a-single-trace-slot"};
+    }
+
+    tracer.disable();
+
+    const auto events = tracer.getEvents();
+    REQUIRE(events.size() == 2);
+
+    /* events are ordered by start time */
+    REQUIRE(events[0].name == "outer");
+    REQUIRE(events[0].detail == "model\"name");
+    REQUIRE(events[1].name.size() == edge::Tracer::MaxNameLength);
+    REQUIRE(events[1].detail.empty());
+    REQUIRE(events[0].startNs <= events[1].startNs);
+    REQUIRE(events[0].durationNs >= events[1].durationNs);
+
+    const auto trace = tracer.toChromeTrace();
+    REQUIRE(trace.find(R"("traceEvents":[)") != std::string::npos);
+    REQUIRE(trace.find(R"("name":"outer")") != std::string::npos);
+    REQUIRE(trace.find(R"("ph":"X")") != std::string::npos);
+    REQUIRE(trace.find(R"("args":{"detail":"model\"name"})")
+            != std::string::npos);
+
+    const auto tracePath =
+        std::filesystem::temp_directory_path() / "edgerunner_trace.json";
+    REQUIRE(tracer.dumpChromeTrace(tracePath) == edge::STATUS::SUCCESS);
+
+    std::ifstream file(tracePath);
+    const std::string contents {std::istreambuf_iterator<char>(file),
+                                std::istreambuf_iterator<char>()};
+    REQUIRE(contents == trace);
+    std::filesystem::remove(tracePath);
+
+    tracer.clear();
+    REQUIRE(tracer.getEvents().empty());
+}
+
+TEST_CASE("Tracer ring buffer under concurrent recording", "[trace]") {
+    auto& tracer = edge::Tracer::get();
+
+    tracer.clear();
+    tracer.enable();
+
+    static constexpr size_t NumThreads = 4;
+    const size_t numEventsPerThread = edge::Tracer::DefaultCapacity;
+
+    std::vector<std::thread> threads;
+    threads.reserve(NumThreads);
+    for (size_t i = 0; i < NumThreads; ++i) {
+        threads.emplace_back([numEventsPerThread]() {
+            for (size_t j = 0; j < numEventsPerThread; ++j) {
+                const edge::TraceScope trace {"event"};
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    tracer.disable();
+
+    /* the oldest events have been overwritten */
+    const auto events = tracer.getEvents();
+    REQUIRE(!events.empty());
+    REQUIRE(events.size() <= edge::Tracer::DefaultCapacity);
+
+    for (const auto& event : events) {
+        REQUIRE(event.name == "event");
+        REQUIRE(event.threadId > 0);
+    }
+
+    tracer.clear();
+}